@@ -0,0 +1,119 @@
+/*---------------------------------------------------------------------------------*/
+/*  NOMAD - Nonlinear Optimization by Mesh Adaptive Direct Search -                */
+/*                                                                                 */
+/*  NOMAD - Version 4.0.0 has been created by                                      */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  The copyright of NOMAD - version 4.0.0 is owned by                             */
+/*                 Sebastien Le Digabel        - Polytechnique Montreal            */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  NOMAD v4 has been funded by Rio Tinto, Hydro-Québec, NSERC (Natural Science    */
+/*  and Engineering Research Council of Canada), INOVEE (Innovation en Energie     */
+/*  Electrique and IVADO (The Institute for Data Valorization)                     */
+/*                                                                                 */
+/*  NOMAD v3 was created and developed by Charles Audet, Sebastien Le Digabel,     */
+/*  Christophe Tribes and Viviane Rochon Montplaisir and was funded by AFOSR       */
+/*  and Exxon Mobil.                                                               */
+/*                                                                                 */
+/*  NOMAD v1 and v2 were created and developed by Mark Abramson, Charles Audet,    */
+/*  Gilles Couture, and John E. Dennis Jr., and were funded by AFOSR and           */
+/*  Exxon Mobil.                                                                   */
+/*                                                                                 */
+/*  Contact information:                                                           */
+/*    Polytechnique Montreal - GERAD                                               */
+/*    C.P. 6079, Succ. Centre-ville, Montreal (Quebec) H3C 3A7 Canada              */
+/*    e-mail: nomad@gerad.ca                                                       */
+/*    phone : 1-514-340-6053 #6928                                                 */
+/*    fax   : 1-514-340-5665                                                       */
+/*                                                                                 */
+/*  This program is free software: you can redistribute it and/or modify it        */
+/*  under the terms of the GNU Lesser General Public License as published by       */
+/*  the Free Software Foundation, either version 3 of the License, or (at your     */
+/*  option) any later version.                                                     */
+/*                                                                                 */
+/*  This program is distributed in the hope that it will be useful, but WITHOUT    */
+/*  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or          */
+/*  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License    */
+/*  for more details.                                                              */
+/*                                                                                 */
+/*  You should have received a copy of the GNU Lesser General Public License       */
+/*  along with this program. If not, see <http://www.gnu.org/licenses/>.           */
+/*                                                                                 */
+/*  You can find information on the NOMAD software at www.gerad.ca/nomad           */
+/*---------------------------------------------------------------------------------*/
+
+#ifndef __NOMAD400_MADS__
+#define __NOMAD400_MADS__
+
+#include "../../Eval/EvaluatorControl.hpp"
+
+#include "../../Algos/Algorithm.hpp"
+#include "../../Algos/AlgoStopReasons.hpp"
+#include "../../Algos/Step.hpp"
+
+// Mads specific
+#include "../../Algos/Mads/MadsInitialization.hpp"
+#include "../../Algos/Mads/MadsMegaIteration.hpp"
+
+#include "../../Param/RunParameters.hpp"
+#include "../../Param/PbParameters.hpp"
+#include "../../Param/EvalParameters.hpp"
+#include "../../Param/DisplayParameters.hpp"
+
+#include "../../nomad_nsbegin.hpp"
+
+
+/// The (M)esh (A)daptive (D)irect (S)earch algorithm.
+/**
+\note AllParameters and EvaluatorControl are held by MainStep.
+Cache is a singleton all by itself.
+MegaIteration holds the algorithm-related structures: Mesh, Barrier.
+ */
+class Mads: public Algorithm
+{
+public:
+    /// Constructor
+    /**
+     \param parentStep          The parent of this step -- \b IN.
+     \param stopReasons         The stop reasons for MADS -- \b IN.
+     \param runParams           The run parameters that control MADS -- \b IN.
+     \param pbParams            The problem parameters that control MADS -- \b IN.
+     */
+    explicit Mads(const Step* parentStep,
+                  std::shared_ptr<AlgoStopReasons<MadsStopType>> stopReasons,
+                  const std::shared_ptr<RunParameters>& runParams,
+                  const std::shared_ptr<PbParameters>& pbParams)
+      : Algorithm(parentStep, stopReasons, runParams, pbParams)
+    {
+        init();
+    }
+    
+    int getCumulatedFailure() const {return cumulatedFailure;}
+
+
+private:
+    ///  Initialization of class, to be used by Constructor.
+    void init();
+
+    /// Algorithm execution for single-objective.
+    /**
+     Overrides the default algorithm's run
+     \return \c true
+     */
+    virtual bool runImp() override;
+    
+    /// Helper for start()
+    void readInformationForHotRestart() override ;
+	
+	mutable int cumulatedFailure = 0; //counts the number of consecutive failures since the last successful megaiteration
+    
+    void updateCumulatedFailure(NOMAD::SuccessType successType);
+
+};
+
+#include "../../nomad_nsend.hpp"
+
+#endif // __NOMAD400_MADS__
@@ -0,0 +1,103 @@
+/*---------------------------------------------------------------------------------*/
+/*  NOMAD - Nonlinear Optimization by Mesh Adaptive Direct Search -                */
+/*                                                                                 */
+/*  NOMAD - Version 4.0.0 has been created by                                      */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  The copyright of NOMAD - version 4.0.0 is owned by                             */
+/*                 Sebastien Le Digabel        - Polytechnique Montreal            */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  NOMAD v4 has been funded by Rio Tinto, Hydro-Québec, NSERC (Natural Science    */
+/*  and Engineering Research Council of Canada), INOVEE (Innovation en Energie     */
+/*  Electrique and IVADO (The Institute for Data Valorization)                     */
+/*                                                                                 */
+/*  NOMAD v3 was created and developed by Charles Audet, Sebastien Le Digabel,     */
+/*  Christophe Tribes and Viviane Rochon Montplaisir and was funded by AFOSR       */
+/*  and Exxon Mobil.                                                               */
+/*                                                                                 */
+/*  NOMAD v1 and v2 were created and developed by Mark Abramson, Charles Audet,    */
+/*  Gilles Couture, and John E. Dennis Jr., and were funded by AFOSR and           */
+/*  Exxon Mobil.                                                                   */
+/*                                                                                 */
+/*  Contact information:                                                           */
+/*    Polytechnique Montreal - GERAD                                               */
+/*    C.P. 6079, Succ. Centre-ville, Montreal (Quebec) H3C 3A7 Canada              */
+/*    e-mail: nomad@gerad.ca                                                       */
+/*    phone : 1-514-340-6053 #6928                                                 */
+/*    fax   : 1-514-340-5665                                                       */
+/*                                                                                 */
+/*  This program is free software: you can redistribute it and/or modify it        */
+/*  under the terms of the GNU Lesser General Public License as published by       */
+/*  the Free Software Foundation, either version 3 of the License, or (at your     */
+/*  option) any later version.                                                     */
+/*                                                                                 */
+/*  This program is distributed in the hope that it will be useful, but WITHOUT    */
+/*  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or          */
+/*  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License    */
+/*  for more details.                                                              */
+/*                                                                                 */
+/*  You should have received a copy of the GNU Lesser General Public License       */
+/*  along with this program. If not, see <http://www.gnu.org/licenses/>.           */
+/*                                                                                 */
+/*  You can find information on the NOMAD software at www.gerad.ca/nomad           */
+/*---------------------------------------------------------------------------------*/
+#ifndef __NOMAD400_MADSUPDATE__
+#define __NOMAD400_MADSUPDATE__
+
+#include "../../Algos/Mads/Mads.hpp"
+
+#include "../../Algos/Step.hpp"
+
+#include "../../nomad_nsbegin.hpp"
+
+/// Class for Step 1. of MADS algorithm: parameter update.
+/**
+ The update is performed when calling the MadsUpdate::run function.
+ */
+class MadsUpdate: public Step
+{
+public:
+    // Constructor
+    explicit MadsUpdate(const Step* parentStep )
+      : Step(parentStep )
+    {
+        init();
+    }
+
+
+private:
+    
+    /// Helper for constructor to check for valid ancestor.
+    void init();
+
+    /// No implementation is required for start.
+    virtual void    startImp() override {}
+    
+    /// Implementation of the run tasks.
+    /**
+     Gets the best feasible point (xFeas) and best infeasible point (xInf)
+     from the cache, and updates the MegaIteration's Barrier member with it.
+     Compares new values of xFeas and xInf with previous ones
+     - i.e., compute success or failure.
+     Enlarges or shrinks the delta (mesh size) and Delta (frame size)
+     accordingly.
+     */
+    virtual bool    runImp()   override;
+    
+    /// No implementation is required for start.
+    virtual void    endImp()   override {}
+    
+    
+    /**
+     Update values of xFeas and xInf in parent MegaIteration's Barrier
+     */
+    void updateBestInBarrier(bool feasible);
+
+};
+
+#include "../../nomad_nsend.hpp"
+
+#endif // __NOMAD400_MADSUPDATE__
@@ -0,0 +1,99 @@
+/*---------------------------------------------------------------------------------*/
+/*  NOMAD - Nonlinear Optimization by Mesh Adaptive Direct Search -                */
+/*                                                                                 */
+/*  NOMAD - Version 4.0.0 has been created by                                      */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  The copyright of NOMAD - version 4.0.0 is owned by                             */
+/*                 Sebastien Le Digabel        - Polytechnique Montreal            */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  NOMAD v4 has been funded by Rio Tinto, Hydro-Québec, NSERC (Natural Science    */
+/*  and Engineering Research Council of Canada), INOVEE (Innovation en Energie     */
+/*  Electrique and IVADO (The Institute for Data Valorization)                     */
+/*                                                                                 */
+/*  NOMAD v3 was created and developed by Charles Audet, Sebastien Le Digabel,     */
+/*  Christophe Tribes and Viviane Rochon Montplaisir and was funded by AFOSR       */
+/*  and Exxon Mobil.                                                               */
+/*                                                                                 */
+/*  NOMAD v1 and v2 were created and developed by Mark Abramson, Charles Audet,    */
+/*  Gilles Couture, and John E. Dennis Jr., and were funded by AFOSR and           */
+/*  Exxon Mobil.                                                                   */
+/*                                                                                 */
+/*  Contact information:                                                           */
+/*    Polytechnique Montreal - GERAD                                               */
+/*    C.P. 6079, Succ. Centre-ville, Montreal (Quebec) H3C 3A7 Canada              */
+/*    e-mail: nomad@gerad.ca                                                       */
+/*    phone : 1-514-340-6053 #6928                                                 */
+/*    fax   : 1-514-340-5665                                                       */
+/*                                                                                 */
+/*  This program is free software: you can redistribute it and/or modify it        */
+/*  under the terms of the GNU Lesser General Public License as published by       */
+/*  the Free Software Foundation, either version 3 of the License, or (at your     */
+/*  option) any later version.                                                     */
+/*                                                                                 */
+/*  This program is distributed in the hope that it will be useful, but WITHOUT    */
+/*  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or          */
+/*  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License    */
+/*  for more details.                                                              */
+/*                                                                                 */
+/*  You should have received a copy of the GNU Lesser General Public License       */
+/*  along with this program. If not, see <http://www.gnu.org/licenses/>.           */
+/*                                                                                 */
+/*  You can find information on the NOMAD software at www.gerad.ca/nomad           */
+/*---------------------------------------------------------------------------------*/
+#ifndef __NOMAD400_SEARCHMETHOD__
+#define __NOMAD400_SEARCHMETHOD__
+
+#include "../../Algos/Mads/MadsIterationUtils.hpp"
+
+#include "../../nomad_nsbegin.hpp"
+
+// Class for generic search method of MADS. Run by Search.
+class SearchMethod: public Step , public MadsIterationUtils
+{
+private:
+    
+    bool _enabled; ///< Should this search method be used? Modified by parameters.
+
+    /// AlgoComment to show when this SearchMethod is used
+    std::string _comment;
+
+public:
+    /// Constructor
+    /**
+     /param parentStep      The parent of this search step -- \b IN.
+     */
+    explicit SearchMethod( const Step* parentStep )
+      : Step( parentStep ),
+        MadsIterationUtils ( parentStep ),
+        _enabled(true),
+        _comment("")
+    {
+        init();
+    }
+
+    // Get / Set
+    bool isEnabled() const { return _enabled; }
+    void setEnabled(const bool enabled) { _enabled = enabled; }
+
+    const std::string& getComment() const { return _comment; }
+    bool hasComment() const { return (!_comment.empty()); }
+    void setComment(const std::string& comment) { _comment = comment; }
+
+    // Step methods
+    virtual void startImp() override ;
+    virtual bool runImp() override ;
+    virtual void endImp() override ;
+
+protected:
+    void init();
+
+};
+
+#include "../../nomad_nsend.hpp"
+
+#endif // __NOMAD400_SEARCHMETHOD__
+
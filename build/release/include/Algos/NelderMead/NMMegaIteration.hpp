@@ -0,0 +1,127 @@
+/*---------------------------------------------------------------------------------*/
+/*  NOMAD - Nonlinear Optimization by Mesh Adaptive Direct Search -                */
+/*                                                                                 */
+/*  NOMAD - Version 4.0.0 has been created by                                      */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  The copyright of NOMAD - version 4.0.0 is owned by                             */
+/*                 Sebastien Le Digabel        - Polytechnique Montreal            */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  NOMAD v4 has been funded by Rio Tinto, Hydro-Québec, NSERC (Natural Science    */
+/*  and Engineering Research Council of Canada), INOVEE (Innovation en Energie     */
+/*  Electrique and IVADO (The Institute for Data Valorization)                     */
+/*                                                                                 */
+/*  NOMAD v3 was created and developed by Charles Audet, Sebastien Le Digabel,     */
+/*  Christophe Tribes and Viviane Rochon Montplaisir and was funded by AFOSR       */
+/*  and Exxon Mobil.                                                               */
+/*                                                                                 */
+/*  NOMAD v1 and v2 were created and developed by Mark Abramson, Charles Audet,    */
+/*  Gilles Couture, and John E. Dennis Jr., and were funded by AFOSR and           */
+/*  Exxon Mobil.                                                                   */
+/*                                                                                 */
+/*  Contact information:                                                           */
+/*    Polytechnique Montreal - GERAD                                               */
+/*    C.P. 6079, Succ. Centre-ville, Montreal (Quebec) H3C 3A7 Canada              */
+/*    e-mail: nomad@gerad.ca                                                       */
+/*    phone : 1-514-340-6053 #6928                                                 */
+/*    fax   : 1-514-340-5665                                                       */
+/*                                                                                 */
+/*  This program is free software: you can redistribute it and/or modify it        */
+/*  under the terms of the GNU Lesser General Public License as published by       */
+/*  the Free Software Foundation, either version 3 of the License, or (at your     */
+/*  option) any later version.                                                     */
+/*                                                                                 */
+/*  This program is distributed in the hope that it will be useful, but WITHOUT    */
+/*  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or          */
+/*  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License    */
+/*  for more details.                                                              */
+/*                                                                                 */
+/*  You should have received a copy of the GNU Lesser General Public License       */
+/*  along with this program. If not, see <http://www.gnu.org/licenses/>.           */
+/*                                                                                 */
+/*  You can find information on the NOMAD software at www.gerad.ca/nomad           */
+/*---------------------------------------------------------------------------------*/
+#ifndef __NOMAD400_NMMEGAITERATION__
+#define __NOMAD400_NMMEGAITERATION__
+
+
+
+#include "../../Algos/MegaIteration.hpp"
+#include "../../Algos/NelderMead/NMIteration.hpp"
+
+#include "../../nomad_nsbegin.hpp"
+
+/// Class for Nelder Mead mega iteration.
+/**
+ * Manager for Nelder Mead iterations starts, runs and ends.
+ * Steps:
+ * - Generate points over simplices (start).
+ * - Evaluate points (run)
+ * - Post-processing (end)
+ */
+class NMMegaIteration: public MegaIteration
+{
+protected:
+
+    std::shared_ptr<NMIteration> _nmIteration;
+
+private:
+    
+    void init();
+
+public:
+    /// Constructor
+    /**
+     \param parentStep      The parent step of this step -- \b IN.
+     \param k               The main iteration counter -- \b IN.
+     \param barrier         The barrier for constraints handling -- \b IN.
+     \param success         Success type of the previous MegaIteration. -- \b IN.
+     */
+    explicit NMMegaIteration(const Step* parentStep,
+                              size_t k,
+                              std::shared_ptr<Barrier> barrier,
+                              SuccessType success)
+      : MegaIteration(parentStep, k,barrier,success), _nmIteration(nullptr)
+    {
+        init();
+    }
+    // No Destructor needed - keep defaults.
+
+
+    void read(  std::istream& is ) override;
+    void display(  std::ostream& os ) const override ;
+
+private:
+    
+    /// Implementation of start task.
+    /**
+     Create a Nelder Mead iteration for a current incumbent: use xFeas or xInf from the barrier. \n
+     \note Running the algorithm requires a single iteration object with several start, run, end for the various iterations of the algorithm. This allows to easily maintain a proper simplex in a single NMIteration object.
+     */
+    virtual void startImp() override ;
+    
+    /// Implementation of run task.
+    /**
+     The algorithm iterations are started, ran and ended sequentially until a stop reason to terminate is obtained. \n
+     We have a success if either a better xFeas or
+     a dominating or partial success for xInf was found.
+     See Algorithm 12.2 from DFBO.
+     */
+    virtual bool runImp() override;
+
+};
+
+/**
+ Display useful values so that a new MegaIteration could be constructed using these values.
+ */
+std::ostream& operator<<(std::ostream& os, const NMMegaIteration& megaIteration);
+
+/// Get an MegaIteration values from a stream
+std::istream& operator>>(std::istream& is, NMMegaIteration& megaIteration);
+
+#include "../../nomad_nsend.hpp"
+
+#endif // __NOMAD400_NMMEGAITERATION__
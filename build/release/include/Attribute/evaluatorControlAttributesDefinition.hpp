@@ -0,0 +1,18 @@
+//////////// THIS FILE MUST BE CREATED BY EXECUTING WriteAttributeDefinitionFile ////////////
+//////////// DO NOT MODIFY THIS FILE MANUALLY ///////////////////////////////////////////////
+
+#ifndef __NOMAD400_EVALUATORCONTROLATTRIBUTESDEFINITION__
+#define __NOMAD400_EVALUATORCONTROLATTRIBUTESDEFINITION__
+
+_definition = {
+{ "MAX_BB_EVAL",  "size_t",  "INF",  " Stopping criterion on the number of blackbox evaluations ",  " \n  \n . Maximum number of blackbox evaluations \n  \n . Argument: one positive integer \n  \n . An INF value serves to disable the stopping criterion. \n  \n . Does not consider evaluations taken in the cache (cache hits) \n  \n . In bi-objective mode: max number of blackbox evaluations for each MADS run \n  \n . Example: MAX_BB_EVAL 1000 \n  \n . Default: INF\n\n",  "  basic stop stops stopping max maximum criterion criterions blackbox blackboxes bb  "  , "false" , "true" , "true" },
+{ "MAX_EVAL",  "size_t",  "INF",  " Stopping criterion on the number of evaluations (blackbox and cache) ",  " \n  \n . Maximum number of evaluations, including evaluations taken in the cache \n   (cache hits) \n  \n . Argument: one positive integer \n  \n . An INF value serves to disable the stopping criterion. \n  \n . Example: MAX_EVAL 1000 \n  \n . Default: INF\n\n",  "  advanced stop stops stopping max maximum criterion criterions blackbox blackboxes bb eval evals evaluation evaluations cache  "  , "false" , "true" , "true" },
+{ "OPPORTUNISTIC_EVAL",  "bool",  "true",  " Opportunistic strategy - general flag (terminate evaluations as soon as a success is found) ",  " \n  \n . Opportunistic strategy: Terminate evaluations as soon as a success is found \n  \n . This parameter is the default value for other OPPORTUNISTIC parameters, \n    including Search steps \n  \n . This parameter is the value used for Poll step \n  \n . Argument: one boolean (yes or no) \n  \n . Type 'nomad -h opportunistic' to see advanced options \n  \n . Example: OPPORTUNISTIC_EVAL no  # complete evaluations \n  \n . Default: true\n\n",  "  advanced opportunistic oppor eval evals evaluation evaluations terminate list success successes  "  , "true" , "true" , "true" },
+{ "CLEAR_EVAL_QUEUE",  "bool",  "true",  " Opportunistic strategy: Flag to clear EvaluatorControl queue between each run ",  " \n  \n . Opportunistic strategy: If a success is found, clear evaluation queue of  \n   other points. \n  \n . If this flag is false, the points in the evaluation queue that are not yet  \n   evaluated might be evaluated later. \n  \n . If this flag is true, the points in the evaluation queue that are not yet \n   evaluated will be flushed. \n  \n . Outside of opportunistic strategy, this flag has no effect. \n  \n . Default: true\n\n",  "  advanced opportunistic oppor eval evals evaluation evaluations clear flush  "  , "true" , "true" , "true" },
+{ "ASYNC_EVAL",  "bool",  "false",  " Asynchronous evaluations: keep evaluating across iterations ",  " \n  \n . If this flag is false, each run of the evaluation queue waits for the \n   evaluations in progress to be done before the next iteration starts. \n  \n . If this flag is true, the next iteration starts without waiting for the \n   evaluations in progress, and points remaining in the queue are not \n   cleared. The other threads keep on evaluating while the next trial points \n   are generated. Late results are taken into account by the barrier and \n   mesh update of a later iteration. \n  \n . Only the evaluations of the Mads search and poll steps are asynchronous. \n   Other steps, for instance initialization and Nelder-Mead, wait for \n   their evaluations. \n  \n . CLEAR_EVAL_QUEUE is ignored when this flag is true. Points that are too \n   old are discarded instead, see ASYNC_EVAL_MAX_STALENESS. \n  \n . Results depend on the evaluation times, even with a single thread. \n  \n . Argument: one boolean (yes or no) \n  \n . Example: ASYNC_EVAL yes \n  \n . Default: false\n\n",  "  advanced asynchronous async eval evals evaluation evaluations thread threads parallel queue  "  , "true" , "true" , "true" },
+{ "ASYNC_EVAL_MAX_STALENESS",  "size_t",  "2",  " Asynchronous evaluations: number of iterations a point may stay in the queue ",  " \n  \n . When ASYNC_EVAL is true, a trial point generated by iteration k is \n   discarded from the evaluation queue, without being evaluated, once \n   an iteration greater than k + ASYNC_EVAL_MAX_STALENESS has added points. \n  \n . Points that are not generated by an iteration on a mesh are never \n   discarded. \n  \n . Outside of asynchronous evaluations, this parameter has no effect. \n  \n . Argument: one nonnegative integer \n  \n . Example: ASYNC_EVAL_MAX_STALENESS 0  # Only keep points of the last iteration \n  \n . Default: 2\n\n",  "  advanced asynchronous async eval evals evaluation evaluations queue stale iteration iterations  "  , "true" , "true" , "true" },
+{ "BB_MAX_BLOCK_SIZE",  "size_t",  "1",  " Size of blocks of points, to be used for parallel evaluations ",  " \n . Maximum size of a block of evaluations send to the blackbox \n   executable at once. Blackbox executable can manage parallel \n   evaluations on its own. Opportunistic strategies may apply after \n   each block of evaluations. \n     \n . Depending on the algorithm phase, the blackbox executable will \n   receive at most BB_MAX_BLOCK_SIZE points to evaluate. \n     \n . When this parameter is greater than one, the number of evaluations \n   may exceed the MAX_BB_EVAL stopping criterion. \n     \n . Argument: integer > 0 \n   \n . Example: BB_MAX_BLOCK_SIZE 3 \n            The blackbox executable receives blocks of \n            at most 3 points for evaluation. \n  \n . Default: 1\n\n",  "  advanced block parallel  "  , "true" , "true" , "true" },
+{ "MAX_BLOCK_EVAL",  "size_t",  "INF",  " Stopping criterion on the number of blocks evaluations ",  " \n  \n . Maximum number of blocks evaluations \n  \n . Argument: one positive integer \n  \n . An INF value serves to disable the stopping criterion. \n  \n . Example: MAX_BLOCK_EVAL 100 \n  \n . Default: INF\n\n",  "  advances block stop parallel  "  , "true" , "true" , "true" },
+{ "SGTELIB_MODEL_EVAL_NB",  "size_t",  "100",  " Max number of sgtelib model evaluations for each optimization of the surrogate problem ",  " \n . Max number of sgtelib model evaluations for each \n     optimization of the surrogate problem. \n  \n . Argument: one integer > 0 \n  \n . Note: In NOMAD 3, the default is 10000. Early tests in NOMAD 4 show extremely \n   long resolution times for this value. The default value is set to 100 until \n   more investigation is done. \n  \n . Example: SGTELIB_MODEL_EVAL_NB 5000 \n . Default: 100\n\n",  "  advanced sgtelib search model model_search  "  , "true" , "true" , "true" } };
+
+#endif
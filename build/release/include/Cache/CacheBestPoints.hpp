@@ -0,0 +1,183 @@
+/*---------------------------------------------------------------------------------*/
+/*  NOMAD - Nonlinear Optimization by Mesh Adaptive Direct Search -                */
+/*                                                                                 */
+/*  NOMAD - Version 4.0.0 has been created by                                      */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  The copyright of NOMAD - version 4.0.0 is owned by                             */
+/*                 Sebastien Le Digabel        - Polytechnique Montreal            */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  NOMAD v4 has been funded by Rio Tinto, Hydro-Québec, NSERC (Natural Science    */
+/*  and Engineering Research Council of Canada), INOVEE (Innovation en Energie     */
+/*  Electrique and IVADO (The Institute for Data Valorization)                     */
+/*                                                                                 */
+/*  NOMAD v3 was created and developed by Charles Audet, Sebastien Le Digabel,     */
+/*  Christophe Tribes and Viviane Rochon Montplaisir and was funded by AFOSR       */
+/*  and Exxon Mobil.                                                               */
+/*                                                                                 */
+/*  NOMAD v1 and v2 were created and developed by Mark Abramson, Charles Audet,    */
+/*  Gilles Couture, and John E. Dennis Jr., and were funded by AFOSR and           */
+/*  Exxon Mobil.                                                                   */
+/*                                                                                 */
+/*  Contact information:                                                           */
+/*    Polytechnique Montreal - GERAD                                               */
+/*    C.P. 6079, Succ. Centre-ville, Montreal (Quebec) H3C 3A7 Canada              */
+/*    e-mail: nomad@gerad.ca                                                       */
+/*    phone : 1-514-340-6053 #6928                                                 */
+/*    fax   : 1-514-340-5665                                                       */
+/*                                                                                 */
+/*  This program is free software: you can redistribute it and/or modify it        */
+/*  under the terms of the GNU Lesser General Public License as published by       */
+/*  the Free Software Foundation, either version 3 of the License, or (at your     */
+/*  option) any later version.                                                     */
+/*                                                                                 */
+/*  This program is distributed in the hope that it will be useful, but WITHOUT    */
+/*  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or          */
+/*  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License    */
+/*  for more details.                                                              */
+/*                                                                                 */
+/*  You should have received a copy of the GNU Lesser General Public License       */
+/*  along with this program. If not, see <http://www.gnu.org/licenses/>.           */
+/*                                                                                 */
+/*  You can find information on the NOMAD software at www.gerad.ca/nomad           */
+/*---------------------------------------------------------------------------------*/
+/**
+ * \file   CacheBestPoints.hpp
+ * \brief  Best feasible and infeasible points of a cache, maintained on insertion.
+ * \see    CacheBestPoints.cpp
+ */
+
+#ifndef __NOMAD400_CACHEBESTPOINTS__
+#define __NOMAD400_CACHEBESTPOINTS__
+
+#include <map>
+
+#include "../Eval/EvalPoint.hpp"
+#include "../Math/Point.hpp"
+
+#include "../nomad_nsbegin.hpp"
+
+
+/// Cache points with a blackbox evaluation, ordered for findBestFeas and findBestInf.
+/**
+ * Points with an EVAL_OK blackbox evaluation are kept in:
+ * - an ordered map on f, for feasible points;
+ * - an ordered map on (h, f), for infeasible points with a finite h.
+ *
+ * With the default success type (Eval::defaultComputeSuccessType), the
+   scan done by CacheSet::findBest keeps the points with the lowest f among
+   feasible points, and the points with the lowest (h, f), in lexicographic
+   order, among infeasible points. These are the first elements of the maps,
+   so no scan is needed. Points that do not belong to the subproblem are
+   skipped.
+ *
+ * The maps hold pointers to the EvalPoints owned by the cache, and keys
+   computed from their blackbox Eval. The cache must call erase() before an
+   Eval is modified and insert() after. When that is not possible (points
+   modified in bulk, or removed from the cache), the cache calls
+   invalidate(), and the maps are rebuilt at the next query.
+ * This class does not lock anything; the cache is responsible for that.
+ */
+class CacheBestPoints
+{
+private:
+    typedef std::multimap<double, const EvalPoint*> FeasMap;
+    typedef std::multimap<std::pair<double, double>, const EvalPoint*> InfMap;
+
+    FeasMap _feas;              ///< Feasible points, ordered by f
+    InfMap  _inf;               ///< Infeasible points with a finite h, ordered by (h, f)
+    size_t  _nbFeasUnordered;   ///< Number of feasible points with an undefined f, not in _feas
+    size_t  _nbInfUnordered;    ///< Number of infeasible points with h = INF or undefined f or h, not in _inf
+    bool    _valid;             ///< False if the maps need to be rebuilt
+
+public:
+    /// Constructor
+    explicit CacheBestPoints()
+      : _feas(),
+        _inf(),
+        _nbFeasUnordered(0),
+        _nbInfUnordered(0),
+        _valid(true)
+    {}
+
+    /// Test if these maps can be used instead of a scan for this kind of query.
+    /**
+     \param evalType    Which Eval (Blackbox or Surrogate) is looked at -- \b IN.
+     \return            \c true if evalType is BB and the default success type is used.
+     */
+    static bool canBeUsed(const EvalType& evalType);
+
+    /// Test if the maps are up to date with the cache.
+    bool isValid() const { return _valid; }
+
+    /// Mark the maps as not up to date with the cache.
+    void invalidate();
+
+    /// Remove all points. The maps are valid for an empty cache.
+    void clear();
+
+    /// Reset the maps with the points of the cache.
+    /**
+     \param cache   The points of the cache  -- \b IN.
+     */
+    void rebuild(const CacheEvalPointSet& cache);
+
+    /// Add a point of the cache, following its current blackbox Eval.
+    /**
+     * Points without an EVAL_OK blackbox Eval are ignored.
+     \param evalPoint   The point, as held by the cache  -- \b IN.
+     */
+    void insert(const EvalPoint* evalPoint);
+
+    /// Remove a point of the cache, before its blackbox Eval is modified.
+    /**
+     \param evalPoint   The point, as held by the cache  -- \b IN.
+     */
+    void erase(const EvalPoint* evalPoint);
+
+    /// Test if there is a feasible point.
+    bool hasFeas() const { return !_feas.empty() || _nbFeasUnordered > 0; }
+
+    /// Get the best feasible points of the subproblem.
+    /**
+     \param fixedVariable   The subproblem                                   -- \b IN.
+     \param evalPointList   The best feasible points, in the cache order     -- \b OUT.
+     \return                \c false if the maps are not valid or if there are feasible points with an undefined f, that are not kept in the maps. A scan is then needed.
+     */
+    bool findBestFeas(const Point& fixedVariable,
+                      std::vector<EvalPoint> &evalPointList) const;
+
+    /// Get the best infeasible points of the subproblem, with h <= hMax.
+    /**
+     \param hMax            Select a point if h <= hMax                      -- \b IN.
+     \param fixedVariable   The subproblem                                   -- \b IN.
+     \param evalPointList   The best infeasible points, in the cache order   -- \b OUT.
+     \return                \c false if the maps are not valid or if the result depends on infeasible points that are not kept in the maps. A scan is then needed.
+     */
+    bool findBestInf(const Double& hMax,
+                     const Point& fixedVariable,
+                     std::vector<EvalPoint> &evalPointList) const;
+
+private:
+    /// Kind of entry for a point, following its blackbox Eval
+    enum class EntryType
+    {
+        NONE,           ///< No EVAL_OK blackbox Eval; not kept
+        FEAS,           ///< In _feas
+        FEAS_UNORDERED, ///< Counted in _nbFeasUnordered
+        INF,            ///< In _inf
+        INF_UNORDERED,  ///< Counted in _nbInfUnordered
+        UNKNOWN         ///< f and h need to be recomputed; the maps are invalidated
+    };
+
+    /// Get the kind of entry and the keys for a point.
+    static EntryType getEntryType(const EvalPoint* evalPoint, double& f, double& h);
+};
+
+
+#include "../nomad_nsend.hpp"
+
+#endif // __NOMAD400_CACHEBESTPOINTS__
@@ -0,0 +1,217 @@
+/*---------------------------------------------------------------------------------*/
+/*  NOMAD - Nonlinear Optimization by Mesh Adaptive Direct Search -                */
+/*                                                                                 */
+/*  NOMAD - Version 4.0.0 has been created by                                      */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  The copyright of NOMAD - version 4.0.0 is owned by                             */
+/*                 Sebastien Le Digabel        - Polytechnique Montreal            */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  NOMAD v4 has been funded by Rio Tinto, Hydro-Québec, NSERC (Natural Science    */
+/*  and Engineering Research Council of Canada), INOVEE (Innovation en Energie     */
+/*  Electrique and IVADO (The Institute for Data Valorization)                     */
+/*                                                                                 */
+/*  NOMAD v3 was created and developed by Charles Audet, Sebastien Le Digabel,     */
+/*  Christophe Tribes and Viviane Rochon Montplaisir and was funded by AFOSR       */
+/*  and Exxon Mobil.                                                               */
+/*                                                                                 */
+/*  NOMAD v1 and v2 were created and developed by Mark Abramson, Charles Audet,    */
+/*  Gilles Couture, and John E. Dennis Jr., and were funded by AFOSR and           */
+/*  Exxon Mobil.                                                                   */
+/*                                                                                 */
+/*  Contact information:                                                           */
+/*    Polytechnique Montreal - GERAD                                               */
+/*    C.P. 6079, Succ. Centre-ville, Montreal (Quebec) H3C 3A7 Canada              */
+/*    e-mail: nomad@gerad.ca                                                       */
+/*    phone : 1-514-340-6053 #6928                                                 */
+/*    fax   : 1-514-340-5665                                                       */
+/*                                                                                 */
+/*  This program is free software: you can redistribute it and/or modify it        */
+/*  under the terms of the GNU Lesser General Public License as published by       */
+/*  the Free Software Foundation, either version 3 of the License, or (at your     */
+/*  option) any later version.                                                     */
+/*                                                                                 */
+/*  This program is distributed in the hope that it will be useful, but WITHOUT    */
+/*  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or          */
+/*  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License    */
+/*  for more details.                                                              */
+/*                                                                                 */
+/*  You should have received a copy of the GNU Lesser General Public License       */
+/*  along with this program. If not, see <http://www.gnu.org/licenses/>.           */
+/*                                                                                 */
+/*  You can find information on the NOMAD software at www.gerad.ca/nomad           */
+/*---------------------------------------------------------------------------------*/
+/**
+ * \file   CacheEviction.hpp
+ * \brief  Choice of the points evicted from a cache that reached its maximum size.
+ * \see    CacheEviction.cpp
+ */
+
+#ifndef __NOMAD400_CACHEEVICTION__
+#define __NOMAD400_CACHEEVICTION__
+
+#include <deque>
+#include <set>
+#include <tuple>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "../Eval/EvalPoint.hpp"
+#include "../Math/Point.hpp"
+#include "../Type/CacheEvictionType.hpp"
+
+#include "../nomad_nsbegin.hpp"
+
+
+/// Eviction queue of the points of a cache.
+/**
+ * The points that can be evicted are kept in an ordered set, the first
+   point being the next to evict following the policy (CacheEvictionType).
+   Evicting k points costs O(k log n): the cache container is not rebuilt.
+ *
+ * Points being evaluated are never evicted: they are added back to the
+   queue by update() once their evaluation is done. Trial points that were
+   not evaluated, typically because of opportunism, are evicted first.
+ *
+ * The keys of the points depend on the policy:
+ * - LRU: last insertion or hit.
+ * - HITS: number of hits, then last insertion or hit.
+ * - F: evaluations without f first, then infeasible points by decreasing h,
+     then feasible points by decreasing f.
+ * - DISTANCE: decreasing distance to a reference point (typically the best
+     point of the cache). The keys are recomputed when the reference point
+     changes, at the next eviction.
+ * Ties are broken with the cache order (EvalPointCompare), so that the
+   evicted points do not depend on memory addresses.
+ *
+ * Counters are kept: number of evicted points, and number of evicted points
+   that were inserted again in the cache afterwards.
+ *
+ * The queue only holds pointers to the EvalPoints owned by the cache. The
+   cache must call the methods of this class for each insertion, hit and
+   update, and erase the evicted points from its container.
+ * This class does not lock anything; the cache is responsible for that.
+ */
+class CacheEviction
+{
+private:
+    /// Key of a point in the queue; lower keys are evicted first.
+    typedef std::tuple<int, double, double> Key;
+
+    /// Information kept for each point of the cache
+    struct Entry
+    {
+        size_t  _nbHits;        ///< Number of cache hits on this point
+        size_t  _lastAccess;    ///< Time of the last insertion or hit
+        bool    _queued;        ///< True if the point is in the queue
+        Key     _key;           ///< Key in the queue, valid if _queued
+    };
+
+    /// Order of the queue
+    struct QueueCompare
+    {
+        bool operator()(const std::pair<Key, const EvalPoint*>& e1,
+                        const std::pair<Key, const EvalPoint*>& e2) const
+        {
+            if (e1.first != e2.first)
+            {
+                return e1.first < e2.first;
+            }
+            return EvalPointCompare()(*e1.second, *e2.second);
+        }
+    };
+
+    typedef std::set<std::pair<Key, const EvalPoint*>, QueueCompare> Queue;
+
+    CacheEvictionType   _type;          ///< The policy
+    std::unordered_map<const EvalPoint*, Entry> _entries;   ///< All points of the cache
+    Queue               _queue;         ///< Points that can be evicted, next to evict first
+    size_t              _time;          ///< Incremented at each insertion or hit
+    Point               _reference;     ///< Reference point for policy DISTANCE
+
+    size_t              _nbEvicted;     ///< Number of evicted points
+    size_t              _nbReinserted;  ///< Number of evicted points inserted again
+
+    /// Hashes of the last evicted points, to detect that they are inserted again.
+    std::unordered_set<size_t>  _evictedHashes;
+    std::deque<size_t>          _evictedOrder;  ///< Same hashes, oldest first
+    size_t                      _maxNbEvictedHashes;
+
+public:
+    /// Constructor
+    /**
+     \param type                The eviction policy                                 -- \b IN.
+     \param maxNbEvictedHashes  Number of evicted points remembered for the counter -- \b IN.
+     */
+    explicit CacheEviction(const CacheEvictionType type = CacheEvictionType::NONE,
+                           const size_t maxNbEvictedHashes = 100000)
+      : _type(type),
+        _entries(),
+        _queue(),
+        _time(0),
+        _reference(),
+        _nbEvicted(0),
+        _nbReinserted(0),
+        _evictedHashes(),
+        _evictedOrder(),
+        _maxNbEvictedHashes(maxNbEvictedHashes)
+    {}
+
+    CacheEvictionType getType() const { return _type; }
+
+    /// Number of points evicted so far
+    size_t getNbEvicted() const { return _nbEvicted; }
+
+    /// Number of evicted points that were inserted again in the cache
+    size_t getNbReinserted() const { return _nbReinserted; }
+
+    /// Number of points that can be evicted
+    size_t getNbEvictable() const { return _queue.size(); }
+
+    /// Forget all points. Counters are kept.
+    void clear();
+
+    /// A point was inserted in the cache.
+    void insert(const EvalPoint* evalPoint);
+
+    /// A point of the cache was hit.
+    void hit(const EvalPoint* evalPoint);
+
+    /// The blackbox Eval of a point of the cache was updated.
+    void update(const EvalPoint* evalPoint);
+
+    /// A point is about to be erased from the cache, not by eviction.
+    void erase(const EvalPoint* evalPoint);
+
+    /// Choose points to evict.
+    /**
+     * The points are removed from the queue and counted as evicted. The cache
+       must then erase them.
+     \param k           The number of points to evict                       -- \b IN.
+     \param reference   Reference point for policy DISTANCE; may be empty   -- \b IN.
+     \param kept        Points that must not be evicted, like the incumbents -- \b IN.
+     \param evicted     The points to erase from the cache                  -- \b OUT.
+     */
+    void evict(const size_t k,
+               const Point& reference,
+               const std::vector<const EvalPoint*>& kept,
+               std::vector<const EvalPoint*>& evicted);
+
+private:
+    /// Compute the key of a point, following the policy.
+    Key computeKey(const EvalPoint* evalPoint, const Entry& entry) const;
+
+    /// Test if a point can be evicted.
+    static bool isEvictable(const EvalPoint* evalPoint);
+
+    /// Put the point in the queue with an updated key, or remove it from the queue.
+    void requeue(const EvalPoint* evalPoint, Entry& entry);
+};
+
+
+#include "../nomad_nsend.hpp"
+
+#endif // __NOMAD400_CACHEEVICTION__
@@ -0,0 +1,211 @@
+/*---------------------------------------------------------------------------------*/
+/*  NOMAD - Nonlinear Optimization by Mesh Adaptive Direct Search -                */
+/*                                                                                 */
+/*  NOMAD - Version 4.0.0 has been created by                                      */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  The copyright of NOMAD - version 4.0.0 is owned by                             */
+/*                 Sebastien Le Digabel        - Polytechnique Montreal            */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  NOMAD v4 has been funded by Rio Tinto, Hydro-Québec, NSERC (Natural Science    */
+/*  and Engineering Research Council of Canada), INOVEE (Innovation en Energie     */
+/*  Electrique and IVADO (The Institute for Data Valorization)                     */
+/*                                                                                 */
+/*  NOMAD v3 was created and developed by Charles Audet, Sebastien Le Digabel,     */
+/*  Christophe Tribes and Viviane Rochon Montplaisir and was funded by AFOSR       */
+/*  and Exxon Mobil.                                                               */
+/*                                                                                 */
+/*  NOMAD v1 and v2 were created and developed by Mark Abramson, Charles Audet,    */
+/*  Gilles Couture, and John E. Dennis Jr., and were funded by AFOSR and           */
+/*  Exxon Mobil.                                                                   */
+/*                                                                                 */
+/*  Contact information:                                                           */
+/*    Polytechnique Montreal - GERAD                                               */
+/*    C.P. 6079, Succ. Centre-ville, Montreal (Quebec) H3C 3A7 Canada              */
+/*    e-mail: nomad@gerad.ca                                                       */
+/*    phone : 1-514-340-6053 #6928                                                 */
+/*    fax   : 1-514-340-5665                                                       */
+/*                                                                                 */
+/*  This program is free software: you can redistribute it and/or modify it        */
+/*  under the terms of the GNU Lesser General Public License as published by       */
+/*  the Free Software Foundation, either version 3 of the License, or (at your     */
+/*  option) any later version.                                                     */
+/*                                                                                 */
+/*  This program is distributed in the hope that it will be useful, but WITHOUT    */
+/*  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or          */
+/*  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License    */
+/*  for more details.                                                              */
+/*                                                                                 */
+/*  You should have received a copy of the GNU Lesser General Public License       */
+/*  along with this program. If not, see <http://www.gnu.org/licenses/>.           */
+/*                                                                                 */
+/*  You can find information on the NOMAD software at www.gerad.ca/nomad           */
+/*---------------------------------------------------------------------------------*/
+/**
+ * \file   CacheIndex.hpp
+ * \brief  Spatial and subproblem indexes on the points of a cache.
+ * \see    CacheIndex.cpp
+ */
+
+#ifndef __NOMAD400_CACHEINDEX__
+#define __NOMAD400_CACHEINDEX__
+
+#include "../Eval/EvalPoint.hpp"
+#include "../Math/Point.hpp"
+
+#include "../nomad_nsbegin.hpp"
+
+
+/// Indexes maintained on the side of the points of a cache.
+/**
+ * Two indexes are maintained incrementally, as points are inserted:
+ * - A k-d tree on the coordinates, for radius and nearest-k queries.
+     Insertion descends the tree and adds a leaf. The tree is rebuilt
+     balanced (median split) each time its size doubles, so that the
+     depth stays logarithmic in amortized time.
+ * - For each fixed variable pattern (subproblem) that was queried, the list
+     of points that belong to the subproblem. A pattern is registered the
+     first time it is queried (with a linear scan), and then kept up to date
+     on each insertion. Only the last MAX_NB_PATTERNS patterns are kept.
+ *
+ * The index only holds pointers to the EvalPoints owned by the cache.
+   Pointers to elements of a std::set or std::unordered_set stay valid
+   until the element is erased, so the cache must call erase() before
+   erasing a point, or rebuild() or clear() after erasing points.
+ * This class does not lock anything; the cache is responsible for that.
+ */
+class CacheIndex
+{
+private:
+    /// Node of the k-d tree
+    struct Node
+    {
+        const EvalPoint*    _evalPoint; ///< Point of the cache; nullptr if it was erased
+        size_t              _dim;       ///< Splitting coordinate
+        double              _split;     ///< Value of coordinate _dim of the point
+        size_t              _left;      ///< Points with coordinate _dim lower or equal
+        size_t              _right;     ///< Points with coordinate _dim greater or equal
+    };
+
+    /// Points of the cache belonging to a subproblem
+    struct Pattern
+    {
+        Point                           _fixedVariable; ///< Defines the subproblem
+        std::vector<const EvalPoint*>   _evalPoints;    ///< Points with these fixed values
+    };
+
+    static const size_t NONE;               ///< No child
+    static const size_t MAX_NB_PATTERNS;    ///< Maximum number of patterns indexed
+
+    size_t              _n;         ///< Dimension of the points
+    std::vector<Node>   _nodes;     ///< The k-d tree; _nodes[_root] is the root
+    size_t              _root;      ///< Index of the root node
+    size_t              _nbBuilt;   ///< Number of nodes at last balanced build
+    size_t              _nbErased;  ///< Number of nodes of erased points
+
+    std::vector<Pattern> _patterns; ///< Indexed subproblems, oldest first
+
+public:
+    /// Constructor
+    explicit CacheIndex()
+      : _n(0),
+        _nodes(),
+        _root(NONE),
+        _nbBuilt(0),
+        _nbErased(0),
+        _patterns()
+    {}
+
+    /// Number of points in the index
+    size_t size() const { return _nodes.size() - _nbErased; }
+
+    /// Remove all points and all patterns.
+    void clear();
+
+    /// Reset the index with the points of the cache.
+    /**
+     * The indexed patterns are kept, their list of points are recomputed.
+     \param cache   The points of the cache  -- \b IN.
+     */
+    void rebuild(const CacheEvalPointSet& cache);
+
+    /// Add a point that was just inserted in the cache.
+    /**
+     \param evalPoint   The point, as held by the cache  -- \b IN.
+     */
+    void insert(const EvalPoint* evalPoint);
+
+    /// Remove a point that is about to be erased from the cache.
+    /**
+     * The node of the point is kept in the k-d tree to split the space,
+       until the next balanced build. The tree is rebuilt when half of the
+       nodes are erased points.
+     * The point is removed from the lists of the patterns.
+     \param evalPoint   The point, as held by the cache  -- \b IN.
+     */
+    void erase(const EvalPoint* evalPoint);
+
+    /// Get all points within a distance of X.
+    /**
+     * Candidates are confirmed using Point::dist(), so the result is the same
+       as a linear scan of the cache.
+     \param X           The point of reference                              -- \b IN.
+     \param distance    The distance to the point of reference              -- \b IN.
+     \param evalPoints  The points within distance of X, in no given order  -- \b OUT.
+     */
+    void findInRadius(const Point& X,
+                      const Double& distance,
+                      std::vector<const EvalPoint*>& evalPoints) const;
+
+    /// Get the k points nearest to X.
+    /**
+     * Ties on the distance are broken using the cache order
+       (EvalPointCompare).
+     \param X           The point of reference                      -- \b IN.
+     \param k           The number of points to find                -- \b IN.
+     \param evalPoints  The nearest points, nearest first           -- \b OUT.
+     */
+    void findNearest(const Point& X,
+                     const size_t k,
+                     std::vector<const EvalPoint*>& evalPoints) const;
+
+    /// Get the points belonging to the subproblem defined by fixedVariable.
+    /**
+     * Register the pattern if it is not already indexed.
+     \param fixedVariable   The subproblem, with defined values for the fixed variables -- \b IN.
+     \param cache           The points of the cache, scanned if the pattern is new      -- \b IN.
+     \return                The points with these fixed values, in insertion order.
+     */
+    const std::vector<const EvalPoint*>& getPattern(const Point& fixedVariable,
+                                                    const CacheEvalPointSet& cache);
+
+    /// Test if it is worth using the pattern index for this fixedVariable.
+    /**
+     \return \c true if at least one variable is fixed, \c false if
+             fixedVariable defines the full space.
+     */
+    static bool isSubproblem(const Point& fixedVariable);
+
+private:
+    /// Build a balanced tree with these points.
+    void buildTree(std::vector<const EvalPoint*>& evalPoints);
+
+    /// Build a balanced subtree with the points in [first, last) at given depth.
+    size_t build(std::vector<const EvalPoint*>::iterator first,
+                 std::vector<const EvalPoint*>::iterator last,
+                 const size_t depth);
+
+    /// Add the point to the lists of the patterns it belongs to.
+    void insertInPatterns(const EvalPoint* evalPoint);
+
+    /// Test if two fixed variable points define the same subproblem.
+    static bool samePattern(const Point& fixedVariable1, const Point& fixedVariable2);
+};
+
+
+#include "../nomad_nsend.hpp"
+
+#endif // __NOMAD400_CACHEINDEX__
@@ -0,0 +1,146 @@
+/*---------------------------------------------------------------------------------*/
+/*  NOMAD - Nonlinear Optimization by Mesh Adaptive Direct Search -                */
+/*                                                                                 */
+/*  NOMAD - Version 4.0.0 has been created by                                      */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  The copyright of NOMAD - version 4.0.0 is owned by                             */
+/*                 Sebastien Le Digabel        - Polytechnique Montreal            */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  NOMAD v4 has been funded by Rio Tinto, Hydro-Québec, NSERC (Natural Science    */
+/*  and Engineering Research Council of Canada), INOVEE (Innovation en Energie     */
+/*  Electrique and IVADO (The Institute for Data Valorization)                     */
+/*                                                                                 */
+/*  NOMAD v3 was created and developed by Charles Audet, Sebastien Le Digabel,     */
+/*  Christophe Tribes and Viviane Rochon Montplaisir and was funded by AFOSR       */
+/*  and Exxon Mobil.                                                               */
+/*                                                                                 */
+/*  NOMAD v1 and v2 were created and developed by Mark Abramson, Charles Audet,    */
+/*  Gilles Couture, and John E. Dennis Jr., and were funded by AFOSR and           */
+/*  Exxon Mobil.                                                                   */
+/*                                                                                 */
+/*  Contact information:                                                           */
+/*    Polytechnique Montreal - GERAD                                               */
+/*    C.P. 6079, Succ. Centre-ville, Montreal (Quebec) H3C 3A7 Canada              */
+/*    e-mail: nomad@gerad.ca                                                       */
+/*    phone : 1-514-340-6053 #6928                                                 */
+/*    fax   : 1-514-340-5665                                                       */
+/*                                                                                 */
+/*  This program is free software: you can redistribute it and/or modify it        */
+/*  under the terms of the GNU Lesser General Public License as published by       */
+/*  the Free Software Foundation, either version 3 of the License, or (at your     */
+/*  option) any later version.                                                     */
+/*                                                                                 */
+/*  This program is distributed in the hope that it will be useful, but WITHOUT    */
+/*  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or          */
+/*  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License    */
+/*  for more details.                                                              */
+/*                                                                                 */
+/*  You should have received a copy of the GNU Lesser General Public License       */
+/*  along with this program. If not, see <http://www.gnu.org/licenses/>.           */
+/*                                                                                 */
+/*  You can find information on the NOMAD software at www.gerad.ca/nomad           */
+/*---------------------------------------------------------------------------------*/
+/**
+ \file   BlackboxWorker.hpp
+ \brief  Persistent blackbox process, fed with blocks of points.
+ \see    BlackboxWorker.cpp
+ */
+
+#ifndef __NOMAD400_BLACKBOXWORKER__
+#define __NOMAD400_BLACKBOXWORKER__
+
+#include <string>
+#include <vector>
+
+#include "../nomad_nsbegin.hpp"
+
+
+/// Long-lived blackbox process, used when BB_EXE_PERSISTENT is true.
+/**
+ * The blackbox executable is launched once, and then evaluates blocks of
+   points sent on its standard input, until its standard input is closed.
+ *
+ * Protocol, for each block:
+ * - NOMAD writes a line with the number of points p of the block, followed
+     by p lines, each one holding the coordinates of a point.
+ * - The blackbox writes p lines on its standard output, each one holding the
+     outputs of a point, in the format of a regular BB_EXE output, and
+     flushes its standard output.
+ *
+ * Lines have no maximum length.
+ *
+ * If the process dies, the points of the block that were not answered are
+   in error, and the process is started again for the next block.
+ *
+ * The standard input and output of the process are the two ends of a
+   socket pair, so that writing to a dead process does not raise SIGPIPE.
+ *
+ * A worker is used by one thread at a time.
+ */
+class BlackboxWorker
+{
+private:
+    std::string _command;   ///< Command executed by the shell
+    int         _pid;       ///< Process id, or -1 if the process is not running
+    int         _fd;        ///< NOMAD end of the socket pair, or -1
+    std::string _buffer;    ///< Data read from the process and not used yet
+    size_t      _nbStarts;  ///< Number of times the process was started
+
+public:
+    /// Constructor
+    /**
+     * The process is started by the first call to evalBlock().
+     \param command     The blackbox command (BB_EXE)   -- \b IN.
+     */
+    explicit BlackboxWorker(const std::string& command)
+      : _command(command),
+        _pid(-1),
+        _fd(-1),
+        _buffer(),
+        _nbStarts(0)
+    {}
+
+    /// Destructor. Stop the process.
+    virtual ~BlackboxWorker();
+
+    BlackboxWorker(const BlackboxWorker&) = delete;
+    BlackboxWorker& operator=(const BlackboxWorker&) = delete;
+
+    /// Number of times the process was started
+    size_t getNbStarts() const { return _nbStarts; }
+
+    /// Evaluate a block of points.
+    /**
+     * Start the process if it is not running.
+     \param inputLines      The coordinates of each point, one line per point  -- \b IN.
+     \param outputLines     The outputs of each point that was answered        -- \b OUT.
+     \return                \c true if all the points were answered, \c false if the process died or could not be started.
+     */
+    bool evalBlock(const std::vector<std::string>& inputLines,
+                   std::vector<std::string>& outputLines);
+
+    /// Close the standard input of the process, and wait for it to exit.
+    void stop();
+
+private:
+    /// Start the process.
+    bool start();
+
+    /// Test if the process is still running. Collect it if it exited.
+    bool isRunning();
+
+    /// Write all the data to the process.
+    bool writeAll(const std::string& data);
+
+    /// Read a line from the process, without its trailing newline.
+    bool readLine(std::string& line);
+};
+
+
+#include "../nomad_nsend.hpp"
+
+#endif // __NOMAD400_BLACKBOXWORKER__
@@ -0,0 +1,153 @@
+/*---------------------------------------------------------------------------------*/
+/*  NOMAD - Nonlinear Optimization by Mesh Adaptive Direct Search -                */
+/*                                                                                 */
+/*  NOMAD - Version 4.0.0 has been created by                                      */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  The copyright of NOMAD - version 4.0.0 is owned by                             */
+/*                 Sebastien Le Digabel        - Polytechnique Montreal            */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  NOMAD v4 has been funded by Rio Tinto, Hydro-Québec, NSERC (Natural Science    */
+/*  and Engineering Research Council of Canada), INOVEE (Innovation en Energie     */
+/*  Electrique and IVADO (The Institute for Data Valorization)                     */
+/*                                                                                 */
+/*  NOMAD v3 was created and developed by Charles Audet, Sebastien Le Digabel,     */
+/*  Christophe Tribes and Viviane Rochon Montplaisir and was funded by AFOSR       */
+/*  and Exxon Mobil.                                                               */
+/*                                                                                 */
+/*  NOMAD v1 and v2 were created and developed by Mark Abramson, Charles Audet,    */
+/*  Gilles Couture, and John E. Dennis Jr., and were funded by AFOSR and           */
+/*  Exxon Mobil.                                                                   */
+/*                                                                                 */
+/*  Contact information:                                                           */
+/*    Polytechnique Montreal - GERAD                                               */
+/*    C.P. 6079, Succ. Centre-ville, Montreal (Quebec) H3C 3A7 Canada              */
+/*    e-mail: nomad@gerad.ca                                                       */
+/*    phone : 1-514-340-6053 #6928                                                 */
+/*    fax   : 1-514-340-5665                                                       */
+/*                                                                                 */
+/*  This program is free software: you can redistribute it and/or modify it        */
+/*  under the terms of the GNU Lesser General Public License as published by       */
+/*  the Free Software Foundation, either version 3 of the License, or (at your     */
+/*  option) any later version.                                                     */
+/*                                                                                 */
+/*  This program is distributed in the hope that it will be useful, but WITHOUT    */
+/*  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or          */
+/*  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License    */
+/*  for more details.                                                              */
+/*                                                                                 */
+/*  You should have received a copy of the GNU Lesser General Public License       */
+/*  along with this program. If not, see <http://www.gnu.org/licenses/>.           */
+/*                                                                                 */
+/*  You can find information on the NOMAD software at www.gerad.ca/nomad           */
+/*---------------------------------------------------------------------------------*/
+/**
+ \file   PointBatch.hpp
+ \brief  Contiguous batch of points of the same dimension
+ \see    PointBatch.cpp
+ */
+
+#ifndef __NOMAD400_POINTBATCH__
+#define __NOMAD400_POINTBATCH__
+
+#include <vector>
+#include "../Math/Point.hpp"
+
+#include "../nomad_nsbegin.hpp"
+
+/// Class for a batch of points of the same dimension, stored contiguously.
+/**
+ The coordinates of the nbPoints points are stored point after point in a
+ single array (nbPoints x n). Used to generate many trial points at once, for
+ instance the 2n points of a poll: the operations are passes over the whole
+ batch, and the Points are only created from the batch when they are needed.
+*/
+class PointBatch
+{
+private:
+    size_t              _n;         ///< Dimension of the points.
+    size_t              _nbPoints;  ///< Number of points.
+    std::vector<Double> _values;    ///< Coordinates of the points, point after point.
+
+public:
+    /*-------------*/
+    /* Constructor */
+    /*-------------*/
+    /**
+     \param nbPoints    Number of points -- \b IN (Opt) (default = 0).
+     \param n           Dimension of the points -- \b IN (Opt) (default = 0).
+     \param val         Initial value for all coordinates -- \b IN (Opt) (default = undefined real).
+     */
+    explicit PointBatch(const size_t nbPoints = 0, const size_t n = 0, const Double& val = Double());
+
+    /*---------*/
+    /* Get/Set */
+    /*---------*/
+    /// Number of points in the batch.
+    size_t size() const { return _nbPoints; }
+
+    /// Dimension of the points.
+    size_t getDimension() const { return _n; }
+
+    /// Coordinates of the point of index k.
+    /**
+     \param k   Index of the point (0 for the first point) -- \b IN.
+     \return    Pointer on the n coordinates of the point.
+     */
+    Double* getCoordinates(size_t k);
+    const Double* getCoordinates(size_t k) const;
+
+    /// Get the point of index k, as a Point.
+    Point getPoint(size_t k) const;
+
+    /// Set the coordinates of the point of index k.
+    /**
+     \param k   Index of the point -- \b IN.
+     \param x   The coordinates, of dimension n -- \b IN.
+     */
+    void setPoint(size_t k, const ArrayOfDouble& x);
+
+    /*---------------*/
+    /* Class methods */
+    /*---------------*/
+    /// Add \c x to all the points. For instance, x is the poll center and the points are directions.
+    void add(const ArrayOfDouble& x);
+
+    /// Snap all the points to the bounds.
+    /**
+     Same as ArrayOfDouble::snapToBounds() for each point.
+     \param lowerBound      The lower bounds -- \b IN.
+     \param upperBound      The upper bounds -- \b IN.
+     \param frameCenter     The frame center -- \b IN.
+     \param deltaMeshSize   The mesh size, used to snap the points on the mesh -- \b IN.
+     */
+    void snapToBounds(const ArrayOfDouble& lowerBound,
+                      const ArrayOfDouble& upperBound,
+                      const ArrayOfDouble& frameCenter,
+                      const ArrayOfDouble& deltaMeshSize);
+
+    /// Remove the points that are equal to \c x (ArrayOfDouble::operator==).
+    /**
+     \return The number of points removed.
+     */
+    size_t removePoint(const ArrayOfDouble& x);
+
+    /// Remove the points that are equal to a previous point of the batch.
+    /**
+     The equality is Point::weakEqual(), as in an EvalPointSet. The first
+     point of each group of equal points is kept.
+     \return The number of points removed.
+     */
+    size_t removeDuplicates();
+
+private:
+    /// Remove the points for which keep is \c false. The order of the other points is kept.
+    void compact(const std::vector<bool>& keep);
+};
+
+
+#include "../nomad_nsend.hpp"
+#endif // __NOMAD400_POINTBATCH__
@@ -0,0 +1,107 @@
+/*---------------------------------------------------------------------------------*/
+/*  NOMAD - Nonlinear Optimization by Mesh Adaptive Direct Search -                */
+/*                                                                                 */
+/*  NOMAD - Version 4.0.0 has been created by                                      */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  The copyright of NOMAD - version 4.0.0 is owned by                             */
+/*                 Sebastien Le Digabel        - Polytechnique Montreal            */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  NOMAD v4 has been funded by Rio Tinto, Hydro-Québec, NSERC (Natural Science    */
+/*  and Engineering Research Council of Canada), INOVEE (Innovation en Energie     */
+/*  Electrique and IVADO (The Institute for Data Valorization)                     */
+/*                                                                                 */
+/*  NOMAD v3 was created and developed by Charles Audet, Sebastien Le Digabel,     */
+/*  Christophe Tribes and Viviane Rochon Montplaisir and was funded by AFOSR       */
+/*  and Exxon Mobil.                                                               */
+/*                                                                                 */
+/*  NOMAD v1 and v2 were created and developed by Mark Abramson, Charles Audet,    */
+/*  Gilles Couture, and John E. Dennis Jr., and were funded by AFOSR and           */
+/*  Exxon Mobil.                                                                   */
+/*                                                                                 */
+/*  Contact information:                                                           */
+/*    Polytechnique Montreal - GERAD                                               */
+/*    C.P. 6079, Succ. Centre-ville, Montreal (Quebec) H3C 3A7 Canada              */
+/*    e-mail: nomad@gerad.ca                                                       */
+/*    phone : 1-514-340-6053 #6928                                                 */
+/*    fax   : 1-514-340-5665                                                       */
+/*                                                                                 */
+/*  This program is free software: you can redistribute it and/or modify it        */
+/*  under the terms of the GNU Lesser General Public License as published by       */
+/*  the Free Software Foundation, either version 3 of the License, or (at your     */
+/*  option) any later version.                                                     */
+/*                                                                                 */
+/*  This program is distributed in the hope that it will be useful, but WITHOUT    */
+/*  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or          */
+/*  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License    */
+/*  for more details.                                                              */
+/*                                                                                 */
+/*  You should have received a copy of the GNU Lesser General Public License       */
+/*  along with this program. If not, see <http://www.gnu.org/licenses/>.           */
+/*                                                                                 */
+/*  You can find information on the NOMAD software at www.gerad.ca/nomad           */
+/*---------------------------------------------------------------------------------*/
+/**
+ \file   CacheEvictionType.hpp
+ \brief  Types for parameter CACHE_EVICTION
+ \see    CacheEviction.hpp
+ */
+#ifndef __NOMAD400_CACHE_EVICTION_TYPE__
+#define __NOMAD400_CACHE_EVICTION_TYPE__
+
+#include <string>
+#include <sstream>
+
+#include "../nomad_nsbegin.hpp"
+
+// Policies to choose the points evicted from a cache that reached MAX_CACHE_SIZE
+enum class CacheEvictionType
+{
+    NONE        , /// No eviction
+    LRU         , /// Least recently inserted or hit points first
+    HITS        , /// Points with the fewest cache hits first, least recent first on ties
+    F           , /// Failed evaluations, then infeasible points by decreasing h, then feasible points by decreasing f
+    DISTANCE      /// Points farthest from the best point first
+};
+
+
+// Convert a string (ex "NONE", "LRU", "F"...)
+// to a CacheEvictionType.
+CacheEvictionType stringToCacheEvictionType(const std::string &s);
+
+std::string CacheEvictionTypeToString(const CacheEvictionType &cet);
+
+inline std::ostream& operator<<(std::ostream& os, const CacheEvictionType &cet)
+{
+    switch (cet)
+    {
+        case CacheEvictionType::NONE:
+            os << "NONE";
+            break;
+        case CacheEvictionType::LRU:
+            os << "LRU";
+            break;
+        case CacheEvictionType::HITS:
+            os << "HITS";
+            break;
+        case CacheEvictionType::F:
+            os << "F";
+            break;
+        case CacheEvictionType::DISTANCE:
+            os << "DISTANCE";
+            break;
+        default:
+            return os << "UNDEFINED";
+            break;
+    }
+
+    return os;
+}
+
+
+#include "../nomad_nsend.hpp"
+
+#endif // __NOMAD400_CACHE_EVICTION_TYPE__
@@ -0,0 +1,161 @@
+/*---------------------------------------------------------------------------------*/
+/*  NOMAD - Nonlinear Optimization by Mesh Adaptive Direct Search -                */
+/*                                                                                 */
+/*  NOMAD - Version 4.0.0 has been created by                                      */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  The copyright of NOMAD - version 4.0.0 is owned by                             */
+/*                 Sebastien Le Digabel        - Polytechnique Montreal            */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  NOMAD v4 has been funded by Rio Tinto, Hydro-Québec, NSERC (Natural Science    */
+/*  and Engineering Research Council of Canada), INOVEE (Innovation en Energie     */
+/*  Electrique and IVADO (The Institute for Data Valorization)                     */
+/*                                                                                 */
+/*  NOMAD v3 was created and developed by Charles Audet, Sebastien Le Digabel,     */
+/*  Christophe Tribes and Viviane Rochon Montplaisir and was funded by AFOSR       */
+/*  and Exxon Mobil.                                                               */
+/*                                                                                 */
+/*  NOMAD v1 and v2 were created and developed by Mark Abramson, Charles Audet,    */
+/*  Gilles Couture, and John E. Dennis Jr., and were funded by AFOSR and           */
+/*  Exxon Mobil.                                                                   */
+/*                                                                                 */
+/*  Contact information:                                                           */
+/*    Polytechnique Montreal - GERAD                                               */
+/*    C.P. 6079, Succ. Centre-ville, Montreal (Quebec) H3C 3A7 Canada              */
+/*    e-mail: nomad@gerad.ca                                                       */
+/*    phone : 1-514-340-6053 #6928                                                 */
+/*    fax   : 1-514-340-5665                                                       */
+/*                                                                                 */
+/*  This program is free software: you can redistribute it and/or modify it        */
+/*  under the terms of the GNU Lesser General Public License as published by       */
+/*  the Free Software Foundation, either version 3 of the License, or (at your     */
+/*  option) any later version.                                                     */
+/*                                                                                 */
+/*  This program is distributed in the hope that it will be useful, but WITHOUT    */
+/*  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or          */
+/*  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License    */
+/*  for more details.                                                              */
+/*                                                                                 */
+/*  You should have received a copy of the GNU Lesser General Public License       */
+/*  along with this program. If not, see <http://www.gnu.org/licenses/>.           */
+/*                                                                                 */
+/*  You can find information on the NOMAD software at www.gerad.ca/nomad           */
+/*---------------------------------------------------------------------------------*/
+/*-------------------------------------------------------------------------------------*/
+/*  sgtelib - A surrogate model library for derivative-free optimization               */
+/*  Version 2.0.2                                                                      */
+/*                                                                                     */
+/*  Copyright (C) 2012-2017  Sebastien Le Digabel - Ecole Polytechnique, Montreal      */
+/*                           Bastien Talgorn - McGill University, Montreal             */
+/*                                                                                     */
+/*  Author: Bastien Talgorn                                                            */
+/*  email: bastientalgorn@fastmail.com                                                 */
+/*                                                                                     */
+/*  This program is free software: you can redistribute it and/or modify it under the  */
+/*  terms of the GNU Lesser General Public License as published by the Free Software   */
+/*  Foundation, either version 3 of the License, or (at your option) any later         */
+/*  version.                                                                           */
+/*                                                                                     */
+/*  This program is distributed in the hope that it will be useful, but WITHOUT ANY    */
+/*  WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A    */
+/*  PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.   */
+/*                                                                                     */
+/*  You should have received a copy of the GNU Lesser General Public License along     */
+/*  with this program. If not, see <http://www.gnu.org/licenses/>.                     */
+/*                                                                                     */
+/*  You can find information on sgtelib at https://github.com/bastientalgorn/sgtelib   */
+/*-------------------------------------------------------------------------------------*/
+
+#ifndef __SGTELIB_SERVER_SOCKET__
+#define __SGTELIB_SERVER_SOCKET__
+
+#include "Defines.hpp"
+#include "Exception.hpp"
+#include "Matrix.hpp"
+#include <string>
+#include <vector>
+
+// Transport of the sgtelib server on a Unix-domain socket
+// (sgtelib.exe -server -socket <path>).
+// Each request and each answer is one binary message:
+//   int32 magic, int32 code, int32 text length, int32 number of matrices,
+//   the text, then for each matrix:
+//   int32 rows, int32 cols, rows*cols doubles (row major).
+// The integers and doubles are in the native byte order (the socket is local).
+
+namespace SGTELIB {
+
+  // Requests of a client
+  enum server_request_t {
+    SERVER_NEW_DATA , // X, Z     -> -
+    SERVER_PREDICT  , // XX       -> ZZ, std, ei, cdf
+    SERVER_CV       , // -        -> Zh, Sh, Zv, Sv
+    SERVER_METRIC   , // (metric) -> metric value for each output
+    SERVER_INFO     , // -        -> (description of the model)
+    SERVER_RESET    , // -        -> -
+    SERVER_PING     , // -        -> -
+    SERVER_QUIT       // -        -> -
+  };
+
+  // Status in the answer of the server
+  enum server_status_t {
+    SERVER_READY     , // The model is ready
+    SERVER_NOT_READY , // The model is not ready (the predictions are +INF)
+    SERVER_ERROR       // The request failed (the text is the error message)
+  };
+
+  // Message exchanged between the server and a client
+  class DLL_API Server_Message {
+  public:
+    int code; // server_request_t or server_status_t
+    std::string text;
+    std::vector<SGTELIB::Matrix> matrices;
+    Server_Message ( const int c = 0 ) : code(c) {};
+  };
+
+  // Send / receive a message on a connected socket.
+  // Return false if the connection is closed.
+  DLL_API bool server_send    ( const int fd , const SGTELIB::Server_Message & msg );
+  DLL_API bool server_receive ( const int fd ,       SGTELIB::Server_Message & msg );
+
+  // Server side: socket listening on path, connection of the next client
+  // (-1 if the listening socket is closed), and close.
+  DLL_API int  server_listen ( const std::string & path );
+  DLL_API int  server_accept ( const int listen_fd );
+  DLL_API void server_close  ( const int fd );
+  DLL_API void server_close  ( const int listen_fd , const std::string & path );
+
+  // Client of a sgtelib server started with -socket.
+  // The methods that return a bool return true if the model is ready.
+  class DLL_API Server_Client {
+  private:
+    int _fd;
+    SGTELIB::Server_Message request ( const SGTELIB::Server_Message & msg );
+    // No copy (the client owns the connection)
+    Server_Client ( const Server_Client & );
+    Server_Client & operator = ( const Server_Client & );
+  public:
+    explicit Server_Client ( const std::string & path );
+    virtual ~Server_Client ( void );
+
+    void new_data ( const SGTELIB::Matrix & X , const SGTELIB::Matrix & Z );
+    bool predict  ( const SGTELIB::Matrix & XX ,
+                          SGTELIB::Matrix & ZZ ,
+                          SGTELIB::Matrix & std ,
+                          SGTELIB::Matrix & ei ,
+                          SGTELIB::Matrix & cdf );
+    bool cv       ( SGTELIB::Matrix & Zh , SGTELIB::Matrix & Sh ,
+                    SGTELIB::Matrix & Zv , SGTELIB::Matrix & Sv );
+    bool metric   ( const std::string & metric , SGTELIB::Matrix & value );
+    bool info     ( std::string & description );
+    bool ping     ( void );
+    void reset    ( void );
+    void quit     ( void );
+  };
+
+}
+
+#endif
@@ -0,0 +1,122 @@
+/*---------------------------------------------------------------------------------*/
+/*  NOMAD - Nonlinear Optimization by Mesh Adaptive Direct Search -                */
+/*                                                                                 */
+/*  NOMAD - Version 4.0.0 has been created by                                      */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  The copyright of NOMAD - version 4.0.0 is owned by                             */
+/*                 Sebastien Le Digabel        - Polytechnique Montreal            */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  NOMAD v4 has been funded by Rio Tinto, Hydro-Québec, NSERC (Natural Science    */
+/*  and Engineering Research Council of Canada), INOVEE (Innovation en Energie     */
+/*  Electrique and IVADO (The Institute for Data Valorization)                     */
+/*                                                                                 */
+/*  NOMAD v3 was created and developed by Charles Audet, Sebastien Le Digabel,     */
+/*  Christophe Tribes and Viviane Rochon Montplaisir and was funded by AFOSR       */
+/*  and Exxon Mobil.                                                               */
+/*                                                                                 */
+/*  NOMAD v1 and v2 were created and developed by Mark Abramson, Charles Audet,    */
+/*  Gilles Couture, and John E. Dennis Jr., and were funded by AFOSR and           */
+/*  Exxon Mobil.                                                                   */
+/*                                                                                 */
+/*  Contact information:                                                           */
+/*    Polytechnique Montreal - GERAD                                               */
+/*    C.P. 6079, Succ. Centre-ville, Montreal (Quebec) H3C 3A7 Canada              */
+/*    e-mail: nomad@gerad.ca                                                       */
+/*    phone : 1-514-340-6053 #6928                                                 */
+/*    fax   : 1-514-340-5665                                                       */
+/*                                                                                 */
+/*  This program is free software: you can redistribute it and/or modify it        */
+/*  under the terms of the GNU Lesser General Public License as published by       */
+/*  the Free Software Foundation, either version 3 of the License, or (at your     */
+/*  option) any later version.                                                     */
+/*                                                                                 */
+/*  This program is distributed in the hope that it will be useful, but WITHOUT    */
+/*  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or          */
+/*  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License    */
+/*  for more details.                                                              */
+/*                                                                                 */
+/*  You should have received a copy of the GNU Lesser General Public License       */
+/*  along with this program. If not, see <http://www.gnu.org/licenses/>.           */
+/*                                                                                 */
+/*  You can find information on the NOMAD software at www.gerad.ca/nomad           */
+/*---------------------------------------------------------------------------------*/
+#include <iostream>
+#include <cmath>        // For sqrt
+#include <string>
+
+// Same problem as examples/basic/batch/example1, for BB_EXE_PERSISTENT.
+// The blackbox is launched once. For each block, it reads the number of
+// points, then the points, on its standard input, and writes one line of
+// outputs for each point. It exits when its standard input is closed.
+
+const int n = 10;
+
+static void eval(const double x[n], double &f, double &g1, double &g2, double &g3)
+{
+    double sum1 = 0.0, sum2 = 0.0, sum3 = 0.0, prod1 = 1.0, prod2 = 1.0;
+    for (int i = 0; i < n ; i++)
+    {
+        sum1  += pow(cos(x[i]), 4);
+        sum2  += x[i];
+        sum3  += (i+1)*x[i]*x[i];
+        prod1 *= pow(cos(x[i]), 2);
+        if (prod2 != 0.0)
+        {
+            if (x[i] == 0.0)
+            {
+                prod2 = 0.0;
+            }
+            else
+            {
+                prod2 *= x[i];
+            }
+        }
+    }
+
+    g1 = -prod2 + 0.75;
+    g2 = sum2 -7.5 * n;
+
+    f = 10*g1 + 10*g2;
+    if (0.0 != sum3)
+    {
+        f -= (sum1 -2*prod1) / std::abs(sqrt(sum3));
+    }
+    // Scale
+    f *= 1e-5;
+
+    g3 = - (f + 2000);
+}
+
+
+int main (int argc, char **argv)
+{
+    size_t nbPoints = 0;
+    while (std::cin >> nbPoints)
+    {
+        for (size_t p = 0; p < nbPoints; p++)
+        {
+            double x[n];
+            for (int i = 0; i < n; i++)
+            {
+                std::cin >> x[i];
+            }
+            if (std::cin.fail())
+            {
+                std::cerr << "Error reading point " << p << std::endl;
+                return 1;
+            }
+
+            double f, g1, g2, g3;
+            eval(x, f, g1, g2, g3);
+            std::cout << f << " " << g1 << " " << g2 << " " << g3 << "\n";
+        }
+        // NOMAD waits for the outputs of the whole block.
+        std::cout.flush();
+    }
+
+    return 0;
+}
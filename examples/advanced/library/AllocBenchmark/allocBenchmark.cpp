@@ -0,0 +1,176 @@
+/*---------------------------------------------------------------------------------*/
+/*  NOMAD - Nonlinear Optimization by Mesh Adaptive Direct Search -                */
+/*                                                                                 */
+/*  NOMAD - Version 4.0.0 has been created by                                      */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  The copyright of NOMAD - version 4.0.0 is owned by                             */
+/*                 Sebastien Le Digabel        - Polytechnique Montreal            */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  NOMAD v4 has been funded by Rio Tinto, Hydro-Québec, NSERC (Natural Science    */
+/*  and Engineering Research Council of Canada), INOVEE (Innovation en Energie     */
+/*  Electrique and IVADO (The Institute for Data Valorization)                     */
+/*                                                                                 */
+/*  NOMAD v3 was created and developed by Charles Audet, Sebastien Le Digabel,     */
+/*  Christophe Tribes and Viviane Rochon Montplaisir and was funded by AFOSR       */
+/*  and Exxon Mobil.                                                               */
+/*                                                                                 */
+/*  NOMAD v1 and v2 were created and developed by Mark Abramson, Charles Audet,    */
+/*  Gilles Couture, and John E. Dennis Jr., and were funded by AFOSR and           */
+/*  Exxon Mobil.                                                                   */
+/*                                                                                 */
+/*  Contact information:                                                           */
+/*    Polytechnique Montreal - GERAD                                               */
+/*    C.P. 6079, Succ. Centre-ville, Montreal (Quebec) H3C 3A7 Canada              */
+/*    e-mail: nomad@gerad.ca                                                       */
+/*    phone : 1-514-340-6053 #6928                                                 */
+/*    fax   : 1-514-340-5665                                                       */
+/*                                                                                 */
+/*  This program is free software: you can redistribute it and/or modify it        */
+/*  under the terms of the GNU Lesser General Public License as published by       */
+/*  the Free Software Foundation, either version 3 of the License, or (at your     */
+/*  option) any later version.                                                     */
+/*                                                                                 */
+/*  This program is distributed in the hope that it will be useful, but WITHOUT    */
+/*  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or          */
+/*  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License    */
+/*  for more details.                                                              */
+/*                                                                                 */
+/*  You should have received a copy of the GNU Lesser General Public License       */
+/*  along with this program. If not, see <http://www.gnu.org/licenses/>.           */
+/*                                                                                 */
+/*  You can find information on the NOMAD software at www.gerad.ca/nomad           */
+/*--------------------------------------------------------------------------*/
+/*  Count of the heap allocations of MADS poll steps.                       */
+/*                                                                          */
+/*  Usage: allocBenchmark.exe [DIMENSION [NB_ITERATIONS]]                   */
+/*                                                                          */
+/*  Only the classical (Ortho 2n) poll is enabled, with no search and no    */
+/*  opportunism, so that each iteration is a single poll step of 2n trial   */
+/*  points. The global operator new is replaced to count the allocations.   */
+/*  See runBenchmark.sh.                                                    */
+/*--------------------------------------------------------------------------*/
+#include "Nomad/nomad.hpp"
+#include "Algos/MainStep.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+static std::atomic<size_t> nbAllocations(0);
+
+void* operator new(size_t size)
+{
+    nbAllocations++;
+    void* p = std::malloc(size ? size : 1);
+    if (nullptr == p)
+    {
+        throw std::bad_alloc();
+    }
+    return p;
+}
+
+void* operator new[](size_t size)
+{
+    return operator new(size);
+}
+
+void operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete[](void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* p, size_t) noexcept
+{
+    std::free(p);
+}
+
+void operator delete[](void* p, size_t) noexcept
+{
+    std::free(p);
+}
+
+
+// Rosenbrock function, slow to converge, so that all the iterations are done.
+class Rosenbrock_Evaluator : public NOMAD::Evaluator
+{
+public:
+    Rosenbrock_Evaluator(const std::shared_ptr<NOMAD::EvalParameters>& evalParams)
+    : NOMAD::Evaluator(evalParams, NOMAD::EvalType::BB)
+    {}
+
+    ~Rosenbrock_Evaluator() {}
+
+    bool eval_x(NOMAD::EvalPoint &x, const NOMAD::Double &hMax, bool &countEval) const override
+    {
+        NOMAD::Double f = 0.0;
+        for (size_t i = 0; i + 1 < x.size(); i++)
+        {
+            NOMAD::Double a = x[i+1] - x[i] * x[i];
+            NOMAD::Double b = 1.0 - x[i];
+            f += 100.0 * a * a + b * b;
+        }
+
+        auto bbOutputType = _evalParams->getAttributeValue<NOMAD::BBOutputTypeList>("BB_OUTPUT_TYPE");
+        x.setBBO(f.tostring(), bbOutputType, getEvalType());
+
+        countEval = true;
+        return true;
+    }
+};
+
+
+int main(int argc, char ** argv)
+{
+    size_t n = (argc > 1) ? std::stoul(argv[1]) : 10;
+    size_t nbIterations = (argc > 2) ? std::stoul(argv[2]) : 100;
+
+    NOMAD::BBOutputTypeList bbOutputType;
+    bbOutputType.push_back(NOMAD::BBOutputType::OBJ);
+
+    auto allParams = std::make_shared<NOMAD::AllParameters>();
+    allParams->setAttributeValue("DIMENSION", n);
+    allParams->setAttributeValue("X0", NOMAD::Point(n, -1.2));
+    allParams->setAttributeValue("BB_OUTPUT_TYPE", bbOutputType);
+    allParams->setAttributeValue("MAX_ITERATIONS", nbIterations);
+    allParams->setAttributeValue("NB_THREADS_OPENMP", 1);
+    allParams->setAttributeValue("OPPORTUNISTIC_EVAL", false);
+    allParams->setAttributeValue("NM_SEARCH", false);
+    allParams->setAttributeValue("SPECULATIVE_SEARCH", false);
+    allParams->setAttributeValue("DISPLAY_DEGREE", 0);
+    allParams->checkAndComply();
+
+    NOMAD::MainStep TheMainStep;
+    TheMainStep.setAllParameters(allParams);
+    std::unique_ptr<Rosenbrock_Evaluator> ev(new Rosenbrock_Evaluator(allParams->getEvalParams()));
+    TheMainStep.setEvaluator(std::move(ev));
+
+    size_t nbAllocationsRun = 0;
+    try
+    {
+        nbAllocations = 0;
+        TheMainStep.start();
+        TheMainStep.run();
+        TheMainStep.end();
+        nbAllocationsRun = nbAllocations;
+    }
+    catch (std::exception &e)
+    {
+        std::cerr << "\nNOMAD has been interrupted (" << e.what() << ")\n\n";
+        return EXIT_FAILURE;
+    }
+
+    size_t bbEval = NOMAD::EvcInterface::getEvaluatorControl()->getBbEval();
+    std::cout << n << "\t" << nbIterations << "\t\t" << bbEval << "\t\t";
+    std::cout << nbAllocationsRun << "\t\t" << nbAllocationsRun / nbIterations << std::endl;
+
+    return EXIT_SUCCESS;
+}
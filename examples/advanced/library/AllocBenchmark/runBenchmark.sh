@@ -0,0 +1,9 @@
+#!/bin/bash
+# Heap allocations per poll step (one MADS iteration with the
+# classical poll only) for dimensions 2 to 40.
+make
+echo -e "n\titerations\tbb evals\tallocations\tallocations/poll step"
+for n in 2 5 8 10 20 40
+do
+    ./allocBenchmark.exe $n
+done
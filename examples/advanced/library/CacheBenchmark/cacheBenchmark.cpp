@@ -0,0 +1,154 @@
+/*---------------------------------------------------------------------------------*/
+/*  NOMAD - Nonlinear Optimization by Mesh Adaptive Direct Search -                */
+/*                                                                                 */
+/*  NOMAD - Version 4.0.0 has been created by                                      */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  The copyright of NOMAD - version 4.0.0 is owned by                             */
+/*                 Sebastien Le Digabel        - Polytechnique Montreal            */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  NOMAD v4 has been funded by Rio Tinto, Hydro-Québec, NSERC (Natural Science    */
+/*  and Engineering Research Council of Canada), INOVEE (Innovation en Energie     */
+/*  Electrique and IVADO (The Institute for Data Valorization)                     */
+/*                                                                                 */
+/*  NOMAD v3 was created and developed by Charles Audet, Sebastien Le Digabel,     */
+/*  Christophe Tribes and Viviane Rochon Montplaisir and was funded by AFOSR       */
+/*  and Exxon Mobil.                                                               */
+/*                                                                                 */
+/*  NOMAD v1 and v2 were created and developed by Mark Abramson, Charles Audet,    */
+/*  Gilles Couture, and John E. Dennis Jr., and were funded by AFOSR and           */
+/*  Exxon Mobil.                                                                   */
+/*                                                                                 */
+/*  Contact information:                                                           */
+/*    Polytechnique Montreal - GERAD                                               */
+/*    C.P. 6079, Succ. Centre-ville, Montreal (Quebec) H3C 3A7 Canada              */
+/*    e-mail: nomad@gerad.ca                                                       */
+/*    phone : 1-514-340-6053 #6928                                                 */
+/*    fax   : 1-514-340-5665                                                       */
+/*                                                                                 */
+/*  This program is free software: you can redistribute it and/or modify it        */
+/*  under the terms of the GNU Lesser General Public License as published by       */
+/*  the Free Software Foundation, either version 3 of the License, or (at your     */
+/*  option) any later version.                                                     */
+/*                                                                                 */
+/*  This program is distributed in the hope that it will be useful, but WITHOUT    */
+/*  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or          */
+/*  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License    */
+/*  for more details.                                                              */
+/*                                                                                 */
+/*  You should have received a copy of the GNU Lesser General Public License       */
+/*  along with this program. If not, see <http://www.gnu.org/licenses/>.           */
+/*                                                                                 */
+/*  You can find information on the NOMAD software at www.gerad.ca/nomad           */
+/*---------------------------------------------------------------------------------*/
+/*--------------------------------------------------------------------------*/
+/*  Micro benchmark of concurrent inserts and finds in the cache.           */
+/*                                                                          */
+/*  Usage: cacheBenchmark.exe [CACHE_NB_SHARDS [NB_OPS_PER_THREAD]]         */
+/*                                                                          */
+/*  The cache is a singleton, so a single cache type is measured per run.   */
+/*  With CACHE_NB_SHARDS 1, the cache is a CacheSet (single lock).          */
+/*  Otherwise, it is a CacheShardedSet. See runBenchmark.sh.                */
+/*--------------------------------------------------------------------------*/
+#include "Nomad/nomad.hpp"
+
+#include <random>
+
+// Each thread generates points on a small lattice, so that some points are
+// generated more than once (cache hits), like in a real optimization.
+void threadWork(const size_t nbOps,
+                const size_t n,
+                const unsigned int seed,
+                const NOMAD::BBOutputTypeList& bbOutputType)
+{
+    auto cache = NOMAD::CacheBase::getInstance().get();
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<int> coord(-50, 50);
+
+    for (size_t op = 0; op < nbOps; op++)
+    {
+        NOMAD::Point x(n);
+        for (size_t i = 0; i < n; i++)
+        {
+            x[i] = 0.1 * coord(gen);
+        }
+
+        // Insert, then evaluate and update, the way EvaluatorControl does.
+        NOMAD::EvalPoint evalPoint(x);
+        if (cache->smartInsert(evalPoint, 1, NOMAD::EvalType::BB))
+        {
+            evalPoint.setBBO(x[0].tostring(), bbOutputType, NOMAD::EvalType::BB);
+            evalPoint.setEvalStatus(NOMAD::EvalStatusType::EVAL_OK, NOMAD::EvalType::BB);
+            evalPoint.setNumberEval(1);
+            cache->update(evalPoint, NOMAD::EvalType::BB);
+        }
+
+        // Look for a point generated by any thread.
+        NOMAD::EvalPoint foundEvalPoint;
+        cache->find(x, foundEvalPoint);
+    }
+}
+
+
+int main(int argc, char ** argv)
+{
+    size_t nbShards = (argc > 1) ? std::stoul(argv[1]) : 1;
+    size_t nbOpsPerThread = (argc > 2) ? std::stoul(argv[2]) : 20000;
+    const size_t n = 10;
+
+    NOMAD::OutputQueue::getInstance()->setDisplayDegree(0);
+
+    NOMAD::BBOutputTypeList bbOutputType;
+    bbOutputType.push_back(NOMAD::BBOutputType::OBJ);
+
+    auto allParams = std::make_shared<NOMAD::AllParameters>();
+    allParams->setAttributeValue("DIMENSION", n);
+    allParams->setAttributeValue("X0", NOMAD::Point(n, 0.0));
+    allParams->setAttributeValue("BB_OUTPUT_TYPE", bbOutputType);
+    allParams->setAttributeValue("CACHE_NB_SHARDS", nbShards);
+    allParams->checkAndComply();
+    auto cacheParams = allParams->getCacheParams();
+    if (nbShards > 1)
+    {
+        NOMAD::CacheShardedSet::setInstance(cacheParams, bbOutputType);
+    }
+    else
+    {
+        NOMAD::CacheSet::setInstance(cacheParams, bbOutputType);
+    }
+
+    std::cout << "CACHE_NB_SHARDS " << nbShards << ", " << nbOpsPerThread << " operations per thread" << std::endl;
+    std::cout << "threads\ttime (s)\tops/s\t\tcache size" << std::endl;
+
+    const int allNbThreads[] = {1, 8, 32, 64};
+    for (int nbThreads : allNbThreads)
+    {
+        NOMAD::CacheBase::getInstance()->clear();
+
+#ifdef _OPENMP
+        double start = omp_get_wtime();
+        #pragma omp parallel num_threads(nbThreads)
+        {
+            threadWork(nbOpsPerThread, n, 1 + omp_get_thread_num(), bbOutputType);
+        }
+        double elapsed = omp_get_wtime() - start;
+#else
+        // Without OpenMP, the "threads" are run one after the other.
+        NOMAD::Clock::reset();
+        for (int t = 0; t < nbThreads; t++)
+        {
+            threadWork(nbOpsPerThread, n, 1 + t, bbOutputType);
+        }
+        double elapsed = NOMAD::Clock::getCPUTime();
+#endif // _OPENMP
+
+        std::cout << nbThreads << "\t" << elapsed << "\t\t";
+        std::cout << (size_t)(nbThreads * nbOpsPerThread / elapsed) << "\t\t";
+        std::cout << NOMAD::CacheBase::getInstance()->size() << std::endl;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,9 @@
+#!/bin/bash
+# Compare the single lock cache (CacheSet) to the sharded cache
+# (CacheShardedSet) with 1, 8, 32 and 64 threads.
+make
+for nbShards in 1 64
+do
+    ./cacheBenchmark.exe $nbShards
+    echo
+done
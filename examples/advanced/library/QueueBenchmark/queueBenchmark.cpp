@@ -0,0 +1,142 @@
+/*---------------------------------------------------------------------------------*/
+/*  NOMAD - Nonlinear Optimization by Mesh Adaptive Direct Search -                */
+/*                                                                                 */
+/*  NOMAD - Version 4.0.0 has been created by                                      */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  The copyright of NOMAD - version 4.0.0 is owned by                             */
+/*                 Sebastien Le Digabel        - Polytechnique Montreal            */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  NOMAD v4 has been funded by Rio Tinto, Hydro-Québec, NSERC (Natural Science    */
+/*  and Engineering Research Council of Canada), INOVEE (Innovation en Energie     */
+/*  Electrique and IVADO (The Institute for Data Valorization)                     */
+/*                                                                                 */
+/*  NOMAD v3 was created and developed by Charles Audet, Sebastien Le Digabel,     */
+/*  Christophe Tribes and Viviane Rochon Montplaisir and was funded by AFOSR       */
+/*  and Exxon Mobil.                                                               */
+/*                                                                                 */
+/*  NOMAD v1 and v2 were created and developed by Mark Abramson, Charles Audet,    */
+/*  Gilles Couture, and John E. Dennis Jr., and were funded by AFOSR and           */
+/*  Exxon Mobil.                                                                   */
+/*                                                                                 */
+/*  Contact information:                                                           */
+/*    Polytechnique Montreal - GERAD                                               */
+/*    C.P. 6079, Succ. Centre-ville, Montreal (Quebec) H3C 3A7 Canada              */
+/*    e-mail: nomad@gerad.ca                                                       */
+/*    phone : 1-514-340-6053 #6928                                                 */
+/*    fax   : 1-514-340-5665                                                       */
+/*                                                                                 */
+/*  This program is free software: you can redistribute it and/or modify it        */
+/*  under the terms of the GNU Lesser General Public License as published by       */
+/*  the Free Software Foundation, either version 3 of the License, or (at your     */
+/*  option) any later version.                                                     */
+/*                                                                                 */
+/*  This program is distributed in the hope that it will be useful, but WITHOUT    */
+/*  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or          */
+/*  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License    */
+/*  for more details.                                                              */
+/*                                                                                 */
+/*  You should have received a copy of the GNU Lesser General Public License       */
+/*  along with this program. If not, see <http://www.gnu.org/licenses/>.           */
+/*                                                                                 */
+/*  You can find information on the NOMAD software at www.gerad.ca/nomad           */
+/*---------------------------------------------------------------------------------*/
+/*--------------------------------------------------------------------------*/
+/*  Micro benchmark of the EvaluatorControl queue.                          */
+/*                                                                          */
+/*  Usage: queueBenchmark.exe [NB_THREADS_OPENMP [NB_POINTS]]               */
+/*                                                                          */
+/*  NB_POINTS Latin Hypercube points are put in the queue at once and       */
+/*  evaluated by a trivial blackbox, so that the time is spent getting      */
+/*  points from the queue and managing them, not evaluating them.           */
+/*  See runBenchmark.sh.                                                    */
+/*--------------------------------------------------------------------------*/
+#include "Nomad/nomad.hpp"
+#include "Algos/MainStep.hpp"
+
+// Trivial blackbox: f(x) = sum of x_i.
+class Trivial_Evaluator : public NOMAD::Evaluator
+{
+public:
+    Trivial_Evaluator(const std::shared_ptr<NOMAD::EvalParameters>& evalParams)
+    : NOMAD::Evaluator(evalParams, NOMAD::EvalType::BB)
+    {}
+
+    ~Trivial_Evaluator() {}
+
+    bool eval_x(NOMAD::EvalPoint &x, const NOMAD::Double &hMax, bool &countEval) const override
+    {
+        NOMAD::Double f = 0.0;
+        for (size_t i = 0; i < x.size(); i++)
+        {
+            f += x[i];
+        }
+
+        auto bbOutputType = _evalParams->getAttributeValue<NOMAD::BBOutputTypeList>("BB_OUTPUT_TYPE");
+        x.setBBO(f.tostring(), bbOutputType, getEvalType());
+
+        countEval = true;
+        return true;
+    }
+};
+
+
+int main(int argc, char ** argv)
+{
+    int nbThreads = (argc > 1) ? std::stoi(argv[1]) : 64;
+    size_t nbPoints = (argc > 2) ? std::stoul(argv[2]) : 100000;
+    const size_t n = 10;
+
+    NOMAD::BBOutputTypeList bbOutputType;
+    bbOutputType.push_back(NOMAD::BBOutputType::OBJ);
+
+    auto allParams = std::make_shared<NOMAD::AllParameters>();
+    allParams->setAttributeValue("DIMENSION", n);
+    allParams->setAttributeValue("X0", NOMAD::Point(n, 0.0));
+    allParams->setAttributeValue("LOWER_BOUND", NOMAD::ArrayOfDouble(n, -10.0));
+    allParams->setAttributeValue("UPPER_BOUND", NOMAD::ArrayOfDouble(n, 10.0));
+    allParams->setAttributeValue("BB_OUTPUT_TYPE", bbOutputType);
+    allParams->setAttributeValue("LH_EVAL", nbPoints);
+    allParams->setAttributeValue("NB_THREADS_OPENMP", nbThreads);
+    // Use a sharded cache, so that the cache lock is not the bottleneck.
+    allParams->setAttributeValue("CACHE_NB_SHARDS", (size_t)64);
+    allParams->setAttributeValue("DISPLAY_DEGREE", 0);
+    allParams->checkAndComply();
+
+    NOMAD::MainStep TheMainStep;
+    TheMainStep.setAllParameters(allParams);
+    std::unique_ptr<Trivial_Evaluator> ev(new Trivial_Evaluator(allParams->getEvalParams()));
+    TheMainStep.setEvaluator(std::move(ev));
+
+    double elapsed = 0.0;
+    try
+    {
+#ifdef _OPENMP
+        double start = omp_get_wtime();
+#else
+        NOMAD::Clock::reset();
+#endif // _OPENMP
+        TheMainStep.start();
+        TheMainStep.run();
+        TheMainStep.end();
+#ifdef _OPENMP
+        elapsed = omp_get_wtime() - start;
+#else
+        elapsed = NOMAD::Clock::getCPUTime();
+#endif // _OPENMP
+    }
+    catch (std::exception &e)
+    {
+        std::cerr << "\nNOMAD has been interrupted (" << e.what() << ")\n\n";
+        return EXIT_FAILURE;
+    }
+
+    size_t bbEval = NOMAD::EvcInterface::getEvaluatorControl()->getBbEval();
+    std::cout << nbThreads << "\t" << bbEval << "\t\t" << elapsed << "\t\t";
+    std::cout << (size_t)(bbEval / elapsed) << std::endl;
+
+    return EXIT_SUCCESS;
+}
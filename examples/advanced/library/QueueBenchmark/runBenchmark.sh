@@ -0,0 +1,9 @@
+#!/bin/bash
+# Evaluation throughput of the EvaluatorControl queue
+# with 1, 8, 32 and 64 threads, with a trivial blackbox.
+make
+echo -e "threads\tbb evals\ttime (s)\tevals/s"
+for nbThreads in 1 8 32 64
+do
+    ./queueBenchmark.exe $nbThreads
+done
@@ -71,12 +71,388 @@
 
 #include "Matrix.hpp"
 
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+#ifdef SGTELIB_USE_BLAS
+extern "C" {
+  #include <cblas.h>
+  // LAPACK Cholesky factorization (Fortran interface)
+  void dpotrf_ ( const char * uplo , const int * n , double * a ,
+                 const int * lda , int * info );
+}
+#endif
+
+/*--------------------------------------------------------------------*/
+/* Kernels                                                            */
+/* The loops below are written on contiguous rows so that the         */
+/* compiler can vectorize them. With gcc on x86_64 Linux, they are    */
+/* also compiled for AVX2 and AVX-512, and the best version is        */
+/* selected at load time; the default version is the scalar fallback. */
+/*--------------------------------------------------------------------*/
+#if defined(__GNUC__)
+  #define SGTELIB_RESTRICT __restrict__
+#elif defined(_MSC_VER)
+  #define SGTELIB_RESTRICT __restrict
+#else
+  #define SGTELIB_RESTRICT
+#endif
+
+#if defined(__GNUC__) && !defined(__clang__) && (__GNUC__ >= 6) && defined(__x86_64__) && defined(__linux__)
+  #define SGTELIB_KERNEL __attribute__((target_clones("avx512f","avx2","default")))
+#else
+  #define SGTELIB_KERNEL
+#endif
+
+namespace {
+
+  // Alignment of the matrix storage (one cache line, one AVX-512 register)
+  const size_t MATRIX_ALIGNMENT = 64;
+
+  // Block sizes of the product and cholesky kernels
+  const int BLOCK_INTER = 128;
+  const int BLOCK_COLS  = 512;
+
+  /*-----------------------------------------------*/
+  /* aligned allocation                            */
+  /* (the raw pointer is stored just before the    */
+  /* aligned block)                                */
+  /*-----------------------------------------------*/
+  double * aligned_new ( const size_t n ) {
+    if ( n == 0 ) return NULL;
+    void * raw = std::malloc( n*sizeof(double) + MATRIX_ALIGNMENT + sizeof(void*) );
+    if ( ! raw ) throw std::bad_alloc();
+    size_t addr = reinterpret_cast<size_t>(raw) + sizeof(void*);
+    addr = ( addr + MATRIX_ALIGNMENT - 1 ) & ~( MATRIX_ALIGNMENT - 1 );
+    reinterpret_cast<void**>(addr)[-1] = raw;
+    return reinterpret_cast<double*>(addr);
+  }//
+
+  void aligned_delete ( double * p ) {
+    if ( p ) std::free( reinterpret_cast<void**>(p)[-1] );
+  }//
+
+#ifndef SGTELIB_USE_BLAS
+  /*-----------------------------------------------*/
+  /* C += A*B                                      */
+  /* (A: m x q, B: q x n, C: m x n)                */
+  /* Blocked on q and n so that the rows of B that */
+  /* are used stay in cache while i sweeps over C. */
+  /*-----------------------------------------------*/
+  SGTELIB_KERNEL
+  void kernel_product ( double ** C , double ** A , double ** B ,
+                        const int m , const int n , const int q ) {
+    for ( int jj = 0 ; jj < n ; jj += BLOCK_COLS ) {
+      const int jend = std::min( jj+BLOCK_COLS , n );
+      for ( int kk = 0 ; kk < q ; kk += BLOCK_INTER ) {
+        const int kend = std::min( kk+BLOCK_INTER , q );
+        for ( int i = 0 ; i < m ; ++i ) {
+          double       * SGTELIB_RESTRICT ci = C[i];
+          const double * SGTELIB_RESTRICT ai = A[i];
+          int k = kk;
+          for ( ; k+3 < kend ; k += 4 ) {
+            const double a0 = ai[k  ] , a1 = ai[k+1] , a2 = ai[k+2] , a3 = ai[k+3];
+            const double * SGTELIB_RESTRICT b0 = B[k  ];
+            const double * SGTELIB_RESTRICT b1 = B[k+1];
+            const double * SGTELIB_RESTRICT b2 = B[k+2];
+            const double * SGTELIB_RESTRICT b3 = B[k+3];
+            for ( int j = jj ; j < jend ; ++j )
+              ci[j] = ci[j] + a0*b0[j] + a1*b1[j] + a2*b2[j] + a3*b3[j];
+          }
+          for ( ; k < kend ; ++k ) {
+            const double a = ai[k];
+            const double * SGTELIB_RESTRICT bk = B[k];
+            for ( int j = jj ; j < jend ; ++j )
+              ci[j] += a*bk[j];
+          }
+        }
+      }
+    }
+  }//
+
+  /*-----------------------------------------------*/
+  /* C += A'*B                                     */
+  /* (A: q x m, B: q x n, C: m x n)                */
+  /* Sum of the outer products of the rows of A    */
+  /* and B, so that all accesses are contiguous.   */
+  /*-----------------------------------------------*/
+  SGTELIB_KERNEL
+  void kernel_transposeA_product ( double ** C , double ** A , double ** B ,
+                                   const int m , const int n , const int q ) {
+    for ( int k = 0 ; k < q ; ++k ) {
+      const double * SGTELIB_RESTRICT ak = A[k];
+      const double * SGTELIB_RESTRICT bk = B[k];
+      for ( int i = 0 ; i < m ; ++i ) {
+        const double a = ak[i];
+        double * SGTELIB_RESTRICT ci = C[i];
+        for ( int j = 0 ; j < n ; ++j )
+          ci[j] += a*bk[j];
+      }
+    }
+  }//
+
+#endif
+
+  /*-----------------------------------------------*/
+  /* dot product of two rows                       */
+  /*-----------------------------------------------*/
+  inline double dot ( const double * SGTELIB_RESTRICT x ,
+                      const double * SGTELIB_RESTRICT y ,
+                      const int n ) {
+    double s[4] = { 0.0 , 0.0 , 0.0 , 0.0 };
+    int k = 0;
+    for ( ; k+3 < n ; k += 4 )
+      for ( int q = 0 ; q < 4 ; ++q )
+        s[q] += x[k+q]*y[k+q];
+    for ( ; k < n ; ++k )
+      s[0] += x[k]*y[k];
+    return (s[0]+s[1])+(s[2]+s[3]);
+  }//
+
+  /*-----------------------------------------------*/
+  /* Cholesky factorization L*L' = X               */
+  /* (L: n x n, zero on input)                     */
+  /* Right-looking, by blocks of columns: once a   */
+  /* block of columns of L is computed, its        */
+  /* contribution is removed from the rest of the  */
+  /* matrix with a product kernel.                 */
+  /*-----------------------------------------------*/
+  SGTELIB_KERNEL
+  void kernel_cholesky ( double ** L , double ** X , const int n ) {
+
+    const int NB = 64;
+    int i , j , c , jj;
+
+    // Lower triangle of X
+    for ( i = 0 ; i < n ; ++i )
+      for ( j = 0 ; j <= i ; ++j )
+        L[i][j] = X[i][j];
+
+    // Transpose of the current block of columns
+    std::vector<double> buffer ( static_cast<size_t>(NB)*n );
+
+    for ( int k0 = 0 ; k0 < n ; k0 += NB ) {
+      const int k1 = std::min( k0+NB , n );
+
+      // Block of columns k0..k1-1
+      for ( i = k0 ; i < n ; ++i ) {
+        double * SGTELIB_RESTRICT li = L[i];
+        const int jend = std::min( i , k1 );
+        for ( j = k0 ; j < jend ; ++j )
+          li[j] = 1.0 / L[j][j] * ( li[j] - dot(li+k0,L[j]+k0,j-k0) );
+        if ( i < k1 )
+          li[i] = sqrt( li[i] - dot(li+k0,li+k0,i-k0) );
+      }
+      if ( k1 == n ) break;
+
+      // Update of the rest of the matrix: L(i,j) -= L(i,k0:k1)*L(j,k0:k1)'
+      double * SGTELIB_RESTRICT Pt = &buffer[0];
+      for ( c = k0 ; c < k1 ; ++c )
+        for ( j = k1 ; j < n ; ++j )
+          Pt[static_cast<size_t>(c-k0)*n+j] = L[j][c];
+      for ( i = k1 ; i < n ; ++i ) {
+        double * SGTELIB_RESTRICT li = L[i];
+        for ( jj = k1 ; jj <= i ; jj += BLOCK_COLS ) {
+          const int jend = std::min( jj+BLOCK_COLS , i+1 );
+          c = k0;
+          for ( ; c+3 < k1 ; c += 4 ) {
+            const double a0 = li[c  ] , a1 = li[c+1] , a2 = li[c+2] , a3 = li[c+3];
+            const double * SGTELIB_RESTRICT p0 = Pt + static_cast<size_t>(c-k0)*n;
+            const double * SGTELIB_RESTRICT p1 = p0 + n;
+            const double * SGTELIB_RESTRICT p2 = p1 + n;
+            const double * SGTELIB_RESTRICT p3 = p2 + n;
+            for ( j = jj ; j < jend ; ++j )
+              li[j] = li[j] - a0*p0[j] - a1*p1[j] - a2*p2[j] - a3*p3[j];
+          }
+          for ( ; c < k1 ; ++c ) {
+            const double a = li[c];
+            const double * SGTELIB_RESTRICT pc = Pt + static_cast<size_t>(c-k0)*n;
+            for ( j = jj ; j < jend ; ++j )
+              li[j] -= a*pc[j];
+          }
+        }
+      }
+    }
+  }//
+
+  /*-----------------------------------------------*/
+  /* Y <- L^-1 * Y (L lower triangular)            */
+  /* If unit_diag, the diagonal of L is ignored    */
+  /* and taken equal to 1.                         */
+  /*-----------------------------------------------*/
+  SGTELIB_KERNEL
+  void kernel_tril_solve ( double ** L , double ** Y , const int n ,
+                           const int nrhs , const bool unit_diag ) {
+    for ( int i = 0 ; i < n ; ++i ) {
+      double * SGTELIB_RESTRICT yi = Y[i];
+      for ( int k = 0 ; k < i ; ++k ) {
+        const double l = L[i][k];
+        const double * SGTELIB_RESTRICT yk = Y[k];
+        for ( int j = 0 ; j < nrhs ; ++j )
+          yi[j] -= l*yk[j];
+      }
+      if ( ! unit_diag ) {
+        const double d = L[i][i];
+        for ( int j = 0 ; j < nrhs ; ++j )
+          yi[j] /= d;
+      }
+    }
+  }//
+
+  /*-----------------------------------------------*/
+  /* Y <- U^-1 * Y (U upper triangular)            */
+  /*-----------------------------------------------*/
+  SGTELIB_KERNEL
+  void kernel_triu_solve ( double ** U , double ** Y , const int n , const int nrhs ) {
+    for ( int i = n-1 ; i >= 0 ; --i ) {
+      double * SGTELIB_RESTRICT yi = Y[i];
+      for ( int k = i+1 ; k < n ; ++k ) {
+        const double u = U[i][k];
+        const double * SGTELIB_RESTRICT yk = Y[k];
+        for ( int j = 0 ; j < nrhs ; ++j )
+          yi[j] -= u*yk[j];
+      }
+      const double d = U[i][i];
+      for ( int j = 0 ; j < nrhs ; ++j )
+        yi[j] /= d;
+    }
+  }//
+
+  /*-----------------------------------------------*/
+  /* Li = L^-1 (L lower triangular, Li zero on     */
+  /* input). Row i of Li only has i+1 nonzeros.    */
+  /*-----------------------------------------------*/
+  SGTELIB_KERNEL
+  void kernel_tril_inverse ( double ** Li , double ** L , const int n ) {
+    for ( int i = 0 ; i < n ; ++i ) {
+      double * SGTELIB_RESTRICT yi = Li[i];
+      yi[i] = 1.0;
+      for ( int k = 0 ; k < i ; ++k ) {
+        const double l = L[i][k];
+        const double * SGTELIB_RESTRICT yk = Li[k];
+        for ( int j = 0 ; j <= k ; ++j )
+          yi[j] -= l*yk[j];
+      }
+      const double d = L[i][i];
+      for ( int j = 0 ; j <= i ; ++j )
+        yi[j] /= d;
+    }
+  }//
+
+  /*-----------------------------------------------*/
+  /* A = Li'*Li (Li lower triangular, A zero on    */
+  /* input). Only the lower half is computed, then */
+  /* copied to the upper half.                     */
+  /*-----------------------------------------------*/
+  SGTELIB_KERNEL
+  void kernel_tril_gram ( double ** A , double ** Li , const int n ) {
+    for ( int k = 0 ; k < n ; ++k ) {
+      const double * SGTELIB_RESTRICT lk = Li[k];
+      for ( int i = 0 ; i <= k ; ++i ) {
+        const double a = lk[i];
+        double * SGTELIB_RESTRICT ai = A[i];
+        for ( int j = 0 ; j <= i ; ++j )
+          ai[j] += a*lk[j];
+      }
+    }
+    for ( int i = 0 ; i < n ; ++i )
+      for ( int j = i+1 ; j < n ; ++j )
+        A[i][j] = A[j][i];
+  }//
+
+  /*-----------------------------------------------*/
+  /* D(ia,ib) = |A(ia,:)-B(ib,:)|_2                */
+  /* Bt is the transpose of B (n x pb), so that    */
+  /* the inner loop runs on ib, over contiguous    */
+  /* memory.                                       */
+  /*-----------------------------------------------*/
+  SGTELIB_KERNEL
+  void kernel_distances_norm2 ( double ** D , double ** A , double ** Bt ,
+                                const int pa , const int pb , const int n ) {
+    for ( int ia = 0 ; ia < pa ; ++ia ) {
+      double       * SGTELIB_RESTRICT di = D[ia];
+      const double * SGTELIB_RESTRICT ai = A[ia];
+      for ( int ib = 0 ; ib < pb ; ++ib )
+        di[ib] = 0.0;
+      for ( int j = 0 ; j < n ; ++j ) {
+        const double a = ai[j];
+        const double * SGTELIB_RESTRICT bj = Bt[j];
+        for ( int ib = 0 ; ib < pb ; ++ib ) {
+          const double d = a-bj[ib];
+          di[ib] += d*d;
+        }
+      }
+      for ( int ib = 0 ; ib < pb ; ++ib )
+        di[ib] = sqrt(di[ib]);
+    }
+  }//
+
+}
+
+/*---------------------------*/
+/*     storage management    */
+/*---------------------------*/
+void SGTELIB::Matrix::allocate ( const int nbRowsMax ) {
+  _nbRowsMax = nbRowsMax;
+  _data = aligned_new( static_cast<size_t>(_nbRowsMax)*static_cast<size_t>(_nbCols) );
+  _X = new double * [_nbRowsMax];
+  for ( int i = 0 ; i < _nbRowsMax ; ++i )
+    _X[i] = _data + static_cast<size_t>(i)*_nbCols;
+}//
+
+void SGTELIB::Matrix::release ( void ) {
+  aligned_delete(_data);
+  delete [] _X;
+  _data = NULL;
+  _X = NULL;
+  _nbRowsMax = 0;
+}//
+
+/*---------------------------------------------*/
+/*  make room for nbRowsMax rows (the storage  */
+/*  at least doubles, so that adding rows one  */
+/*  at a time has an amortized constant cost)  */
+/*---------------------------------------------*/
+void SGTELIB::Matrix::reserve_rows ( const int nbRowsMax ) {
+  if ( nbRowsMax <= _nbRowsMax )
+    return;
+  double *  old_data = _data;
+  double ** old_X    = _X;
+  allocate( std::max( nbRowsMax , 2*_nbRowsMax ) );
+  if ( old_data )
+    std::memcpy( _data , old_data , sizeof(double)*static_cast<size_t>(_nbRows)*_nbCols );
+  aligned_delete(old_data);
+  delete [] old_X;
+}//
+
+/*---------------------------------------------*/
+/*  change the number of columns (new columns  */
+/*  are filled with 0)                         */
+/*---------------------------------------------*/
+void SGTELIB::Matrix::resize_cols ( const int nbCols ) {
+  double *  old_data   = _data;
+  double ** old_X      = _X;
+  const int old_nbCols = _nbCols;
+  const int nc = std::min( old_nbCols , nbCols );
+  _nbCols = nbCols;
+  allocate(_nbRows);
+  for ( int i = 0 ; i < _nbRows ; ++i ) {
+    for ( int j = 0 ; j < nc ; ++j )
+      _X[i][j] = old_X[i][j];
+    for ( int j = nc ; j < _nbCols ; ++j )
+      _X[i][j] = 0.0;
+  }
+  aligned_delete(old_data);
+  delete [] old_X;
+}//
+
 /*---------------------------*/
 /*        constructor 1      */
 /*---------------------------*/
 SGTELIB::Matrix::Matrix ( const std::string & name ,
                           int                 nbRows    ,
-                          int                 nbCols    ) : 
+                          int                 nbCols    ) :
                _name   ( name ) ,
                _nbRows ( nbRows    ) ,
                _nbCols ( nbCols    )   {
@@ -86,14 +462,10 @@ SGTELIB::Matrix::Matrix ( const std::string & name ,
              "Matrix::constructor 1: bad dimensions" );
 #endif
 
-  int i , j;
-
-  _X = new double * [_nbRows];
-  for ( i = 0 ; i < _nbRows ; ++i ) {
-    _X[i] = new double [_nbCols];
-    for ( j = 0 ; j < _nbCols ; ++j )
-      _X[i][j] = 0.0;
-  }
+  allocate(_nbRows);
+  const int n = _nbRows*_nbCols;
+  for ( int k = 0 ; k < n ; ++k )
+    _data[k] = 0.0;
 }//
 
 /*---------------------------*/
@@ -108,15 +480,14 @@ SGTELIB::Matrix::Matrix ( const std::string & name ,
                _nbCols    ( nbCols    )   {
 #ifdef SGTELIB_DEBUG
   if ( _nbRows < 0 || _nbCols < 0 )
-    throw SGTELIB::Exception ( __FILE__ , __LINE__ , 
+    throw SGTELIB::Exception ( __FILE__ , __LINE__ ,
               "Matrix::constructor 2: bad dimensions" );
 #endif
 
   int i , j;
 
-  _X = new double * [_nbRows];
+  allocate(_nbRows);
   for ( i = 0 ; i < _nbRows ; ++i ) {
-    _X[i] = new double [_nbCols];
     for ( j = 0 ; j < _nbCols ; ++j )
       _X[i][j] = A[i][j];
   }
@@ -125,10 +496,12 @@ SGTELIB::Matrix::Matrix ( const std::string & name ,
 /*---------------------------*/
 /*        constructor 3      */
 /*---------------------------*/
-SGTELIB::Matrix::Matrix ( const std::string & file_name ) : 
+SGTELIB::Matrix::Matrix ( const std::string & file_name ) :
                   _name ( "no_name" ) ,
                   _nbRows    ( 0         ) ,
                   _nbCols    ( 0         ) ,
+                  _nbRowsMax ( 0         ) ,
+                  _data ( NULL      ) ,
                   _X    ( NULL      )   {
   *this = import_data(file_name);
 }//
@@ -137,25 +510,24 @@ SGTELIB::Matrix::Matrix ( const std::string & file_name ) :
 /*---------------------------*/
 /*        constructor 4      */
 /*---------------------------*/
-SGTELIB::Matrix::Matrix (void) : 
+SGTELIB::Matrix::Matrix (void) :
                _name ( "" ) ,
                _nbRows    ( 0   ) ,
                _nbCols    ( 0   ) {
-  _X = new double * [0];
+  allocate(0);
 }//
 
 /*---------------------------*/
 /*        constructor 5      */
 /*---------------------------*/
-SGTELIB::Matrix::Matrix (double v) : 
+SGTELIB::Matrix::Matrix (double v) :
                _name ( "double" ) ,
                _nbRows    ( 1   ) ,
                _nbCols    ( 1   ) {
   #ifdef SGTELIB_DEBUG
     std::cout << "Matrix Constructor 5\n";
   #endif
-  _X = new double * [1];
-  _X[0] = new double [1];
+  allocate(1);
   _X[0][0] = v;
 }//
 
@@ -163,17 +535,13 @@ SGTELIB::Matrix::Matrix (double v) :
 /*---------------------------*/
 /*      copy constructor     */
 /*---------------------------*/
-SGTELIB::Matrix::Matrix ( const SGTELIB::Matrix & A ) : 
+SGTELIB::Matrix::Matrix ( const SGTELIB::Matrix & A ) :
                           _name ( A._name ) ,
                           _nbRows    ( A._nbRows    ) ,
                           _nbCols    ( A._nbCols    ) {
-  int i , j;
-  _X = new double * [_nbRows];
-  for ( i = 0 ; i < _nbRows ; ++i ) {
-    _X[i] = new double [_nbCols];
-    for ( j = 0 ; j < _nbCols ; ++j )
-      _X[i][j] = A._X[i][j];
-  }
+  allocate(_nbRows);
+  if ( _data )
+    std::memcpy( _data , A._data , sizeof(double)*static_cast<size_t>(_nbRows)*_nbCols );
 }//
 
 
@@ -183,41 +551,24 @@ SGTELIB::Matrix::Matrix ( const SGTELIB::Matrix & A ) :
 /*    affectation operator   */
 /*---------------------------*/
 SGTELIB::Matrix & SGTELIB::Matrix::operator = ( const SGTELIB::Matrix & A ) {
-  
+
   if ( this == &A )
     return *this;
 
-  int i , j;
-
   if ( _nbRows != A._nbRows || _nbCols != A._nbCols ) {
-
-    for ( i = 0 ; i < _nbRows ; ++i )
-      delete [] _X[i];
-    delete [] _X;
-
+    release();
     _nbRows = A._nbRows;
     _nbCols = A._nbCols;
-
-    _X = new double * [_nbRows];
-    for ( i = 0 ; i < _nbRows ; ++i ) {
-      _X[i] = new double [_nbCols];
-      for ( j = 0 ; j < _nbCols ; ++j )
-        _X[i][j] = A._X[i][j];
-    }
-  }
-  else {
-    for ( i = 0 ; i < _nbRows ; ++i )
-      for ( j = 0 ; j < _nbCols ; ++j )
-        _X[i][j] = A._X[i][j];
+    allocate(_nbRows);
   }
-    
+  if ( _data )
+    std::memcpy( _data , A._data , sizeof(double)*static_cast<size_t>(_nbRows)*_nbCols );
+
   _name = A._name;
 
   return *this;
 }//
 
-
-
 /*---------------------------*/
 /*     import data           */
 /*---------------------------*/
@@ -388,21 +739,7 @@ SGTELIB::Matrix operator / (const SGTELIB::Matrix & A , const double v) {
 /*         destructor        */
 /*---------------------------*/
 SGTELIB::Matrix::~Matrix ( void ) {
-  /*
-  #ifdef SGTELIB_DEBUG
-    std::cout << "Delete " << _name << " of size (" << _nbCols << "," << _nbRows << ")...";
-    display(std::cout);
-    std::cout.flush();
-  #endif
-  */
-  for ( int i = 0 ; i < _nbRows ; ++i )
-    delete [] _X[i];
-  delete [] _X; 
-  /*
-  #ifdef SGTELIB_DEBUG
-    std::cout << "Deleted.\n";
-  #endif
-  */
+  release();
 }//
 
 /*---------------------------*/
@@ -410,17 +747,9 @@ SGTELIB::Matrix::~Matrix ( void ) {
 /*---------------------------*/
 void SGTELIB::Matrix::add_row  ( const double * row ) {
 
-  double ** new_X = new double * [_nbRows+1];
-
-  for ( int i = 0 ; i < _nbRows ; ++i )
-    new_X[i] = _X[i];
-
-  new_X[_nbRows] = new double [_nbCols];
+  reserve_rows(_nbRows+1);
   for ( int j = 0 ; j < _nbCols ; ++j )
-    new_X[_nbRows][j] = row[j];
-  
-  delete [] _X;
-  _X = new_X;
+    _X[_nbRows][j] = row[j];
   ++_nbRows;
 }//
 
@@ -436,19 +765,12 @@ void SGTELIB::Matrix::add_rows ( const Matrix & A ) {
   int i , j;
   int new_nbRows = _nbRows + A._nbRows;
 
-  double ** new_X = new double * [new_nbRows];
-
-  for ( i = 0 ; i < _nbRows ; ++i )
-    new_X[i] = _X[i];
-
+  reserve_rows(new_nbRows);
   for ( i = _nbRows ; i < new_nbRows ; ++i ) {
-    new_X[i] = new double [_nbCols];
     for ( j = 0 ; j < _nbCols ; ++j )
-      new_X[i][j] = A._X[i-_nbRows][j];
+      _X[i][j] = A._X[i-_nbRows][j];
   }
 
-  delete [] _X;
-  _X = new_X;
   _nbRows = new_nbRows;
 }//
 
@@ -462,25 +784,14 @@ void SGTELIB::Matrix::add_cols ( const Matrix & A ) {
              "Matrix::add_cols(): bad dimensions" );
 
   int i , j;
-  int new_nbCols = _nbCols + A._nbCols;
-  double * x;
+  const int old_nbCols = _nbCols;
 
+  resize_cols(_nbCols + A._nbCols);
+  // Additional columns
   for ( i = 0 ; i < _nbRows ; ++i ) {
-    // Complete line
-    x = new double [new_nbCols];
-    // Original columns
-    for ( j = 0 ; j < _nbCols ; ++j )
-      x[j] = _X[i][j];
-    // Additional columns
-    for ( j = _nbCols ; j < new_nbCols ; ++j )
-      x[j] = A._X[i][j-_nbCols];
-    // Remove original line
-    delete [] _X[i];
-    // Put new line
-    _X[i] = x;
+    for ( j = old_nbCols ; j < _nbCols ; ++j )
+      _X[i][j] = A._X[i][j-old_nbCols];
   }
-
-  _nbCols = new_nbCols;
 }//
 
 /*---------------------------------*/
@@ -491,20 +802,12 @@ void SGTELIB::Matrix::add_rows ( const int p ) {
   int i , j;
   int new_nbRows = _nbRows + p;
 
-  double ** new_X = new double * [new_nbRows];
-
-  for ( i = 0 ; i < _nbRows ; ++i )
-    new_X[i] = _X[i];
-
+  reserve_rows(new_nbRows);
   for ( i = _nbRows ; i < new_nbRows ; ++i ) {
-    new_X[i] = new double [_nbCols];
     for ( j = 0 ; j < _nbCols ; ++j )
-      new_X[i][j] = 0.0;
+      _X[i][j] = 0.0;
   }
 
-  delete [] _X;
-
-  _X = new_X;
   _nbRows = new_nbRows;
 }//
 
@@ -512,44 +815,15 @@ void SGTELIB::Matrix::add_rows ( const int p ) {
 /*         remove last rows        */
 /*---------------------------------*/
 void SGTELIB::Matrix::remove_rows ( const int p ) {
-
-  int i;
-  int new_nbRows = _nbRows - p;
-
-  double ** new_X = new double * [new_nbRows];
-
-  for ( i = 0 ; i < new_nbRows ; ++i )
-    new_X[i] = _X[i];
-
-  for ( i = new_nbRows ; i < _nbRows ; ++i )
-    delete [] _X[i];
-
-  delete [] _X;
-  _X = new_X;
-  _nbRows = new_nbRows;
+  // The storage is kept for the rows that may be added later.
+  _nbRows -= p;
 }//
 
 /*---------------------------------*/
 /*          add empty cols         */
 /*---------------------------------*/
 void SGTELIB::Matrix::add_cols ( const int p ) {
-
-  int i , j;
-  int new_nbCols = _nbCols + p;
-
-  double * x;
-
-  for ( i = 0 ; i < _nbRows ; ++i ) {
-    x = new double [new_nbCols];
-    for ( j = 0 ; j < _nbCols ; ++j )
-      x[j] = _X[i][j];
-    for ( j = _nbCols ; j < new_nbCols ; ++j )
-      x[j] = 0.0;
-    delete [] _X[i];
-    _X[i] = x;
-  }
-
-  _nbCols = new_nbCols;
+  resize_cols(_nbCols + p);
 }//
 
 /*-----------------------------------------*/
@@ -965,21 +1239,18 @@ SGTELIB::Matrix SGTELIB::Matrix::product ( const SGTELIB::Matrix & A,
   #endif
 
   // Compute
-  int i,j,k;
   const int nb_rows = C.get_nb_rows();
   const int nb_cols = C.get_nb_cols();
   const int nb_inter= A.get_nb_cols();
-  //double v;
-  for ( i = 0 ; i < nb_rows ; ++i ) {
-    for ( j = 0 ; j < nb_cols ; ++j ){
-      C._X[i][j] = 0;
-    }
-    for ( k = 0 ; k < nb_inter; ++k ){
-      for ( j = 0 ; j < nb_cols ; ++j ){
-        C._X[i][j] += A._X[i][k]*B._X[k][j];
-      }
-    }
-  }
+  if ( nb_rows==0 || nb_cols==0 || nb_inter==0 ) return C;
+  #ifdef SGTELIB_USE_BLAS
+    cblas_dgemm ( CblasRowMajor , CblasNoTrans , CblasNoTrans ,
+                  nb_rows , nb_cols , nb_inter ,
+                  1.0 , A._data , nb_inter , B._data , nb_cols ,
+                  0.0 , C._data , nb_cols );
+  #else
+    kernel_product ( C._X , A._X , B._X , nb_rows , nb_cols , nb_inter );
+  #endif
   return C;
 }//
 
@@ -1326,19 +1597,18 @@ SGTELIB::Matrix SGTELIB::Matrix::transposeA_product ( const SGTELIB::Matrix & A,
   SGTELIB::Matrix C(A.get_name()+"'*"+B.get_name(),A.get_nb_cols(),B.get_nb_cols());
 
   // Compute
-  int i,j,k;
   const int nb_rows = C.get_nb_rows();
   const int nb_cols = C.get_nb_cols();
   const int nb_inter= A.get_nb_rows();
-  //double v;
-  for ( i = 0 ; i < nb_rows ; ++i ) {
-    for ( j = 0 ; j < nb_cols ; ++j ){
-      C._X[i][j] = 0;
-      for ( k = 0 ; k < nb_inter; ++k ){
-        C._X[i][j] += A._X[k][i]*B._X[k][j];
-      }
-    }
-  }
+  if ( nb_rows==0 || nb_cols==0 || nb_inter==0 ) return C;
+  #ifdef SGTELIB_USE_BLAS
+    cblas_dgemm ( CblasRowMajor , CblasTrans , CblasNoTrans ,
+                  nb_rows , nb_cols , nb_inter ,
+                  1.0 , A._data , nb_rows , B._data , nb_cols ,
+                  0.0 , C._data , nb_cols );
+  #else
+    kernel_transposeA_product ( C._X , A._X , B._X , nb_rows , nb_cols , nb_inter );
+  #endif
   return C;
 
 }//
@@ -1954,19 +2224,26 @@ SGTELIB::Matrix SGTELIB::Matrix::cholesky ( void ) const {
   const int n = get_nb_rows();
   SGTELIB::Matrix L ("L",n,n);
 
-  double s;
-  int i,j,k;
-  for (i = 0; i < n; i++) {
-    for (j = 0; j < (i+1); j++) {
-      s = 0;
-      for (k = 0; k < j; k++){
-        s += L._X[i][k] * L._X[j][k];
+  #ifdef SGTELIB_USE_BLAS
+    // The row-major upper factor returned by LAPACK in column-major
+    // order is the lower factor L.
+    // If the matrix is not definite positive, fall back to the kernel
+    // below, which returns the same NaN as before.
+    if ( n > 0 ) {
+      int info = 0;
+      std::memcpy( L._data , _data , sizeof(double)*static_cast<size_t>(n)*n );
+      dpotrf_ ( "U" , &n , L._data , &n , &info );
+      if ( info == 0 ) {
+        for (int i = 0; i < n; i++)
+          for (int j = i+1; j < n; j++)
+            L._X[i][j] = 0.0;
+        return L;
       }
-      L._X[i][j] = (i == j) ?
-         sqrt(_X[i][i] - s) :
-         (1.0 / L._X[j][j] * (_X[i][j] - s));
+      L.fill(0.0);
     }
-  }
+  #endif
+
+  kernel_cholesky ( L._X , _X , n );
   return L;
 }//
 
@@ -1989,16 +2266,8 @@ SGTELIB::Matrix SGTELIB::Matrix::cholesky_inverse ( double * det ) const {
   // It is possible to divide the cost of the computation
   // of Li'*Li by 3.
   SGTELIB::Matrix A ("A",n,n);
-  int i,j,k,kmin;
-  for (i=0 ; i<n ; i++){
-    for (j=0 ; j<n ; j++){
-      A._X[i][j] = 0;
-      kmin = std::max(i,j);
-      for (k=kmin ; k<n ; k++){
-          A._X[i][j] += Li._X[k][i]*Li._X[k][j];
-      }
-    }
-  }
+  int i;
+  kernel_tril_gram ( A._X , Li._X , n );
 
   if (det){
     double v = 1;
@@ -2031,14 +2300,7 @@ SGTELIB::Matrix SGTELIB::Matrix::triu_solve( const SGTELIB::Matrix & U ,
   }
   
   SGTELIB::Matrix x = b;
-
-  for (int i=n-1 ; i>=0 ; i--){
-    for (int j=i+1 ; j<n ; j++){
-      x._X[i][0] -= U._X[i][j]*x._X[j][0];
-    }
-    x._X[i][0] /= U._X[i][i];
-  }
-
+  kernel_triu_solve ( U._X , x._X , n , 1 );
   return x;
 }//
 
@@ -2047,15 +2309,9 @@ SGTELIB::Matrix SGTELIB::Matrix::triu_solve( const SGTELIB::Matrix & U ,
 /*-----------------------------------------*/
 SGTELIB::Matrix SGTELIB::Matrix::tril_inverse( const SGTELIB::Matrix & L ){
   const int n = L.get_nb_rows(); 
-  SGTELIB::Matrix Li = L;
-  SGTELIB::Matrix b ("b",n,1);
-  
-  for (int i=0 ; i<n ; i++){
-    b.set(i,0,1.0);
-    Li.set_col( SGTELIB::Matrix::tril_solve(L,b) , i);
-    b.set(i,0,0.0);
-  }
-
+  SGTELIB::Matrix Li ("Li",n,n);
+  kernel_tril_inverse ( Li._X , L._X , n );
+  Li.set_name(L.get_name());
   return Li;
 }//
 
@@ -2079,14 +2335,7 @@ SGTELIB::Matrix SGTELIB::Matrix::tril_solve( const SGTELIB::Matrix & L ,
   }
   
   SGTELIB::Matrix x = b;
-
-  for (int i=0 ; i<n ; i++){
-    for (int j=0 ; j<i ; j++){
-      x._X[i][0] -= L._X[i][j]*x._X[j][0];
-    }
-    x._X[i][0] /= L._X[i][i];
-  }
-
+  kernel_tril_solve ( L._X , x._X , n , 1 , false );
   return x;
 }//
 
@@ -2725,20 +2974,9 @@ SGTELIB::Matrix SGTELIB::Matrix::get_distances_norm2 ( const SGTELIB::Matrix & A
   const int pa = A.get_nb_rows();
   const int pb = B.get_nb_rows();
   SGTELIB::Matrix D = SGTELIB::Matrix("D",pa,pb);
-  double v,d;
-  int ia, ib, j;
-
-  for (ia=0 ; ia < pa ; ia++){
-    for (ib=0 ; ib < pb ; ib++){
-      // Distance between the point ia of the cache and the point ib of the matrix XXs
-      v = 0;
-      for (j=0 ; j < n ; j++){
-        d = A._X[ia][j]-B._X[ib][j];
-        v += d*d;
-      }
-      D._X[ia][ib] = sqrt(v);
-    }
-  }
+  // Distance between the point ia of the cache and the point ib of the matrix XXs
+  const SGTELIB::Matrix Bt = B.transpose();
+  kernel_distances_norm2 ( D._X , A._X , Bt._X , pa , pb , n );
   return D;
 }//
 
@@ -3032,28 +3270,11 @@ SGTELIB::Matrix SGTELIB::Matrix::lu_inverse ( double * det ) const{
     *det = v;
   }
   
-  // Triangular inversion for each column of Ai.
-  SGTELIB::Matrix y;
-  for (k=0 ; k<N; k++){
-    y = Ai.get_col(k);
-    
-    // Tri-L solve
-    for (i=0 ; i<N ; i++){
-      for (j=0 ; j<i ; j++){
-        y._X[i][0] -= A._X[i][j]*y._X[j][0];
-      }
-    }
-
-    // Tri-U solve
-    for (int i=N-1 ; i>=0 ; i--){
-      for (int j=i+1 ; j<N ; j++){
-        y._X[i][0] -= A._X[i][j]*y._X[j][0];
-      }
-      y._X[i][0] /= A._X[i][i];
-    }
-
-    Ai.set_col(y,k);
-  }
+  // Triangular inversion, on all the columns of Ai at once.
+  // Tri-L solve (unit diagonal)
+  kernel_tril_solve ( A._X , Ai._X , N , N , true );
+  // Tri-U solve
+  kernel_triu_solve ( A._X , Ai._X , N , N );
 
   delete [] P;
   
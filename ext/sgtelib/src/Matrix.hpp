@@ -94,8 +94,21 @@ namespace SGTELIB {
     int _nbRows; // nbRows x nbCols matrix
     int _nbCols;
 
+    // The coefficients are stored in one contiguous, aligned, row-major
+    // block (_data). _X holds pointers to the rows of this block, so
+    // that _X[i][j] is the element (i,j).
+    // _nbRowsMax is the number of rows that fit in _data, which lets
+    // add_row and add_rows grow the matrix without a reallocation each time.
+    int _nbRowsMax;
+    double *  _data;
     double ** _X;
 
+    // Storage management
+    void allocate ( const int nbRowsMax );
+    void release  ( void );
+    void reserve_rows ( const int nbRowsMax );
+    void resize_cols  ( const int nbCols );
+
   public:
 
     // constructor 1:
@@ -0,0 +1,461 @@
+/*---------------------------------------------------------------------------------*/
+/*  NOMAD - Nonlinear Optimization by Mesh Adaptive Direct Search -                */
+/*                                                                                 */
+/*  NOMAD - Version 4.0.0 has been created by                                      */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  The copyright of NOMAD - version 4.0.0 is owned by                             */
+/*                 Sebastien Le Digabel        - Polytechnique Montreal            */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  NOMAD v4 has been funded by Rio Tinto, Hydro-Québec, NSERC (Natural Science    */
+/*  and Engineering Research Council of Canada), INOVEE (Innovation en Energie     */
+/*  Electrique and IVADO (The Institute for Data Valorization)                     */
+/*                                                                                 */
+/*  NOMAD v3 was created and developed by Charles Audet, Sebastien Le Digabel,     */
+/*  Christophe Tribes and Viviane Rochon Montplaisir and was funded by AFOSR       */
+/*  and Exxon Mobil.                                                               */
+/*                                                                                 */
+/*  NOMAD v1 and v2 were created and developed by Mark Abramson, Charles Audet,    */
+/*  Gilles Couture, and John E. Dennis Jr., and were funded by AFOSR and           */
+/*  Exxon Mobil.                                                                   */
+/*                                                                                 */
+/*  Contact information:                                                           */
+/*    Polytechnique Montreal - GERAD                                               */
+/*    C.P. 6079, Succ. Centre-ville, Montreal (Quebec) H3C 3A7 Canada              */
+/*    e-mail: nomad@gerad.ca                                                       */
+/*    phone : 1-514-340-6053 #6928                                                 */
+/*    fax   : 1-514-340-5665                                                       */
+/*                                                                                 */
+/*  This program is free software: you can redistribute it and/or modify it        */
+/*  under the terms of the GNU Lesser General Public License as published by       */
+/*  the Free Software Foundation, either version 3 of the License, or (at your     */
+/*  option) any later version.                                                     */
+/*                                                                                 */
+/*  This program is distributed in the hope that it will be useful, but WITHOUT    */
+/*  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or          */
+/*  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License    */
+/*  for more details.                                                              */
+/*                                                                                 */
+/*  You should have received a copy of the GNU Lesser General Public License       */
+/*  along with this program. If not, see <http://www.gnu.org/licenses/>.           */
+/*                                                                                 */
+/*  You can find information on the NOMAD software at www.gerad.ca/nomad           */
+/*---------------------------------------------------------------------------------*/
+/*-------------------------------------------------------------------------------------*/
+/*  sgtelib - A surrogate model library for derivative-free optimization               */
+/*  Version 2.0.2                                                                      */
+/*                                                                                     */
+/*  Copyright (C) 2012-2017  Sebastien Le Digabel - Ecole Polytechnique, Montreal      */
+/*                           Bastien Talgorn - McGill University, Montreal             */
+/*                                                                                     */
+/*  Author: Bastien Talgorn                                                            */
+/*  email: bastientalgorn@fastmail.com                                                 */
+/*                                                                                     */
+/*  This program is free software: you can redistribute it and/or modify it under the  */
+/*  terms of the GNU Lesser General Public License as published by the Free Software   */
+/*  Foundation, either version 3 of the License, or (at your option) any later         */
+/*  version.                                                                           */
+/*                                                                                     */
+/*  This program is distributed in the hope that it will be useful, but WITHOUT ANY    */
+/*  WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A    */
+/*  PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.   */
+/*                                                                                     */
+/*  You should have received a copy of the GNU Lesser General Public License along     */
+/*  with this program. If not, see <http://www.gnu.org/licenses/>.                     */
+/*                                                                                     */
+/*  You can find information on sgtelib at https://github.com/bastientalgorn/sgtelib   */
+/*-------------------------------------------------------------------------------------*/
+
+#include "Server_Socket.hpp"
+
+#include <cstring>
+#include <cerrno>
+
+#ifndef _WIN32
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#endif
+
+namespace {
+
+  // First word of each message, to detect a client that does not
+  // speak the protocol (ex: the file protocol or a previous version)
+  const int SERVER_MAGIC = 0x53474C31; // "SGL1"
+
+  // Limits on the size of a message, so that a corrupted header
+  // does not lead to a huge allocation.
+  const int SERVER_MAX_TEXT     = 1<<24;
+  const int SERVER_MAX_MATRICES = 1<<10;
+  const int SERVER_MAX_ENTRIES  = 1<<28;
+
+  std::string socket_error ( const std::string & what ){
+    return what + ": " + std::strerror(errno);
+  }
+
+#ifndef _WIN32
+
+  #ifdef MSG_NOSIGNAL
+    const int SEND_FLAGS = MSG_NOSIGNAL;
+  #else
+    const int SEND_FLAGS = 0;
+  #endif
+
+  // A closed peer must not kill the process with SIGPIPE
+  // (on systems without MSG_NOSIGNAL)
+  void set_nosigpipe ( const int fd ){
+    #ifdef SO_NOSIGPIPE
+      int on = 1;
+      setsockopt(fd,SOL_SOCKET,SO_NOSIGPIPE,&on,sizeof(on));
+    #else
+      (void)fd;
+    #endif
+  }
+
+  bool write_all ( const int fd , const char * buffer , size_t size ){
+    while (size>0){
+      const ssize_t k = send(fd,buffer,size,SEND_FLAGS);
+      if (k<0){
+        if (errno==EINTR) continue;
+        return false;
+      }
+      buffer += k;
+      size -= static_cast<size_t>(k);
+    }
+    return true;
+  }
+
+  bool read_all ( const int fd , char * buffer , size_t size ){
+    while (size>0){
+      const ssize_t k = recv(fd,buffer,size,0);
+      if (k<0){
+        if (errno==EINTR) continue;
+        return false;
+      }
+      if (k==0) return false;
+      buffer += k;
+      size -= static_cast<size_t>(k);
+    }
+    return true;
+  }
+
+  void append ( std::vector<char> & buffer , const void * data , const size_t size ){
+    const char * c = static_cast<const char *>(data);
+    buffer.insert(buffer.end(),c,c+size);
+  }
+
+#endif
+
+}
+
+#ifndef _WIN32
+
+/*--------------------------------------*/
+/*            send a message            */
+/*--------------------------------------*/
+bool SGTELIB::server_send ( const int fd , const SGTELIB::Server_Message & msg ){
+
+  const int nb_matrices = static_cast<int>(msg.matrices.size());
+  const int header[4] = { SERVER_MAGIC ,
+                          msg.code ,
+                          static_cast<int>(msg.text.size()) ,
+                          nb_matrices };
+
+  // The whole message is sent at once
+  size_t size = sizeof(header) + msg.text.size();
+  for (int k=0 ; k<nb_matrices ; k++){
+    const SGTELIB::Matrix & M = msg.matrices[k];
+    size += 2*sizeof(int) + sizeof(double)*M.get_nb_rows()*M.get_nb_cols();
+  }
+  std::vector<char> buffer;
+  buffer.reserve(size);
+
+  append(buffer,header,sizeof(header));
+  append(buffer,msg.text.data(),msg.text.size());
+  for (int k=0 ; k<nb_matrices ; k++){
+    const SGTELIB::Matrix & M = msg.matrices[k];
+    const int dim[2] = { M.get_nb_rows() , M.get_nb_cols() };
+    append(buffer,dim,sizeof(dim));
+    for (int i=0 ; i<dim[0] ; i++){
+      for (int j=0 ; j<dim[1] ; j++){
+        const double v = M.get(i,j);
+        append(buffer,&v,sizeof(double));
+      }
+    }
+  }
+
+  return write_all(fd,&buffer[0],buffer.size());
+}//
+
+/*--------------------------------------*/
+/*          receive a message           */
+/*--------------------------------------*/
+bool SGTELIB::server_receive ( const int fd , SGTELIB::Server_Message & msg ){
+
+  int header[4];
+  if ( ! read_all(fd,reinterpret_cast<char *>(header),sizeof(header))) return false;
+  if (header[0]!=SERVER_MAGIC){
+    throw SGTELIB::Exception ( __FILE__ , __LINE__ ,
+             "server_receive(): this is not a sgtelib server message" );
+  }
+  const int text_size   = header[2];
+  const int nb_matrices = header[3];
+  if ( (text_size<0) || (text_size>SERVER_MAX_TEXT) ||
+       (nb_matrices<0) || (nb_matrices>SERVER_MAX_MATRICES) ){
+    throw SGTELIB::Exception ( __FILE__ , __LINE__ ,
+             "server_receive(): invalid message header" );
+  }
+
+  msg.code = header[1];
+  msg.text.clear();
+  msg.matrices.clear();
+
+  if (text_size>0){
+    std::vector<char> text (text_size);
+    if ( ! read_all(fd,&text[0],text_size)) return false;
+    msg.text.assign(text.begin(),text.end());
+  }
+
+  std::vector<double> values;
+  for (int k=0 ; k<nb_matrices ; k++){
+    int dim[2];
+    if ( ! read_all(fd,reinterpret_cast<char *>(dim),sizeof(dim))) return false;
+    if ( (dim[0]<0) || (dim[1]<0) ||
+         ( (dim[0]>0) && (dim[1]>SERVER_MAX_ENTRIES/dim[0]) ) ){
+      throw SGTELIB::Exception ( __FILE__ , __LINE__ ,
+               "server_receive(): invalid matrix dimensions" );
+    }
+    const int nb_values = dim[0]*dim[1];
+    values.resize(nb_values);
+    if ( (nb_values>0) &&
+         ( ! read_all(fd,reinterpret_cast<char *>(&values[0]),nb_values*sizeof(double))) ){
+      return false;
+    }
+    SGTELIB::Matrix M ("M",dim[0],dim[1]);
+    for (int i=0 ; i<dim[0] ; i++){
+      for (int j=0 ; j<dim[1] ; j++){
+        M.set(i,j,values[i*dim[1]+j]);
+      }
+    }
+    msg.matrices.push_back(M);
+  }
+  return true;
+}//
+
+/*--------------------------------------*/
+/*        listen on a socket path       */
+/*--------------------------------------*/
+int SGTELIB::server_listen ( const std::string & path ){
+
+  sockaddr_un address;
+  std::memset(&address,0,sizeof(address));
+  address.sun_family = AF_UNIX;
+  if (path.empty() || (path.size()>=sizeof(address.sun_path))){
+    throw SGTELIB::Exception ( __FILE__ , __LINE__ ,
+             "server_listen(): invalid socket path \""+path+"\"" );
+  }
+  std::strcpy(address.sun_path,path.c_str());
+
+  const int fd = socket(AF_UNIX,SOCK_STREAM,0);
+  if (fd<0){
+    throw SGTELIB::Exception ( __FILE__ , __LINE__ , socket_error("server_listen(): socket") );
+  }
+
+  // Remove the socket file of a previous server
+  unlink(path.c_str());
+  if ( (bind(fd,reinterpret_cast<sockaddr *>(&address),sizeof(address))<0) ||
+       (listen(fd,4)<0) ){
+    const std::string error = socket_error("server_listen(): bind \""+path+"\"");
+    close(fd);
+    throw SGTELIB::Exception ( __FILE__ , __LINE__ , error );
+  }
+  return fd;
+}//
+
+/*--------------------------------------*/
+/*        wait for the next client      */
+/*--------------------------------------*/
+int SGTELIB::server_accept ( const int listen_fd ){
+  while (true){
+    const int fd = accept(listen_fd,NULL,NULL);
+    if (fd>=0){
+      set_nosigpipe(fd);
+      return fd;
+    }
+    if (errno!=EINTR) return -1;
+  }
+}//
+
+/*--------------------------------------*/
+/*                close                 */
+/*--------------------------------------*/
+void SGTELIB::server_close ( const int fd ){
+  if (fd>=0) close(fd);
+}//
+
+void SGTELIB::server_close ( const int listen_fd , const std::string & path ){
+  SGTELIB::server_close(listen_fd);
+  unlink(path.c_str());
+}//
+
+/*--------------------------------------*/
+/*          client constructor          */
+/*--------------------------------------*/
+SGTELIB::Server_Client::Server_Client ( const std::string & path ) :
+  _fd ( -1 ) {
+
+  sockaddr_un address;
+  std::memset(&address,0,sizeof(address));
+  address.sun_family = AF_UNIX;
+  if (path.empty() || (path.size()>=sizeof(address.sun_path))){
+    throw SGTELIB::Exception ( __FILE__ , __LINE__ ,
+             "Server_Client(): invalid socket path \""+path+"\"" );
+  }
+  std::strcpy(address.sun_path,path.c_str());
+
+  _fd = socket(AF_UNIX,SOCK_STREAM,0);
+  if (_fd<0){
+    throw SGTELIB::Exception ( __FILE__ , __LINE__ , socket_error("Server_Client(): socket") );
+  }
+  if (connect(_fd,reinterpret_cast<sockaddr *>(&address),sizeof(address))<0){
+    const std::string error = socket_error("Server_Client(): connect \""+path+"\"");
+    close(_fd);
+    throw SGTELIB::Exception ( __FILE__ , __LINE__ , error );
+  }
+  set_nosigpipe(_fd);
+}//
+
+#else
+
+// Unix-domain sockets are not available: only the file protocol
+// can be used.
+bool SGTELIB::server_send ( const int , const SGTELIB::Server_Message & ){
+  throw SGTELIB::Exception ( __FILE__ , __LINE__ , "sgtelib socket server is not available on this system" );
+}//
+bool SGTELIB::server_receive ( const int , SGTELIB::Server_Message & ){
+  throw SGTELIB::Exception ( __FILE__ , __LINE__ , "sgtelib socket server is not available on this system" );
+}//
+int SGTELIB::server_listen ( const std::string & ){
+  throw SGTELIB::Exception ( __FILE__ , __LINE__ , "sgtelib socket server is not available on this system" );
+}//
+int SGTELIB::server_accept ( const int ){
+  return -1;
+}//
+void SGTELIB::server_close ( const int ){}
+void SGTELIB::server_close ( const int , const std::string & ){}
+SGTELIB::Server_Client::Server_Client ( const std::string & ) :
+  _fd ( -1 ) {
+  throw SGTELIB::Exception ( __FILE__ , __LINE__ , "sgtelib socket server is not available on this system" );
+}//
+
+#endif
+
+/*--------------------------------------*/
+/*           client destructor          */
+/*--------------------------------------*/
+SGTELIB::Server_Client::~Server_Client ( void ) {
+  SGTELIB::server_close(_fd);
+}//
+
+/*--------------------------------------*/
+/*     send a request, get the answer   */
+/*--------------------------------------*/
+SGTELIB::Server_Message SGTELIB::Server_Client::request ( const SGTELIB::Server_Message & msg ){
+  SGTELIB::Server_Message answer;
+  if ( ( ! SGTELIB::server_send(_fd,msg)) || ( ! SGTELIB::server_receive(_fd,answer)) ){
+    throw SGTELIB::Exception ( __FILE__ , __LINE__ ,
+             "Server_Client: connection to the server lost" );
+  }
+  if (answer.code==SGTELIB::SERVER_ERROR){
+    throw SGTELIB::Exception ( __FILE__ , __LINE__ , "sgtelib server: "+answer.text );
+  }
+  return answer;
+}//
+
+/*--------------------------------------*/
+/*               requests               */
+/*--------------------------------------*/
+void SGTELIB::Server_Client::new_data ( const SGTELIB::Matrix & X , const SGTELIB::Matrix & Z ){
+  SGTELIB::Server_Message msg (SGTELIB::SERVER_NEW_DATA);
+  msg.matrices.push_back(X);
+  msg.matrices.push_back(Z);
+  request(msg);
+}//
+
+bool SGTELIB::Server_Client::predict ( const SGTELIB::Matrix & XX ,
+                                             SGTELIB::Matrix & ZZ ,
+                                             SGTELIB::Matrix & std ,
+                                             SGTELIB::Matrix & ei ,
+                                             SGTELIB::Matrix & cdf ){
+  SGTELIB::Server_Message msg (SGTELIB::SERVER_PREDICT);
+  msg.matrices.push_back(XX);
+  const SGTELIB::Server_Message answer = request(msg);
+  if (answer.matrices.size()!=4){
+    throw SGTELIB::Exception ( __FILE__ , __LINE__ ,
+             "Server_Client::predict(): bad answer" );
+  }
+  ZZ  = answer.matrices[0];
+  std = answer.matrices[1];
+  ei  = answer.matrices[2];
+  cdf = answer.matrices[3];
+  ZZ.set_name("ZZ");
+  std.set_name("std");
+  ei.set_name("ei");
+  cdf.set_name("cdf");
+  return (answer.code==SGTELIB::SERVER_READY);
+}//
+
+bool SGTELIB::Server_Client::cv ( SGTELIB::Matrix & Zh , SGTELIB::Matrix & Sh ,
+                                  SGTELIB::Matrix & Zv , SGTELIB::Matrix & Sv ){
+  const SGTELIB::Server_Message answer = request(SGTELIB::Server_Message(SGTELIB::SERVER_CV));
+  if (answer.code!=SGTELIB::SERVER_READY) return false;
+  if (answer.matrices.size()!=4){
+    throw SGTELIB::Exception ( __FILE__ , __LINE__ ,
+             "Server_Client::cv(): bad answer" );
+  }
+  Zh = answer.matrices[0];
+  Sh = answer.matrices[1];
+  Zv = answer.matrices[2];
+  Sv = answer.matrices[3];
+  Zh.set_name("Zh");
+  Sh.set_name("Sh");
+  Zv.set_name("Zv");
+  Sv.set_name("Sv");
+  return true;
+}//
+
+bool SGTELIB::Server_Client::metric ( const std::string & metric , SGTELIB::Matrix & value ){
+  SGTELIB::Server_Message msg (SGTELIB::SERVER_METRIC);
+  msg.text = metric;
+  const SGTELIB::Server_Message answer = request(msg);
+  if (answer.code!=SGTELIB::SERVER_READY) return false;
+  if (answer.matrices.size()!=1){
+    throw SGTELIB::Exception ( __FILE__ , __LINE__ ,
+             "Server_Client::metric(): bad answer" );
+  }
+  value = answer.matrices[0];
+  value.set_name(metric);
+  return true;
+}//
+
+bool SGTELIB::Server_Client::info ( std::string & description ){
+  const SGTELIB::Server_Message answer = request(SGTELIB::Server_Message(SGTELIB::SERVER_INFO));
+  description = answer.text;
+  return (answer.code==SGTELIB::SERVER_READY);
+}//
+
+bool SGTELIB::Server_Client::ping ( void ){
+  return (request(SGTELIB::Server_Message(SGTELIB::SERVER_PING)).code==SGTELIB::SERVER_READY);
+}//
+
+void SGTELIB::Server_Client::reset ( void ){
+  request(SGTELIB::Server_Message(SGTELIB::SERVER_RESET));
+}//
+
+void SGTELIB::Server_Client::quit ( void ){
+  request(SGTELIB::Server_Message(SGTELIB::SERVER_QUIT));
+}//
@@ -70,6 +70,11 @@
 /*-------------------------------------------------------------------------------------*/
 
 #include "Surrogate.hpp"
+#include "Surrogate_Factory.hpp"
+#include <vector>
+#ifdef _OPENMP
+  #include <omp.h>
+#endif
 
 using namespace SGTELIB;
 
@@ -1434,6 +1439,23 @@ bool SGTELIB::Surrogate::optimize_parameters ( void ) {
   SGTELIB::Matrix CACHE ("CACHE",0,N);
   bool cache_hit;
 
+  // Models used to evaluate the candidates in parallel
+  // (workers[0] is this model). There is no need for more workers
+  // than candidates in a POLL.
+  // The models of an ensemble are already built in parallel, and
+  // copying an ensemble would mean building all its models again.
+  std::vector<SGTELIB::Surrogate *> workers (1,this);
+  if (get_type()!=SGTELIB::ENSEMBLE){
+    const int nb_threads = std::min( SGTELIB::get_nb_threads() ,
+                                     std::max( X0.get_nb_rows() , 2*N ) );
+    for (i=1 ; i<nb_threads ; i++){
+      SGTELIB::Surrogate * W = get_worker();
+      if ( ! W) break;
+      workers.push_back(W);
+    }
+  }
+  const int nb_workers = static_cast<int>(workers.size());
+
   //------------------------
   // LOOP
   //------------------------
@@ -1477,25 +1499,11 @@ bool SGTELIB::Surrogate::optimize_parameters ( void ) {
 
 
 
-    // Evaluate POLL
-    for (i=0 ; i<POLL.get_nb_rows() ; i++){
-
-      // Candidate
-      xtry = POLL.get_row(i);
-      xtry.set_name("xtry");
-
-      // Display candidate
-      if (display){
-        if (iter) std::cout << "X = [ " ;
-        else std::cout << "X0= [ " ;
-        for (j=0 ; j<N ; j++) std::cout << xtry[j] << " ";
-        std::cout << "] => ";
-      }
-
-      // Snap to bounds
+    // Snap candidates to bounds
+    const int npoll = POLL.get_nb_rows();
+    for (i=0 ; i<npoll ; i++){
       for (j=0 ; j<N ; j++){
-        d = xtry[j];
-        // Snap to bounds
+        d = POLL.get(i,j);
         double lbj = lb[j];
         double ubj = ub[j];
         switch (domain[j]){
@@ -1521,59 +1529,124 @@ bool SGTELIB::Surrogate::optimize_parameters ( void ) {
             throw SGTELIB::Exception ( __FILE__ , __LINE__ ,"Invalid variable domain!" );
             break;
         }
-        xtry.set(0,j,d);    
+        POLL.set(i,j,d);
+      }
+    }
+
+    // Evaluate POLL
+    // The candidates are evaluated by groups of nb_workers, in parallel.
+    // The results of a group are then processed in the order of the POLL,
+    // as if the candidates were evaluated one after the other. So the
+    // result does not depend on the number of threads.
+    int ifirst = 0;
+    while ( (ifirst<npoll) && ( ! ((iter) && (success)) ) ){
+
+      // Group of candidates, up to nb_workers evaluations.
+      // A candidate is a cache hit if it is in the CACHE, or if it is
+      // identical to a previous candidate of the group.
+      int ilast = ifirst;
+      int nb_eval = 0;
+      SGTELIB::Matrix GROUP ("GROUP",0,N);
+      std::vector<int> group_index;
+      while ( (ilast<npoll) && (nb_eval<nb_workers) ){
+        xtry = POLL.get_row(ilast);
+        if ( (CACHE.find_row(xtry)==-1) && (GROUP.find_row(xtry)==-1) ){
+          GROUP.add_rows(xtry);
+          group_index.push_back(ilast);
+          nb_eval++;
+        }
+        ilast++;
       }
 
-      // Check Cache
-      cache_hit = (CACHE.find_row(xtry)!=-1);
-      if (cache_hit){
-        if (display) std::cout << "Cache hit\n";
+      // Parallel evaluation of the group
+      std::vector<double> fgroup (nb_eval,+INF);
+      std::vector<double> pgroup (nb_eval,+INF);
+      std::vector<std::string> error_group (nb_eval);
+      #ifdef _OPENMP
+      #pragma omp parallel for schedule(static,1) num_threads(nb_eval) if (nb_eval>1)
+      #endif
+      for (int ie=0 ; ie<nb_eval ; ie++){
+        try{
+          workers[ie]->eval_candidate(GROUP.get_row(ie),fgroup[ie],pgroup[ie]);
+        }
+        catch (const std::exception & e){
+          error_group[ie] = e.what();
+          if (error_group[ie].empty()) error_group[ie] = "Error in the evaluation of a candidate";
+        }
       }
-      else{
-        // --------------------------------------
-        // EVALUATION of metric and penalty
-        // --------------------------------------
-        // Register the xtry values in the parameter of the model
-        _param.set_x(xtry);
-        // Check that the parameters are consistent.
-        _param.check();
-        // Eval the objective (metric of the model)
-        ftry = eval_objective();
-        // Call the parameter class to get the penalty value.
-        ptry = _param.get_x_penalty();
-        // Reduce evaluation budget
-        budget--;
-        // Add the current point to the CACHE.
-        CACHE.add_rows(xtry);
-
-        // Display f and p
+
+      // Process the results in order
+      int ie = 0;
+      for (i=ifirst ; i<ilast ; i++){
+
+        // Candidate
+        xtry = POLL.get_row(i);
+        xtry.set_name("xtry");
+
+        // Display candidate
         if (display){
-          if (ftry>=+INF) std::cout << "+inf" ;
-          else std::cout << ftry;
-          std::cout << " / " ;
-          if (ptry>=+INF) std::cout << "+inf" ;
-          else std::cout << ptry;
+          if (iter) std::cout << "X = [ " ;
+          else std::cout << "X0= [ " ;
+          for (j=0 ; j<N ; j++) std::cout << xtry[j] << " ";
+          std::cout << "] => ";
         }
 
-        // Check for success 
-        // The point xtry is a success if there is an improvement in the metric,
-        // or, for an equal metric, if there is an improvement in the penalty.
-        if ( (ftry<fmin) || ((ftry==fmin) && (ptry<pmin)) ){
-          if (display) std::cout << "(!)";
-          xmin = xtry;
-          fmin = ftry;
-          pmin = ptry;
-          success = true;
+        // Check Cache
+        cache_hit = ( (ie>=nb_eval) || (group_index[ie]!=i) );
+        if (cache_hit){
+          if (display) std::cout << "Cache hit\n";
         }
-        if (display) std::cout << "\n";
-      } // End Evaluation (i.e. No Cache Hit)
+        else{
+          // --------------------------------------
+          // EVALUATION of metric and penalty
+          // --------------------------------------
+          if ( ! error_group[ie].empty()){
+            for (int iw=1 ; iw<nb_workers ; iw++) delete workers[iw];
+            delete [] logscale;
+            delete [] domain;
+            throw SGTELIB::Exception ( __FILE__ , __LINE__ , error_group[ie] );
+          }
+          ftry = fgroup[ie];
+          ptry = pgroup[ie];
+          ie++;
+          // Reduce evaluation budget
+          budget--;
+          // Add the current point to the CACHE.
+          CACHE.add_rows(xtry);
+
+          // Display f and p
+          if (display){
+            if (ftry>=+INF) std::cout << "+inf" ;
+            else std::cout << ftry;
+            std::cout << " / " ;
+            if (ptry>=+INF) std::cout << "+inf" ;
+            else std::cout << ptry;
+          }
+
+          // Check for success
+          // The point xtry is a success if there is an improvement in the metric,
+          // or, for an equal metric, if there is an improvement in the penalty.
+          if ( (ftry<fmin) || ((ftry==fmin) && (ptry<pmin)) ){
+            if (display) std::cout << "(!)";
+            xmin = xtry;
+            fmin = ftry;
+            pmin = ptry;
+            success = true;
+          }
+          if (display) std::cout << "\n";
+        } // End Evaluation (i.e. No Cache Hit)
+
+        // For iter==0, then we evaluate all the starting points.
+        // For iter>0, if xtry is a success, we do not evaluate the other points of the POLL
+        // (opportunistic evaluation of the poll). The evaluations of the group that
+        // come after xtry are discarded.
+        if ( (iter) && (success) ) break;
+
+      }// END LOOP ON GROUP (for i...)
 
-      // For iter==0, then we evaluate all the starting points.
-      // For iter>0, if xtry is a success, we do not evaluate the other points of the POLL
-      // (opportunistic evaluation of the poll)
-      if ( (iter) && (success) ) break;
+      ifirst = ilast;
 
-    }// END LOOP ON POLL (for i...)
+    }// END LOOP ON POLL (while ifirst...)
 
     if (iter){
       // Update poll size
@@ -1588,6 +1661,8 @@ bool SGTELIB::Surrogate::optimize_parameters ( void ) {
 
   }// End of optimization
 
+  for (i=1 ; i<nb_workers ; i++) delete workers[i];
+
 
   // Set param to optimal value
   _param.set_x(xmin);
@@ -1614,6 +1689,44 @@ bool SGTELIB::Surrogate::optimize_parameters ( void ) {
 }//
 
 
+/*--------------------------------------*/
+/*  Copy of the model used to evaluate  */
+/*   sets of parameters in parallel     */
+/*--------------------------------------*/
+SGTELIB::Surrogate * SGTELIB::Surrogate::get_worker ( void ) const {
+  SGTELIB::Surrogate * W = NULL;
+  try{
+    W = SGTELIB::Surrogate_Factory(_trainingset,_param);
+    W->_p_ts = _p_ts;
+    W->_p = _p;
+    W->_selected_points = _selected_points;
+    W->_display = false;
+    if ( ! W->init_private() ){
+      delete W;
+      W = NULL;
+    }
+  }
+  catch (const std::exception &){
+    delete W;
+    W = NULL;
+  }
+  return W;
+}//
+
+/*--------------------------------------*/
+/*   Evaluation of a set of parameters  */
+/*--------------------------------------*/
+void SGTELIB::Surrogate::eval_candidate ( const SGTELIB::Matrix & x , double & f , double & p ){
+  // Register the x values in the parameter of the model
+  _param.set_x(x);
+  // Check that the parameters are consistent.
+  _param.check();
+  // Eval the objective (metric of the model)
+  f = eval_objective();
+  // Call the parameter class to get the penalty value.
+  p = _param.get_x_penalty();
+}//
+
 /*--------------------------------------*/
 /*    Evaluation of the error metric    */
 /*       for a set of parameters        */
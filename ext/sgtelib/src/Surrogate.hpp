@@ -169,6 +169,13 @@ namespace SGTELIB {
     // Display private 
     virtual void display_private ( std::ostream & out ) const = 0;
 
+    // Parameter optimization:
+    // Independent copy of the model, on the same training set, used to
+    // evaluate several sets of parameters in parallel (NULL if the copy fails)
+    SGTELIB::Surrogate * get_worker ( void ) const;
+    // Metric f and penalty p of the set of parameters x
+    void eval_candidate ( const SGTELIB::Matrix & x , double & f , double & p );
+
     // get matrices (these matrices are unscaled before being returned)
     // (That's why these functions cant be public)
     const SGTELIB::Matrix get_matrix_Xs (void);
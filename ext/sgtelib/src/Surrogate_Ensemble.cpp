@@ -70,6 +70,7 @@
 /*-------------------------------------------------------------------------------------*/
 
 #include "Surrogate_Ensemble.hpp"
+#include <vector>
 
 /*----------------------------*/
 /*         constructor        */
@@ -236,19 +237,37 @@ bool SGTELIB::Surrogate_Ensemble::init_private ( void ) {
   }
 
   // Build them & count the number of ready
-  _kready = 0;
+  // The models are independent (they only share the training set, which
+  // is already built), so they are built in parallel.
+  std::vector<int> ready (_kmax,0);
+  std::vector<std::string> error (_kmax);
   int k;
+  #ifdef _OPENMP
+  #pragma omp parallel for schedule(dynamic) num_threads(std::min(SGTELIB::get_nb_threads(),_kmax))
+  #endif
+  for (k=0 ; k<_kmax ; k++){
+    try{
+      ready[k] = (_surrogates.at(k)->build())?1:0;
+    }
+    catch (const std::exception & e){
+      error[k] = e.what();
+      if (error[k].empty()) error[k] = "Error in the build of a model of the ensemble";
+    }
+  }
+  _kready = 0;
   for (k=0 ; k<_kmax ; k++){
+    if ( ! error[k].empty())
+      throw SGTELIB::Exception ( __FILE__ , __LINE__ , error[k] );
     #ifdef ENSEMBLE_DEBUG
       std::cout << "Init model " << k << "/" << _kmax << ": " << _surrogates.at(k)->get_short_string();
     #endif
-    if (_surrogates.at(k)->build()){
+    if (ready[k]){
       _kready++;
       #ifdef ENSEMBLE_DEBUG
         std::cout << " (ready)\n";
       #endif
     }
-  }  
+  }
   #ifdef ENSEMBLE_DEBUG
     std::cout << "Surrogate_Ensemble : _kready/_kmax : " << _kready << "/" << _kmax << "\n";
   #endif
@@ -90,6 +90,9 @@ namespace SGTELIB {
 DLL_API SGTELIB::Surrogate * Surrogate_Factory ( SGTELIB::TrainingSet    & C,
                                          const std::string & s );
 
+DLL_API SGTELIB::Surrogate * Surrogate_Factory ( SGTELIB::TrainingSet    & C,
+                                         const SGTELIB::Surrogate_Parameters & p );
+
 DLL_API SGTELIB::Surrogate * Surrogate_Factory ( SGTELIB::Matrix & X0,
                                          SGTELIB::Matrix & Z0,
                                          const std::string & s );
@@ -74,6 +74,10 @@
 #include <string>
 #include <sstream>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 
 /*-------------------------------*/
 /*     string comparison         */
@@ -658,6 +662,18 @@ double SGTELIB::uniform_rand (void){
   return double(rand() / double(INT_MAX));
 }//
 
+/*----------------------------------------*/
+/*  number of threads                     */
+/*----------------------------------------*/
+int SGTELIB::get_nb_threads (void){
+#ifdef _OPENMP
+  if ( omp_get_active_level() >= omp_get_max_active_levels() ) return 1;
+  return omp_get_max_threads();
+#else
+  return 1;
+#endif
+}//
+
 /*----------------------------------------*/
 /*  quick gaussian random generator       */
 /*----------------------------------------*/
@@ -224,6 +224,11 @@ namespace SGTELIB {
 
   double uniform_rand (void);
   double quick_norm_rand (void);
+
+  // Number of threads for a parallel loop started here
+  // (1 without OpenMP, or if the loop can not be run in parallel
+  // because it is nested in another parallel region)
+  int get_nb_threads (void);
 }
 
 #endif
@@ -146,6 +146,111 @@ void SGTELIB::test_LOWESS_times ( void ){
 }//
 
 
+void SGTELIB::test_matrix_times ( void ){
+
+  std::cout << "====================================================================\n";
+  std::cout << "START MATRIX TIMES\n";
+
+  const int n   = 10;   // Input dimension
+  const int m   = 3;    // Nb of outputs
+  const int pxx = 1000; // Nb of prediction points
+  // The p x p matrices (distances within the training set, cholesky)
+  // are only built up to this size.
+  const int p_square_max = 5000;
+
+  const int NP = 5;
+  const int P[NP] = { 1000 , 2000 , 5000 , 10000 , 20000 };
+
+  int clock_start;
+  double t;
+
+  SGTELIB::Matrix XX ("XX",pxx,n);
+  SGTELIB::Matrix W  ("W",n,m);
+  XX.set_random(-5,+5,false);
+  W.set_random(-1,+1,false);
+
+  for (int ip=0 ; ip<NP ; ip++){
+    const int p = P[ip];
+    std::cout << "--------------------\n";
+    std::cout << "p=" << p << ", n=" << n << "\n";
+
+    SGTELIB::Matrix X ("X",p,n);
+    X.set_random(-5,+5,false);
+
+    // Product
+    clock_start = clock();
+    SGTELIB::Matrix Z = SGTELIB::Matrix::product(X,W);
+    t = double(clock() - clock_start)/double(CLOCKS_PER_SEC);
+    std::cout << "  product       (" << p << "x" << n << ")*(" << n << "x" << m << ") : " << t << "s\n";
+
+    // Transpose product
+    clock_start = clock();
+    SGTELIB::Matrix G = SGTELIB::Matrix::transposeA_product(X,X);
+    t = double(clock() - clock_start)/double(CLOCKS_PER_SEC);
+    std::cout << "  transposeA_product (" << n << "x" << p << ")*(" << p << "x" << n << ") : " << t << "s\n";
+
+    // Distances to the prediction points
+    clock_start = clock();
+    SGTELIB::Matrix DXX = SGTELIB::Matrix::get_distances_norm2(XX,X);
+    t = double(clock() - clock_start)/double(CLOCKS_PER_SEC);
+    std::cout << "  distances     (" << pxx << "x" << p << ") : " << t << "s\n";
+
+    // Kernel product, as in a prediction of RBF or Kriging
+    SGTELIB::Matrix A ("A",p,m);
+    A.set_random(-1,+1,false);
+    clock_start = clock();
+    SGTELIB::Matrix ZZ = SGTELIB::Matrix::product(DXX,A);
+    t = double(clock() - clock_start)/double(CLOCKS_PER_SEC);
+    std::cout << "  product       (" << pxx << "x" << p << ")*(" << p << "x" << m << ") : " << t << "s\n";
+
+    if (p>p_square_max){
+      std::cout << "  (p x p kernels skipped)\n";
+      continue;
+    }
+
+    // Distances within the training set
+    clock_start = clock();
+    SGTELIB::Matrix D = SGTELIB::Matrix::get_distances_norm2(X,X);
+    t = double(clock() - clock_start)/double(CLOCKS_PER_SEC);
+    std::cout << "  distances     (" << p << "x" << p << ") : " << t << "s\n";
+
+    // Gaussian kernel matrix (definite positive)
+    SGTELIB::Matrix K ("K",p,p);
+    for (int i=0 ; i<p ; i++){
+      for (int j=0 ; j<p ; j++){
+        K.set(i,j,exp(-D.get(i,j)*D.get(i,j)/n));
+      }
+      K.set(i,i,2.0);
+    }
+
+    // Cholesky
+    clock_start = clock();
+    SGTELIB::Matrix L = K.cholesky();
+    t = double(clock() - clock_start)/double(CLOCKS_PER_SEC);
+    std::cout << "  cholesky      (" << p << "x" << p << ") : " << t << "s\n";
+
+    // Triangular solve
+    SGTELIB::Matrix b ("b",p,1);
+    b.set_random(-1,+1,false);
+    clock_start = clock();
+    SGTELIB::Matrix y = SGTELIB::Matrix::tril_solve(L,b);
+    t = double(clock() - clock_start)/double(CLOCKS_PER_SEC);
+    std::cout << "  tril_solve    (" << p << "x" << p << ") : " << t << "s\n";
+
+    // Square product
+    clock_start = clock();
+    SGTELIB::Matrix KK = SGTELIB::Matrix::product(K,K);
+    t = double(clock() - clock_start)/double(CLOCKS_PER_SEC);
+    std::cout << "  product       (" << p << "x" << p << ")*(" << p << "x" << p << ") : " << t << "s\n";
+
+  }// end loop ip
+
+  std::cout << "FINISH MATRIX TIMES\n";
+  std::cout << "====================================================================\n";
+
+}//
+
+
 
 
 void SGTELIB::test_many_models (        const std::string & output_file ,
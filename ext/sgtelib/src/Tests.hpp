@@ -103,6 +103,10 @@ namespace SGTELIB {
 
   void test_LOWESS_times (void);
 
+  // test_matrix_times: time the matrix kernels (product, cholesky, triangular
+  // solve, distances) on training sets of 1000 to 20000 points.
+  void test_matrix_times (void);
+
   // analyse ensembl
   void analyse_ensemble ( const std::string & s );
 
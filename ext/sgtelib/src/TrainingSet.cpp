@@ -346,7 +346,9 @@ void SGTELIB::TrainingSet::build ( void ){
   }
 
   // _bbo is considered as defined. It can not be modified anymore.
-  _bbo_is_def = true;
+  // (Only written once, as build may be called concurrently by the models
+  // of an ensemble once the training set is ready.)
+  if ( ! _bbo_is_def) _bbo_is_def = true;
 
 }//
 
@@ -699,22 +701,15 @@ void SGTELIB::TrainingSet::compute_scaled_matrices ( void ){
 /*---------------------------------------------------*/
 void SGTELIB::TrainingSet::compute_Ds ( void ){
   double d;
-  double di1i2;
   _pvar = _p;
   _Ds_mean = 0.0;
   bool unique;
+  _Ds = Matrix::get_distances_norm2(_Xs,_Xs);
+  _Ds.set_name("TrainingSet._Ds");
   for ( int i1 = 0 ; i1 < _p-1 ; i1++ ){
-    _Ds.set(i1,i1,0.0);
     unique = true;
     for ( int i2 = i1+1 ; i2 < _p ; i2++ ){
-      d = 0;
-      for ( int j = 0 ; j < _n ; j++ ){
-        di1i2 = _Xs.get(i1,j)-_Xs.get(i2,j);
-        d += di1i2*di1i2;
-      }
-      d = sqrt(d);
-      _Ds.set(i1,i2,d);
-      _Ds.set(i2,i1,d);
+      d = _Ds.get(i1,i2);
       // Compute the mean distance between the points
       _Ds_mean += d;
       // If d==0, then the point i2 is not unique. 
@@ -72,6 +72,7 @@
 #include "Surrogate_Factory.hpp"
 #include "Surrogate_Utils.hpp"
 #include <fstream>
+#include <sstream>
 #include <string>
 using namespace SGTELIB;
 
@@ -91,6 +92,7 @@ int main ( int argc , char ** argv ) {
   keyword.push_back("-predict");
   keyword.push_back("-help");
   keyword.push_back("-test");
+  keyword.push_back("-benchmark");
   keyword.push_back("-server");
   keyword.push_back("-best");
 
@@ -122,6 +124,7 @@ int main ( int argc , char ** argv ) {
   //============================================
   keyword.push_back("-model");
   keyword.push_back("-verbose");
+  keyword.push_back("-socket");
   const int NKW = static_cast<int>(keyword.size());
   // Create empty strings to store the information following each keyword.
   std::vector<std::string> info;
@@ -243,7 +246,17 @@ int main ( int argc , char ** argv ) {
   //============================================ 
   if (!strcmp(action.c_str(),"-server")){
     std::cout << "model: " << model << "\n";
-    SGTELIB::sgtelib_server(model,verbose);
+    for (i=0 ; i<NKW ; i++) {
+      if (!strcmp(keyword.at(i).c_str(),"-socket")) break;
+    }
+    if (info.at(i).size()){
+      // Binary messages on a Unix-domain socket
+      SGTELIB::sgtelib_server_socket(model,info.at(i),verbose);
+    }
+    else{
+      // Flag files
+      SGTELIB::sgtelib_server(model,verbose);
+    }
   }
 
   //============================================ 
@@ -253,6 +266,13 @@ int main ( int argc , char ** argv ) {
     SGTELIB::sgtelib_test();
   }
 
+  //============================================ 
+  // benchmark
+  //============================================ 
+  if (!strcmp(action.c_str(),"-benchmark")){
+    SGTELIB::test_matrix_times();
+  }
+
   //std::cout << "Quit sgtelib.\n";
 
   return 0;
@@ -734,6 +754,191 @@ void SGTELIB::sgtelib_server( const std::string & model , const bool verbose ){
 
 
 
+/*--------------------------------------*/
+/*     sgtelib server (socket mode)     */
+/*--------------------------------------*/
+void SGTELIB::sgtelib_server_socket( const std::string & model ,
+                                     const std::string & path ,
+                                     const bool verbose ){
+
+  SGTELIB::TrainingSet * TS = NULL;
+  SGTELIB::Surrogate * S = NULL;
+  int m = 0;
+  const bool display = verbose;
+
+  std::cout << "========== SERVER ==========================\n";  
+  std::cout << "Start server on socket " << path << "\n";
+  const int listen_fd = SGTELIB::server_listen(path);
+  std::cout << "Ok.\n";
+
+  bool quit = false;
+  while ( ! quit){
+
+    // Wait for a client
+    const int fd = SGTELIB::server_accept(listen_fd);
+    if (fd<0) break;
+    if (display) std::cout << "Client connected\n";
+
+    SGTELIB::Server_Message request, answer;
+    while ( ! quit){
+
+      try{
+        if ( ! SGTELIB::server_receive(fd,request)) break;
+      }
+      catch (const std::exception & e){
+        std::cout << e.what() << "\n";
+        break;
+      }
+
+      answer = SGTELIB::Server_Message(SGTELIB::SERVER_NOT_READY);
+      try{
+        switch (request.code){
+
+          case SGTELIB::SERVER_NEW_DATA:
+          {
+            //------------------------------
+            // NEW DATA
+            //------------------------------
+            if (request.matrices.size()!=2){
+              throw SGTELIB::Exception ( __FILE__ , __LINE__ , "new data: X and Z are expected" );
+            }
+            const SGTELIB::Matrix & X = request.matrices[0];
+            const SGTELIB::Matrix & Z = request.matrices[1];
+            std::cout << "============new_data===================\n";
+            std::cout << X.get_nb_rows() << " new data points...\n";
+            if ( ! S){
+              if (display) std::cout << "First data: Build Trainig Set & Model\n";
+              TS = new SGTELIB::TrainingSet(X,Z);
+              S = Surrogate_Factory(*TS,model);
+              m = TS->get_output_dim();
+            }
+            else{
+              if (display) std::cout << "Add points to TS\n";
+              TS->add_points(X,Z);
+            }
+            break;
+          }
+
+          case SGTELIB::SERVER_PREDICT:
+          {
+            //------------------------------
+            // PREDICT
+            //------------------------------
+            if (request.matrices.size()!=1){
+              throw SGTELIB::Exception ( __FILE__ , __LINE__ , "predict: XX is expected" );
+            }
+            if (display) std::cout << "============predict==================\n";
+            const SGTELIB::Matrix & X = request.matrices[0];
+            const int pxx = X.get_nb_rows();
+            SGTELIB::Matrix Z ("Z",pxx,m), std ("std",pxx,m), ei ("ei",pxx,m), cdf ("cdf",pxx,m);
+            if (S && S->build()){
+              S->predict(X,&Z,&std,&ei,&cdf);
+              answer.code = SGTELIB::SERVER_READY;
+            }
+            else{
+              if (display) std::cout << "Surrogate not ready\n";
+              Z.fill(+SGTELIB::INF);
+            }
+            answer.matrices.push_back(Z);
+            answer.matrices.push_back(std);
+            answer.matrices.push_back(ei);
+            answer.matrices.push_back(cdf);
+            break;
+          }
+
+          case SGTELIB::SERVER_CV:
+            //------------------------------
+            // CV values
+            //------------------------------
+            if (display) std::cout << "============cv values==================\n";
+            if (S && S->build()){
+              answer.code = SGTELIB::SERVER_READY;
+              answer.matrices.push_back(S->get_matrix_Zh());
+              answer.matrices.push_back(S->get_matrix_Sh());
+              answer.matrices.push_back(S->get_matrix_Zv());
+              answer.matrices.push_back(S->get_matrix_Sv());
+            }
+            break;
+
+          case SGTELIB::SERVER_METRIC:
+            //------------------------------
+            // METRIC
+            //------------------------------
+            if (display) std::cout << "============metric: " << request.text << "\n";
+            if (S && S->build()){
+              answer.code = SGTELIB::SERVER_READY;
+              answer.matrices.push_back(S->get_metric(SGTELIB::str_to_metric_type(request.text)));
+            }
+            break;
+
+          case SGTELIB::SERVER_INFO:
+            //------------------------------
+            // INFO
+            //------------------------------
+            if (S && S->build()){
+              std::ostringstream oss;
+              S->display(oss);
+              answer.code = SGTELIB::SERVER_READY;
+              answer.text = oss.str();
+            }
+            else{
+              answer.text = "Not ready.";
+            }
+            break;
+
+          case SGTELIB::SERVER_RESET:
+            //------------------------------
+            // RESET
+            //------------------------------
+            std::cout << "============reset======================\n";
+            surrogate_delete(S);
+            delete TS;
+            TS = NULL;
+            S = NULL;
+            break;
+
+          case SGTELIB::SERVER_PING:
+            //------------------------------
+            // PING
+            //------------------------------
+            if (S && S->build()) answer.code = SGTELIB::SERVER_READY;
+            if (display) std::cout << "pong: " << ((answer.code==SGTELIB::SERVER_READY)?"ready":"not ready") << "\n";
+            break;
+
+          case SGTELIB::SERVER_QUIT:
+            //------------------------------
+            // QUIT
+            //------------------------------
+            std::cout << "quit\n";
+            quit = true;
+            break;
+
+          default:
+            throw SGTELIB::Exception ( __FILE__ , __LINE__ , "unknown request" );
+        }
+      }
+      catch (const std::exception & e){
+        answer = SGTELIB::Server_Message(SGTELIB::SERVER_ERROR);
+        answer.text = e.what();
+      }
+
+      if ( ! SGTELIB::server_send(fd,answer)) break;
+    }
+
+    if (display) std::cout << "Client disconnected\n";
+    SGTELIB::server_close(fd);
+  }
+
+  surrogate_delete(S);
+  delete TS;
+  SGTELIB::server_close(listen_fd,path);
+  std::cout << "Quit server\n";
+
+}//
+
+
+
+
 /*--------------------------------------*/
 /*           help                       */
 /*--------------------------------------*/
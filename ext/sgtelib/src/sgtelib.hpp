@@ -79,10 +79,12 @@
 #include "Matrix.hpp"
 #include "Defines.hpp"
 #include "Surrogate_Utils.hpp"
+#include "Server_Socket.hpp"
 #include "sgtelib_help.hpp"
 
 namespace SGTELIB {
   void sgtelib_server ( const std::string & model , const bool verbose );
+  void sgtelib_server_socket ( const std::string & model , const std::string & path , const bool verbose );
   void sgtelib_predict ( const std::string & file_list , const std::string & model );
   void sgtelib_best    ( const std::string & file_list , const bool verbose );
   void sgtelib_help ( std::string word="GENERAL" );
@@ -97,7 +97,7 @@ std::string ** SGTELIB::get_help_data (void){
   HELP_DATA[i][1] = "GENERAL MAIN SGTELIB HELP";
   HELP_DATA[i][2] = "sgtelib is a dynamic surrogate modeling library. Given a set of data points [X,z(X)], it allows to estimate the value of z(x) for any x.\n"
 " \n"
-"sgtelib can be called in 5 modes  \n"
+"sgtelib can be called in 6 modes  \n"
 " * -predict: build a model on a set of data points and perform a prediction on a set of prediction points. See PREDICT for more information. This requires the definition of a model with the option -model, see MODEL.\n"
 "      sgtelib.exe -model <model description> -predict <input/output files>\n"
 "      sgtelib.exe -model TYPE PRS DEGREE 2 -predict x.txt z.txt xx.txt zz.txt\n"
@@ -105,6 +105,8 @@ std::string ** SGTELIB::get_help_data (void){
 " * -server: starts a server that can be interrogated to perform predictions or compute the error metric of a model. The server should be used via the Matlab interface (see SERVER). This requires the definition of a model with the option -model, see MODEL. \n"
 "      sgtelib.exe -server -model <model description>\n"
 "      sgtelib.exe -server -model TYPE LOWESS SHAPE_COEF OPTIM\n"
+"   With -socket, the server answers binary requests on a Unix-domain socket instead of flag files (see SERVER).\n"
+"      sgtelib.exe -server -socket <socket path> -model <model description>\n"
 " \n"
 " * -best: returns the best type of model for a set of data points\n"
 "      sgtelib.exe -best <x file name> <z file name>\n"
@@ -118,6 +120,9 @@ std::string ** SGTELIB::get_help_data (void){
 " \n"
 " * -test: runs a test of the sgtelib library.\n"
 "      sgtelib.exe -test\n"
+" \n"
+" * -benchmark: times the matrix computations of the sgtelib library.\n"
+"      sgtelib.exe -benchmark\n"
 " ";
   i++;
   //================================
@@ -148,9 +153,13 @@ std::string ** SGTELIB::get_help_data (void){
   HELP_DATA[i][0] = "SERVER";
   HELP_DATA[i][1] = "SERVER MATLAB SGTELIB";
   HELP_DATA[i][2] = "Starts a sgtelib server. See MATLAB_SERVER for more details.\n"
+"By default, the server and the client exchange flag files and text files in the working directory. "
+"With the option -socket, the server listens on a Unix-domain socket and exchanges binary matrices, "
+"which avoids the polling delay and the text conversions. The C++ client is the class SGTELIB::Server_Client (Server_Socket.hpp).\n"
 " \n"
 "Example\n"
-"      sgtelib.exe -server -model TYPE LOWESS DEGREE 1 KERNEL_SHAPE OPTIM";
+"      sgtelib.exe -server -model TYPE LOWESS DEGREE 1 KERNEL_SHAPE OPTIM\n"
+"      sgtelib.exe -server -socket /tmp/sgtelib.sock -model TYPE LOWESS DEGREE 1 KERNEL_SHAPE OPTIM";
   i++;
   //================================
   //      MODEL
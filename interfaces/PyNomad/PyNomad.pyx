@@ -10,6 +10,11 @@ from libcpp.vector cimport vector
 
 from cython.operator cimport dereference as deref
 
+cimport numpy as cnp
+import numpy as np
+
+cnp.import_array()
+
 
 def version():
     printPyNomadVersion()
@@ -36,7 +41,8 @@ def __doc__():
 # Define the interface function to perform optimization          
 # TODO: Show multiple best solutions, and show both feas and infeas solutions.
 # For now, we only show one best solution.
-def optimize(f, pX0, pLB, pUB, params):
+# With vectorized=True, f is called as f(X, BBO) on NumPy arrays (see usage()).
+def optimize(f, pX0, pLB, pUB, params, vectorized=False):
     cdef PyNomadEvalPoint uFeas = PyNomadEvalPoint()
     cdef PyNomadEvalPoint uInfeas = PyNomadEvalPoint()
     cdef int runStatus = 0
@@ -45,12 +51,15 @@ def optimize(f, pX0, pLB, pUB, params):
     cdef double fReturn = float("inf")
     cdef double hReturn = float("inf")
     xReturn = []
+    cdef CallbackA cbAPtr = NULL
+    if vectorized:
+        cbAPtr = cbA
     
     cdef size_t nbParams = len(params)
     for i in range(nbParams):
          params[i] = params[i].encode(u"ascii")
 
-    runStatus = runNomad(cb, cbL, <void*> f, <vector[double]&> pX0,
+    runStatus = runNomad(cb, cbL, cbAPtr, <void*> f, <vector[double]&> pX0,
                          <vector[double]&> pLB, <vector[double]&> pUB,
                          <vector[string]&> params,
                          uFeas.c_ep_ptr,
@@ -158,11 +167,13 @@ cdef class PyNomadBlock:
 cdef extern from "nomadCySimpleInterface.cpp":
     ctypedef int (*Callback)(void * apply, shared_ptr[EvalPoint] x, bool hasSgte, bool sgteEval)
     ctypedef vector[int] (*CallbackL)(void * apply, shared_ptr[Block] x, bool hasSgte, bool sgteEval)
+    ctypedef int (*CallbackA)(void * apply, const double * x, double * bbo, int * evalOk,
+                              size_t nbPoints, size_t n, size_t m)
     void printPyNomadVersion()
     void printPyNomadUsage()
     void printPyNomadInfo()
     void printNomadHelp(string about)
-    int runNomad(Callback cb, CallbackL cbL, void* apply, vector[double] &X0,
+    int runNomad(Callback cb, CallbackL cbL, CallbackA cbA, void* apply, vector[double] &X0,
                  vector[double] &LB, vector[double] &UB,
                  vector[string] &params,
                  shared_ptr[EvalPoint] &bestFeasSol,
@@ -186,3 +197,42 @@ cdef vector[int] cbL(void *f, shared_ptr[Block] block, bool hasSgte, bool sgteEv
     u.c_block_ptr = block
     return (<object>f)(u)
 
+
+# Define callback function for a block of points given as arrays.
+# X (nbPoints x n) and BBO (nbPoints x m) view NOMAD memory: no copy is made,
+# and the arrays must not be used after the call returns.
+cdef int cbA(void *f, const double *x, double *bbo, int *evalOk,
+             size_t nbPoints, size_t n, size_t m):
+    cdef cnp.npy_intp xDims[2]
+    cdef cnp.npy_intp bboDims[2]
+    cdef cnp.ndarray X
+    cdef cnp.ndarray BBO
+    cdef size_t k
+
+    xDims[0] = nbPoints
+    xDims[1] = n
+    bboDims[0] = nbPoints
+    bboDims[1] = m
+
+    try:
+        X = cnp.PyArray_SimpleNewFromData(2, xDims, cnp.NPY_DOUBLE, <void*> x)
+        cnp.PyArray_CLEARFLAGS(X, cnp.NPY_ARRAY_WRITEABLE)
+        BBO = cnp.PyArray_SimpleNewFromData(2, bboDims, cnp.NPY_DOUBLE, <void*> bbo)
+
+        ret = (<object>f)(X, BBO)
+
+        # A single value applies to all points.
+        if np.ndim(ret) == 0:
+            for k in range(nbPoints):
+                evalOk[k] = 1 if ret else 0
+        else:
+            for k in range(nbPoints):
+                evalOk[k] = 1 if ret[k] else 0
+    except Exception:
+        # The evaluations of the block are failed.
+        import traceback
+        traceback.print_exc()
+        for k in range(nbPoints):
+            evalOk[k] = 0
+
+    return 1
@@ -55,6 +55,7 @@
 #include "Param/AllParameters.hpp"
 
 #include <Python.h>
+#include <cmath>
 #include <signal.h>
 #include <stdio.h>
 #include <string.h>
@@ -67,6 +68,16 @@ typedef std::vector<int> (*CallbackL)(void * apply,
                                       std::shared_ptr<NOMAD::Block> block,
                                       bool hasSgte,
                                       bool sgteEval);
+// Array form: the nbPoints x n coordinates are given row by row in x, and the
+// callback fills the nbPoints x m outputs in bbo and the flags in evalOk.
+// The arrays are owned by NOMAD and are only valid during the call.
+typedef int (*CallbackA)(void * apply,
+                         const double * x,
+                         double * bbo,
+                         int * evalOk,
+                         size_t nbPoints,
+                         size_t n,
+                         size_t m);
 
 
 static void printPyNomadVersion()
@@ -162,6 +173,20 @@ static void printPyNomadUsage()
     std::cout << "         evalOk[k] = True"                                            << std::endl;
     std::cout << "     # return a list where 1 is success, 0 is a failed evaluation"    << std::endl;
     std::cout << "     return evalOk"                                                   << std::endl;
+    std::cout                                                                           << std::endl;
+    std::cout << " Form 3: The block of points is passed as NumPy arrays"               << std::endl;
+    std::cout << "         This form is used when PyNomad.optimize is called with"      << std::endl;
+    std::cout << "         vectorized=True. X is a read-only (nbPoints x n) array,"     << std::endl;
+    std::cout << "         and BBO is a (nbPoints x m) array to fill, m being the"      << std::endl;
+    std::cout << "         number of outputs in BB_OUTPUT_TYPE. Both arrays view"       << std::endl;
+    std::cout << "         NOMAD memory: they are only valid during the call."          << std::endl;
+    std::cout << "         The number of points is at most BB_MAX_BLOCK_SIZE."          << std::endl;
+    std::cout                                                                           << std::endl;
+    std::cout << " def bb_array(X, BBO):"                                               << std::endl;
+    std::cout << "     BBO[:, 0] = (X**2).sum(axis=1)"                                  << std::endl;
+    std::cout << "     # return True if all evaluations are successful, or"             << std::endl;
+    std::cout << "     # a list where 1 is success, 0 is a failed evaluation"           << std::endl;
+    std::cout << "     return True"                                                     << std::endl;
 
 
     std::cout                                                                           << std::endl;
@@ -204,6 +229,7 @@ class PyEval : public NOMAD::Evaluator
 private:
     Callback  _cb;
     CallbackL _cbL;
+    CallbackA _cbA;
     void*     _apply;
     bool      _hasSgte;
 
@@ -212,11 +238,13 @@ public:
     PyEval(std::shared_ptr<NOMAD::EvalParameters> evalParams,
            Callback cb,
            CallbackL cbL,
+           CallbackA cbA,
            void * apply,
            bool hasSgte = false)
       : NOMAD::Evaluator(evalParams),
         _cb(cb),
         _cbL(cbL),
+        _cbA(cbA),
         _apply(apply),
         _hasSgte(hasSgte)
     {
@@ -240,9 +268,14 @@ public:
         countEval.resize(nbPoints, false);
 
         // eval_block is always called.
+        // if cbA is not NULL, the block is passed as arrays.
         // if cbL is NULL, this means that the block must be of size 1, and that
         // cb should be used.
-        if (nullptr == _cbL)
+        if (nullptr != _cbA)
+        {
+            evalArray(block, evalOk, countEval);
+        }
+        else if (nullptr == _cbL)
         {
             NOMAD::EvalPointPtr x_ptr = block[0];
             PyGILState_STATE state = PyGILState_Ensure();
@@ -278,6 +311,60 @@ public:
         }
         return evalOk;
     }
+
+private:
+    // Evaluate the block with a single call to the array callback.
+    // The coordinates are copied into contiguous memory, and the outputs
+    // are set as numbers: no string is formatted nor parsed. The GIL is
+    // only held for the Python call.
+    void evalArray(NOMAD::Block &block,
+                   std::vector<bool> &evalOk,
+                   std::vector<bool> &countEval) const
+    {
+        const size_t nbPoints = block.size();
+        if (0 == nbPoints)
+        {
+            return;
+        }
+        const auto bbOutputTypeList = _evalParams->getAttributeValue<NOMAD::BBOutputTypeList>("BB_OUTPUT_TYPE");
+        const size_t n = block[0]->size();
+        const size_t m = bbOutputTypeList.size();
+
+        std::vector<double> x(nbPoints * n);
+        std::vector<double> bbo(nbPoints * m, NAN);
+        std::vector<int> cbaEvalOk(nbPoints, 0);
+
+        for (size_t k = 0; k < nbPoints; k++)
+        {
+            const NOMAD::EvalPoint &xk = *block[k];
+            for (size_t i = 0; i < n; i++)
+            {
+                x[k * n + i] = xk[i].isDefined() ? xk[i].todouble() : NAN;
+            }
+        }
+
+        PyGILState_STATE state = PyGILState_Ensure();
+        _cbA(_apply, x.data(), bbo.data(), cbaEvalOk.data(), nbPoints, n, m);
+        PyGILState_Release(state);
+
+        for (size_t k = 0; k < nbPoints; k++)
+        {
+            // A NaN output is left undefined, as a missing value in a string.
+            NOMAD::ArrayOfDouble bbok(m);
+            for (size_t j = 0; j < m; j++)
+            {
+                const double v = bbo[k * m + j];
+                if (!std::isnan(v))
+                {
+                    bbok[j] = v;
+                }
+            }
+            evalOk[k] = (0 != cbaEvalOk[k]);
+            NOMAD::BBOutput bbOutput(bbok, evalOk[k]);
+            block[k]->setBBO(bbOutput, bbOutputTypeList, NOMAD::EvalType::BB);
+            countEval[k] = true;   // Always true in Python
+        }
+    }
 };
 
 
@@ -395,6 +482,7 @@ static void initAllParams(std::shared_ptr<NOMAD::AllParameters> allParams,
 
 static int runNomad(Callback cb,
                     CallbackL cbL,
+                    CallbackA cbA,
                     void * apply,
                     std::vector<double> X0,
                     std::vector<double> LB,
@@ -420,7 +508,13 @@ static int runNomad(Callback cb,
 
         // Set cbL to NULL if blocks are not used.
         // Set cb to NULL if blocks are used.
-        if (allParams->getEvaluatorControlParams()->getAttributeValue<size_t>("BB_MAX_BLOCK_SIZE") > 1)
+        // cbA is not NULL only if arrays are used; it has precedence.
+        if (nullptr != cbA)
+        {
+            cb = nullptr;
+            cbL = nullptr;
+        }
+        else if (allParams->getEvaluatorControlParams()->getAttributeValue<size_t>("BB_MAX_BLOCK_SIZE") > 1)
         {
             // Using blocks
             cb = nullptr;
@@ -429,7 +523,7 @@ static int runNomad(Callback cb,
         {
             cbL = nullptr;
         }
-        std::unique_ptr<PyEval> ev(new PyEval(allParams->getEvalParams(), cb, cbL, apply));
+        std::unique_ptr<PyEval> ev(new PyEval(allParams->getEvalParams(), cb, cbL, cbA, apply));
         TheMainStep.setEvaluator(std::move(ev));
 
         TheMainStep.start();
@@ -0,0 +1,24 @@
+import PyNomad
+import numpy as np
+
+# This example is for a block passed as NumPy arrays.
+# X is a read-only (nbPoints x n) array with the points to evaluate, one per row.
+# BBO is a (nbPoints x m) array to fill with the blackbox outputs, in the order
+# of BB_OUTPUT_TYPE. Both arrays view NOMAD memory, they are not copied: they
+# must not be kept after the call returns.
+# A NaN output is considered as missing.
+def bb_array(X, BBO):
+    BBO[:, 0] = (X**2).sum(axis=1)
+    BBO[:, 1] = X[:, 0] - 0.5
+    return True # or a list where 1 is success, 0 is a failed evaluation
+
+x0 = [0.71, 0.51, 0.51]
+lb = [-1, -1, -1]
+ub=[]
+
+params =  ["BB_OUTPUT_TYPE OBJ PB", "MAX_BB_EVAL 100", "UPPER_BOUND * 1"]
+params += ["DISPLAY_DEGREE 2", "DISPLAY_STATS BBE BLK_SIZE OBJ", "DISPLAY_ALL_EVAL false"]
+params += ["NB_THREADS_OPENMP 1", "BB_MAX_BLOCK_SIZE 8"]
+
+[ x_return, f_return, h_return, nb_evals, nb_iters, stopflag ] = PyNomad.optimize(bb_array, x0, lb, ub, params, vectorized=True)
+print ("\n NOMAD outputs \n X_sol={} \n F_sol={} \n H_sol={} \n NB_evals={} \n NB_iters={} \n".format(x_return,f_return,h_return,nb_evals,nb_iters))
@@ -1,7 +1,7 @@
 from distutils.core import setup, Extension
 from Cython.Build import cythonize
 
-#import numpy as np
+import numpy as np
 import os
 import sys
 
@@ -22,6 +22,8 @@ else:
         print("A NOMAD_HOME environment variable is needed for building Nomad for Python (PyNomad)")
         exit()
     os_include_dirs = [str(os.environ.get("NOMAD_HOME")) + "/src"]
+    # Needed for the NumPy arrays of the vectorized blackbox
+    os_include_dirs.append(np.get_include())
 
 compile_args = []
 compile_args.append("-std=c++14")
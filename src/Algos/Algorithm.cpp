@@ -360,6 +360,7 @@ void NOMAD::Algorithm::displayEvalCounts() const
     size_t sgteEval     = NOMAD::EvcInterface::getEvaluatorControl()->getSgteEval();
     size_t totalSgteEval = NOMAD::EvcInterface::getEvaluatorControl()->getTotalSgteEval();
     size_t nbCacheHits  = NOMAD::CacheBase::getNbCacheHits();
+    size_t nbEvicted    = NOMAD::CacheBase::getInstance()->getNbEvicted();
     int nbEvalNoCount   = static_cast<int>(nbEval - bbEval - nbCacheHits);
 
     // What needs to be shown, according to the counts and to the value of isSub
@@ -367,12 +368,13 @@ void NOMAD::Algorithm::displayEvalCounts() const
     bool showSgteEval       = isSub && (sgteEval > 0);
     bool showTotalSgteEval  = (totalSgteEval > 0);
     bool showNbCacheHits    = (nbCacheHits > 0);
+    bool showNbEvicted      = (nbEvicted > 0);
     bool showNbEval         = (nbEval > bbEval);
     bool showLapBbEval      = isSub && (bbEval > lapBbEval && lapBbEval > 0);
 
     // Padding for nice presentation
     std::string sFeedBbEval, sFeedLapBbEval, sFeedNbEvalNoCount, sFeedSgteEval,
-                sFeedTotalSgteEval, sFeedCacheHits, sFeedNbEval;
+                sFeedTotalSgteEval, sFeedCacheHits, sFeedEvicted, sFeedNbEval;
 
     // Conditional values: showNbEval, showNbEvalNoCount, showLapBbEval
     if (showLapBbEval)  // Longest title
@@ -383,6 +385,7 @@ void NOMAD::Algorithm::displayEvalCounts() const
         sFeedSgteEval += "                     ";
         sFeedTotalSgteEval += "               ";
         sFeedCacheHits += "                           ";
+        sFeedEvicted += "                      ";
         sFeedNbEval += "          ";
     }
     else if (showNbEvalNoCount) // Second longest
@@ -393,6 +396,7 @@ void NOMAD::Algorithm::displayEvalCounts() const
         sFeedSgteEval += "                  ";
         sFeedTotalSgteEval += "            ";
         sFeedCacheHits += "                        ";
+        sFeedEvicted += "                   ";
         sFeedNbEval += "       ";
     }
     else if (showNbEval)    // 3rd longest title
@@ -403,6 +407,7 @@ void NOMAD::Algorithm::displayEvalCounts() const
         sFeedSgteEval += "           ";
         sFeedTotalSgteEval += "     ";
         sFeedCacheHits += "                 ";
+        sFeedEvicted += "            ";
         //sFeedNbEval += "";
     }
 
@@ -412,6 +417,8 @@ void NOMAD::Algorithm::displayEvalCounts() const
     std::string sSgteEval       = "Sgte evaluations: " + sFeedSgteEval + NOMAD::itos(sgteEval);
     std::string sTotalSgteEval  = "Total sgte evaluations: " + sFeedTotalSgteEval + NOMAD::itos(totalSgteEval);
     std::string sCacheHits      = "Cache hits: " + sFeedCacheHits + NOMAD::itos(nbCacheHits);
+    std::string sEvicted        = "Cache evictions: " + sFeedEvicted + NOMAD::itos(nbEvicted)
+                                  + " (" + NOMAD::itos(NOMAD::CacheBase::getInstance()->getNbEvictedReinserted()) + " inserted again)";
     std::string sNbEval         = "Total number of evaluations: " + sFeedNbEval + NOMAD::itos(nbEval);
     
     // Output levels will be modulated depending on the counts and on the Algorithm level.
@@ -444,6 +451,10 @@ void NOMAD::Algorithm::displayEvalCounts() const
     {
         AddOutputInfo(sCacheHits, outputLevelNormal);
     }
+    if (showNbEvicted)
+    {
+        AddOutputInfo(sEvicted, outputLevelNormal);
+    }
     if (showNbEval)
     {
         AddOutputInfo(sNbEval, outputLevelNormal);
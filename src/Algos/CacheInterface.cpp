@@ -112,6 +112,18 @@ size_t NOMAD::CacheInterface::find(bool (*crit)(const NOMAD::EvalPoint&),
 }
 
 
+size_t NOMAD::CacheInterface::findEvaluatedSince(size_t &generation,
+                                                 bool (*crit)(const NOMAD::EvalPoint&),
+                                                 std::vector<NOMAD::EvalPoint> &evalPointList) const
+{
+    NOMAD::CacheBase::getInstance()->findEvaluatedSince(generation, crit, evalPointList);
+
+    convertPointListToSub(evalPointList, _step->getSubFixedVariable());
+
+    return evalPointList.size();
+}
+
+
 size_t NOMAD::CacheInterface::getAllPoints(std::vector<NOMAD::EvalPoint> &evalPointList) const
 {
     NOMAD::CacheBase::getInstance()->getAllPoints(evalPointList);
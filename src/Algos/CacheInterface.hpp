@@ -129,6 +129,17 @@ public:
     size_t find(bool (*crit)(const EvalPoint&),
                 std::vector<EvalPoint> &evalPointList) const;
 
+    /// Find points evaluated since a generation of the cache, fulfilling a criteria
+    /**
+     \param generation    The generation of the previous call. Updated to the current generation -- \b IN/OUT
+     \param crit          The criteria function (function of EvalPoint) -- \b IN
+     \param evalPointList The vector of EvalPoints found -- \b OUT
+     \return              The number of points found
+    */
+    size_t findEvaluatedSince(size_t &generation,
+                              bool (*crit)(const EvalPoint&),
+                              std::vector<EvalPoint> &evalPointList) const;
+
     /// Get all points from the cache
     /**
      \param evalPointList The vector of EvalPoints -- \b OUT
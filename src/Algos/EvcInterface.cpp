@@ -165,9 +165,12 @@ void NOMAD::EvcInterface::keepPointsThatNeedEval(const NOMAD::EvalPointSet &tria
             evalQueuePoint->setGenStep(_step->getName());
 
             _evaluatorControl->addToQueue(evalQueuePoint);
-            _step->AddOutputDebug("New point added to eval queue: " + trialPoint.display());
+            if (NOMAD::OutputQueue::GoodLevel(NOMAD::OutputLevel::LEVEL_DEBUG))
+            {
+                _step->AddOutputDebug("New point added to eval queue: " + trialPoint.display());
+            }
         }
-        else
+        else if (NOMAD::OutputQueue::GoodLevel(NOMAD::OutputLevel::LEVEL_DEBUG))
         {
             // Cache hit
             _step->AddOutputDebug("Point already found in cache: " + trialPoint.display());
@@ -221,7 +224,7 @@ void NOMAD::EvcInterface::setBarrier(const std::shared_ptr<NOMAD::Barrier>& subB
 
 // When points are generated and added to queue,
 // we can start evaluation.
-NOMAD::SuccessType NOMAD::EvcInterface::startEvaluation()
+NOMAD::SuccessType NOMAD::EvcInterface::startEvaluation(const bool allowAsyncEval)
 {
     _step->AddOutputInfo("Evaluate points for " + _step->getName(), true, false);
 
@@ -231,7 +234,7 @@ NOMAD::SuccessType NOMAD::EvcInterface::startEvaluation()
     if ( ! stopReasons->checkTerminate() )
     {
         // Evaluate points
-        success = _evaluatorControl->run();
+        success = _evaluatorControl->run(allowAsyncEval);
     }
 
     std::string s = _step->getName() + ": " + NOMAD::enumStr(success);
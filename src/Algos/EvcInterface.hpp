@@ -119,8 +119,10 @@ public:
 
     /**
      When points are generated and added to queue, we can start evaluation.
+     \param allowAsyncEval  If ASYNC_EVAL is true, return without waiting for
+                            the evaluations in progress -- \b IN.
      */
-    SuccessType startEvaluation();
+    SuccessType startEvaluation(const bool allowAsyncEval = false);
 
     /// Evaluate a single point.
     /**
@@ -235,7 +235,7 @@ void NOMAD::IterationUtils::verifyPointsAreOnMesh(const std::string& name)
 }
 
 
-bool NOMAD::IterationUtils::evalTrialPoints(NOMAD::Step *step)
+bool NOMAD::IterationUtils::evalTrialPoints(NOMAD::Step *step, const bool allowAsyncEval)
 {
 
     
@@ -262,7 +262,7 @@ bool NOMAD::IterationUtils::evalTrialPoints(NOMAD::Step *step)
 
     if (_nbEvalPointsThatNeedEval > 0)
     {
-        _success = evcInterface.startEvaluation();
+        _success = evcInterface.startEvaluation(allowAsyncEval);
 
         if (_success >= NOMAD::SuccessType::PARTIAL_SUCCESS)
         {
@@ -382,6 +382,7 @@ void NOMAD::IterationUtils::updatePointsWithFrameCenter()
     // to it consistently later.
     auto fixedVariable = _parentStep->getSubFixedVariable();
     std::shared_ptr<NOMAD::Point> frameCenterFull = std::make_shared<NOMAD::Point>(frameCenter->getX()->makeFullSpacePointFromFixed(fixedVariable));
+    const bool doDisplay = NOMAD::OutputQueue::GoodLevel(NOMAD::OutputLevel::LEVEL_DEBUG);
 
     for (auto it = _trialPoints.begin(); it != _trialPoints.end(); it++)
     {
@@ -394,11 +395,14 @@ void NOMAD::IterationUtils::updatePointsWithFrameCenter()
         evalPoint->setPointFrom(frameCenterFull);
 
         // Debug info
-        std::string s = "Set pointFrom of point ";
-        s += evalPoint->getX()->display();
-        s += " to ";
-        s += (nullptr == frameCenterFull) ? "NULL" : frameCenterFull->display();
-        _parentStep->AddOutputDebug(s);
+        if (doDisplay)
+        {
+            std::string s = "Set pointFrom of point ";
+            s += evalPoint->getX()->display();
+            s += " to ";
+            s += (nullptr == frameCenterFull) ? "NULL" : frameCenterFull->display();
+            _parentStep->AddOutputDebug(s);
+        }
     }
 }
 
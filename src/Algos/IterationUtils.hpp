@@ -176,8 +176,10 @@ public:
     /**
      Called by run.
      \note Complete the documentation
+     \param step            The step generating the points -- \b IN.
+     \param allowAsyncEval  If ASYNC_EVAL is true, do not wait for the evaluations in progress -- \b IN.
      */
-    bool evalTrialPoints(Step * step);
+    bool evalTrialPoints(Step * step, const bool allowAsyncEval = false);
 
     /// Get the number of evaluation points in the queue for evaluation
     size_t getNbEvalPointsThatNeededEval() const { return _nbEvalPointsThatNeedEval ; }
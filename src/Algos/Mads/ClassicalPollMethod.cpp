@@ -14,9 +14,8 @@ void NOMAD::ClassicalPollMethod::init()
 }
 
 // Generate poll directions
-void NOMAD::ClassicalPollMethod::setPollDirections(std::list<NOMAD::Direction> &directions) const
+void NOMAD::ClassicalPollMethod::setPollDirections(NOMAD::PointBatch &directions) const
 {
-    directions.clear();
     size_t n = _pbParams->getAttributeValue<size_t>("DIMENSION");
 
     NOMAD::Direction dirUnit(n, 0.0);
@@ -28,28 +27,16 @@ void NOMAD::ClassicalPollMethod::setPollDirections(std::list<NOMAD::Direction> &
     }
 
     // Ortho MADS 2n
-    // Householder Matrix
-    NOMAD::Direction** H = new NOMAD::Direction*[2*n];
-    std::list<NOMAD::Direction> dirsUnit;
-
-    // Ordering D_k alternates Hk and -Hk instead of [H_k -H_k]
-    // VRM a revoir avec le livre, pour les notations.
-    for (size_t i = 0; i < n; ++i)
-    {
-        dirsUnit.push_back(NOMAD::Direction(n, 0.0));
-        H[i]   = &(*(--dirsUnit.end())); // VRM I don't know, I just work here
-        dirsUnit.push_back(NOMAD::Direction(n, 0.0));
-        H[i+n] = &(*(--dirsUnit.end()));
-    }
+    // Householder Matrix: H[i] and H[i+n] = -H[i].
+    std::vector<NOMAD::Direction> H(2*n, NOMAD::Direction(n, 0.0));
 
     // Householder transformations on the 2n directions on a unit n-sphere
     // VRM: Revoir la theorie pour Householder et pour Poll.
     householder(dirUnit, true, H);
-    delete [] H;
 
     // Scale the directions and project on the mesh
-    std::list<NOMAD::Direction>::const_iterator itDir;
-    int k = 1;
+    // Ordering D_k alternates Hk and -Hk instead of [H_k -H_k]
+    // VRM a revoir avec le livre, pour les notations.
     std::shared_ptr<NOMAD::MeshBase> mesh = getIterationMesh();
     if (nullptr == mesh)
     {
@@ -57,13 +44,14 @@ void NOMAD::ClassicalPollMethod::setPollDirections(std::list<NOMAD::Direction> &
         throw NOMAD::Exception(__FILE__, __LINE__, err);
     }
 
-    for (itDir = dirsUnit.begin(); itDir != dirsUnit.end(); ++itDir, ++k)
+    directions = NOMAD::PointBatch(2*n, n);
+    for (size_t k = 0; k < 2*n; ++k)
     {
-        directions.push_back(NOMAD::Direction(n, 0.0));
-        NOMAD::Direction* pd = &(*(--directions.end()));    // VRM he's doing it again
+        const NOMAD::Direction& dirUnitK = H[(k % 2 == 0) ? k / 2 : k / 2 + n];
+        NOMAD::Double* pd = directions.getCoordinates(k);
 
-        // Compute infinite norm for direction pointed by itDir.
-        NOMAD::Double infiniteNorm = (*itDir).infiniteNorm();
+        // Compute infinite norm for direction dirUnitK.
+        NOMAD::Double infiniteNorm = dirUnitK.infiniteNorm();
         if (0 == infiniteNorm)
         {
             std::string err("ClassicalPoll: setPollDirections: Cannot handle an infinite norm of zero");
@@ -73,17 +61,17 @@ void NOMAD::ClassicalPollMethod::setPollDirections(std::list<NOMAD::Direction> &
         for (size_t i = 0; i < n; ++i)
         {
             // Scaling and projection on the mesh
-            (*pd)[i] = mesh->scaleAndProjectOnMesh(i, (*itDir)[i] / infiniteNorm);
+            pd[i] = mesh->scaleAndProjectOnMesh(i, dirUnitK[i] / infiniteNorm);
         }
     }
 
-    std::list<NOMAD::Direction>::const_iterator it;
-    for (it = directions.begin(); it != directions.end(); ++it)
+    if (NOMAD::OutputQueue::GoodLevel(NOMAD::OutputLevel::LEVEL_DEBUG))
     {
-        AddOutputDebug("Poll direction: " + it->display());
+        for (size_t k = 0; k < directions.size(); ++k)
+        {
+            AddOutputDebug("Poll direction: " + NOMAD::Direction(directions.getPoint(k)).display());
+        }
     }
-
-    dirsUnit.clear();
 }
 
 
@@ -93,66 +81,11 @@ void NOMAD::ClassicalPollMethod::generateTrialPoints()
     AddOutputInfo("Generate points for " + _name, true, false);
     
     // Creation of the poll directions
-    std::list<NOMAD::Direction> directions;
+    NOMAD::PointBatch directions;
     setPollDirections(directions);
     
-    size_t n = _pbParams->getAttributeValue<size_t>("DIMENSION");
-    
-    // We need a poll center to start with.
-    auto pollCenter = getIterationFrameCenter();
-    if (nullptr == pollCenter || !pollCenter->ArrayOfDouble::isDefined() || pollCenter->size() != n)
-    {
-        std::string err("NOMAD::ClassicalPoll::generateTrialPoints: invalid poll center: ");
-        if (nullptr != pollCenter)
-        {
-            err += pollCenter->display();
-        }
-        throw NOMAD::Exception(__FILE__, __LINE__, err);
-    }
-    
-    AddOutputDebug("Poll center: " + pollCenter->display());
-    
-    for (std::list<NOMAD::Direction>::iterator it = directions.begin(); it != directions.end() ; ++it)
-    {
-        NOMAD::Point pt(n);
-        
-        // pt = poll center + direction
-        for (size_t i = 0 ; i < n ; ++i )
-        {
-            pt[i] = (*pollCenter)[i] + (*it)[i];
-        }
-        
-        // Snap the points and the corresponding direction to the bounds
-        pt.snapToBounds(_pbParams->getAttributeValue<NOMAD::ArrayOfDouble>("LOWER_BOUND"),
-                        _pbParams->getAttributeValue<NOMAD::ArrayOfDouble>("UPPER_BOUND"),
-                        *pollCenter,
-                        getIterationMesh()->getdeltaMeshSize());
-        
-        if (!getIterationMesh()->verifyPointIsOnMesh(pt, *pollCenter))
-        {
-            auto ptdebug = pt;
-            pt = getIterationMesh()->projectOnMesh(pt, *pollCenter);
-            if (ptdebug != pt)
-            {
-                AddOutputWarning("Warning: " + ptdebug.display() + " projected to " + pt.display());
-            }
-        }
-        
-        if (pt != *pollCenter->getX())
-        {
-            // New EvalPoint to be evaluated.
-            // Add it to the list.
-            bool inserted = insertTrialPoint(NOMAD::EvalPoint(pt));
-            
-            std::string s = "Generated point";
-            s += (inserted) ? ": " : " not inserted: ";
-            s += pt.display();
-            AddOutputInfo(s);
-        }
-    }
-    
-    verifyPointsAreOnMesh(getName());
-    updatePointsWithFrameCenter();
+    // The directions become the trial points
+    generateTrialPointsFromDirections(directions);
     
     AddOutputInfo("Generated " + NOMAD::itos(getTrialPointsCount()) + " points");
     AddOutputInfo("Generate points for " + _name, false, true);
@@ -207,7 +140,7 @@ bool NOMAD::ClassicalPollMethod::computeDirOnUnitSphere(NOMAD::Direction &random
 /*----------------------------------------------------------------*/
 void NOMAD::ClassicalPollMethod::householder(const NOMAD::Direction &dir,
                               bool completeTo2n,
-                              NOMAD::Direction ** H) const
+                              std::vector<NOMAD::Direction> &H) const
 {
     size_t n = _pbParams->getAttributeValue<size_t>("DIMENSION");
 
@@ -220,12 +153,12 @@ void NOMAD::ClassicalPollMethod::householder(const NOMAD::Direction &dir,
         for (size_t j = 0 ; j < n ; ++j)
         {
             // H[i]:
-            (*H[i])[j] = v = (i == j) ? norm2 - h2i * dir[j] : - h2i * dir[j];
+            H[i][j] = v = (i == j) ? norm2 - h2i * dir[j] : - h2i * dir[j];
 
             // -H[i]:
             if ( completeTo2n )
             {
-                (*H[i+n])[j] = -v;
+                H[i+n][j] = -v;
             }
         }
     }
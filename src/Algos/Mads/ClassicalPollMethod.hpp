@@ -35,7 +35,7 @@ private:
     /**
      /param directions  The directions obtained for this poll -- \b OUT.
      */
-    void setPollDirections(std::list<NOMAD::Direction> &directions) const;
+    void setPollDirections(NOMAD::PointBatch &directions) const;
 
 
     /*------------------------*/
@@ -43,7 +43,7 @@ private:
     /*------------------------*/
     bool computeDirOnUnitSphere(NOMAD::Direction &randomDir) const;
 
-    void householder(const NOMAD::Direction &dir, bool completeTo2n, NOMAD::Direction ** H) const;
+    void householder(const NOMAD::Direction &dir, bool completeTo2n, std::vector<NOMAD::Direction> &H) const;
 
 
 };
@@ -123,10 +123,8 @@ std::list<NOMAD::Direction> NOMAD::EnrichedPollMethod::strategicalDirections() c
 }
 
 // Generate poll directions
-void NOMAD::EnrichedPollMethod::setPollDirections(std::list<NOMAD::Direction> &directions) const
+void NOMAD::EnrichedPollMethod::setPollDirections(NOMAD::PointBatch &directions) const
 {
-    directions.clear();
-    
     std::list<NOMAD::Direction> pollDirs = strategicalDirections(); // list of new directions, not necessarly unitary
     
     // Scale the directions and project on the mesh
@@ -138,12 +136,13 @@ void NOMAD::EnrichedPollMethod::setPollDirections(std::list<NOMAD::Direction> &d
         std::string err("Poll: setPollDirections: Iteration or Mesh not found.");
         throw NOMAD::Exception(__FILE__, __LINE__, err);
     }
+
+    directions = NOMAD::PointBatch(pollDirs.size(), n);
     NOMAD::Double frameLB = _runParams->getAttributeValue<NOMAD::Double>("FRAME_LB");
     NOMAD::Double frameUB = _runParams->getAttributeValue<NOMAD::Double>("FRAME_UB");
     for (itDir = pollDirs.begin(); itDir != pollDirs.end(); ++itDir, ++k)
     {
-        directions.push_back(NOMAD::Direction(n, 0.0));
-        NOMAD::Direction* pd = &(*(--directions.end()));    // VRM he's doing it again
+        NOMAD::Double* pd = directions.getCoordinates(k-1);
 
         // Compute infinite norm for direction pointed by itDir.
         NOMAD::Double infiniteNorm = (*itDir).infiniteNorm();
@@ -158,15 +157,17 @@ void NOMAD::EnrichedPollMethod::setPollDirections(std::list<NOMAD::Direction> &d
         for (size_t i = 0; i < n; ++i)
         {
             // Scaling and projection on the mesh
-            (*pd)[i] = mesh->scaleAndProjectOnMesh(i, ((*itDir)[i] / infiniteNorm)*FrameCoeff);
+            pd[i] = mesh->scaleAndProjectOnMesh(i, ((*itDir)[i] / infiniteNorm)*FrameCoeff);
             // this projection is made as in the article about grannular variables so every dirction is on the frame when no coeff multiplicates infinite norm
         }
     }
 
-    std::list<NOMAD::Direction>::const_iterator it;
-    for (it = directions.begin(); it != directions.end(); ++it)
+    if (NOMAD::OutputQueue::GoodLevel(NOMAD::OutputLevel::LEVEL_DEBUG))
     {
-        AddOutputDebug("Poll direction: " + it->display());
+        for (size_t kd = 0; kd < directions.size(); ++kd)
+        {
+            AddOutputDebug("Poll direction: " + NOMAD::Direction(directions.getPoint(kd)).display());
+        }
     }
 
     pollDirs.clear();
@@ -177,67 +178,13 @@ void NOMAD::EnrichedPollMethod::generateTrialPoints()
 {
     AddOutputInfo("Generate points for " + _name, true, false);
 
-    NOMAD::EvalPointSet trialPoints;
-
-    // We need a frame center to start with.
-    auto pollCenter = getIterationFrameCenter();
-    if (nullptr == pollCenter || !pollCenter->ArrayOfDouble::isDefined() || pollCenter->size() != n)
-    {
-        std::string err("NOMAD::Poll::generateTrialPoints: invalid poll center: ");
-        if (nullptr != pollCenter)
-        {
-            err += pollCenter->display();
-        }
-        throw NOMAD::Exception(__FILE__, __LINE__, err);
-    }
-
-    AddOutputDebug("Poll center: " + pollCenter->display());
-
-    //addDirectionToPollCenter(*pollCenter,trialPoints); // creates y_j = x_k + d_j and store them in the set trial points 
-    std::list<NOMAD::Direction> directions;
+    // Creation of the poll directions
+    NOMAD::PointBatch directions;
     setPollDirections(directions);
-    
-    for (std::list<NOMAD::Direction>::iterator it = directions.begin(); it != directions.end() ; ++it)
-    {
-        NOMAD::Point pt(n);
-        
-        // pt = poll center + direction
-        for (size_t i = 0 ; i < n ; ++i )
-        {
-            pt[i] = (*pollCenter)[i] + (*it)[i];
-        }
-        
-        // Snap the points and the corresponding direction to the bounds
-        pt.snapToBounds(_pbParams->getAttributeValue<NOMAD::ArrayOfDouble>("LOWER_BOUND"),
-                        _pbParams->getAttributeValue<NOMAD::ArrayOfDouble>("UPPER_BOUND"),
-                        *pollCenter,
-                        getIterationMesh()->getdeltaMeshSize());
-
-        if (!getIterationMesh()->verifyPointIsOnMesh(pt, *pollCenter))
-        {
-            auto ptdebug = pt;
-            pt = getIterationMesh()->projectOnMesh(pt, *pollCenter);
-            if (ptdebug != pt)
-            {
-                AddOutputWarning("Warning: " + ptdebug.display() + " projected to " + pt.display());
-            }
-        }
 
-        if (pt != *pollCenter->getX())
-        {
-            // New EvalPoint to be evaluated.
-            // Add it to the list.
-            bool inserted = insertTrialPoint(NOMAD::EvalPoint(pt));
-            
-            std::string s = "Generated point";
-            s += (inserted) ? ": " : " not inserted: ";
-            s += pt.display();
-            AddOutputInfo(s);
-        }
-    }
-    verifyPointsAreOnMesh(getName());
-    updatePointsWithFrameCenter();
-    
+    // The directions become the trial points
+    generateTrialPointsFromDirections(directions);
+
     AddOutputInfo("Generated " + NOMAD::itos(getTrialPointsCount()) + " points");
     AddOutputInfo("Generate points for " + _name, false, true);
     
@@ -61,6 +61,14 @@ void NOMAD::GMesh::init()
         throw NOMAD::Exception(__FILE__, __LINE__, "Expecting mesh minimum size to be fully defined.");
     }
 
+    _deltaMeshSize.reset(_n);
+    _DeltaFrameSize.reset(_n);
+    _rho.reset(_n);
+    for (size_t i = 0 ; i < _n ; i++)
+    {
+        updateMeshSizes(i);
+    }
+
     // Sanity checks
     if (_enforceSanityChecks)
     {
@@ -190,6 +198,7 @@ bool NOMAD::GMesh::enlargeDeltaFrameSize(const NOMAD::Direction& direction,
                 _frameSizeMant[i] = 1;
                 ++_frameSizeExp[i];
             }
+            updateMeshSizes(i);
             frameSizeIChanged = true;
             oneFrameSizeChanged = true;
         }
@@ -226,6 +235,7 @@ void NOMAD::GMesh::refineDeltaFrameSize()
             // We can go lower
             _frameSizeMant[i] = frameSizeMant;
             _frameSizeExp[i] = frameSizeExp;
+            updateMeshSizes(i);
         }
 
         // Sanity checks
@@ -334,44 +344,64 @@ int NOMAD::GMesh::roundFrameSizeMant(const NOMAD::Double &mant)
 
 
 /*--------------------------------------------------------------*/
-/*  get rho (ratio frame/mesh size)                              */
-/*       rho^k = 10^(b^k-|b^k-b_0^k|)                           */
+/*  update delta, Delta and rho for variable i                  */
 /*--------------------------------------------------------------*/
-NOMAD::Double NOMAD::GMesh::getRho(size_t i) const
+void NOMAD::GMesh::updateMeshSizes(const size_t i)
 {
-    NOMAD::Double rho;
+    // delta (mesh size parameter)
+    //      delta^k = 10^(b^k-|b^k-b_0^k|)
+    //      if (granularity > 0)
+    //          delta^k = granularity * max (1.0, delta^k )
+    // If delta is under min mesh size, use min mesh size.
+    NOMAD::Double deltai = getdeltaMeshSize(_frameSizeExp[i], _initFrameSizeExp[i], _granularity[i]);
+
+    if (deltai < _minMeshSize[i])
+    {
+        deltai = _minMeshSize[i];
+    }
+    _deltaMeshSize[i] = deltai;
+
+    // Delta (frame size parameter)
+    //      Delta^k = a^k *10^{b^k}
+    NOMAD::Double dMinGran = 1.0;
+
+    if (_granularity[i] > 0)
+    {
+        dMinGran = _granularity[i];
+    }
+
+    _DeltaFrameSize[i] = dMinGran * _frameSizeMant[i] * pow(10, _frameSizeExp[i].todouble());
+
+    // rho (ratio frame/mesh size)
+    //      rho^k = 10^(b^k-|b^k-b_0^k|)
     NOMAD::Double diff = _frameSizeExp[i] - _initFrameSizeExp[i];
     NOMAD::Double powDiff = pow(10.0, diff.abs().todouble());
     if (_granularity[i] > 0)
     {
-        rho = _frameSizeMant[i] * NOMAD::min(pow(10.0, _frameSizeExp[i].todouble()), powDiff);
+        _rho[i] = _frameSizeMant[i] * NOMAD::min(pow(10.0, _frameSizeExp[i].todouble()), powDiff);
     }
     else
     {
-        rho = _frameSizeMant[i] * powDiff;
+        _rho[i] = _frameSizeMant[i] * powDiff;
     }
+}
+
 
-    return rho;
+/*--------------------------------------------------------------*/
+/*  get rho (ratio frame/mesh size)                              */
+/*--------------------------------------------------------------*/
+NOMAD::Double NOMAD::GMesh::getRho(size_t i) const
+{
+    return _rho[i];
 }
 
 
 /*--------------------------------------------------------------*/
 /*  get delta (mesh size parameter)                             */
-/*       delta^k = 10^(b^k-|b^k-b_0^k|)                         */
-/*       if (granularity > 0)                                   */
-/*           delta^k = granularity * max (1.0, delta^k )        */
 /*--------------------------------------------------------------*/
-// If delta is under min mesh size, return min mesh size.
 NOMAD::Double NOMAD::GMesh::getdeltaMeshSize(size_t i) const
 {
-    NOMAD::Double deltai = getdeltaMeshSize(_frameSizeExp[i], _initFrameSizeExp[i], _granularity[i]);
-
-    if (deltai < _minMeshSize[i])
-    {
-        deltai = _minMeshSize[i];
-    }
-
-    return deltai;
+    return _deltaMeshSize[i];
 }
 
 
@@ -395,32 +425,22 @@ NOMAD::Double NOMAD::GMesh::getdeltaMeshSize(const NOMAD::Double frameSizeExp,
 
 NOMAD::ArrayOfDouble NOMAD::GMesh::getdeltaMeshSize() const
 {
-    return MeshBase::getdeltaMeshSize();
+    return _deltaMeshSize;
 }
 
 
 /*--------------------------------------------------------------*/
 /*  get Delta_i  (frame size parameter)                          */
-/*       Delta^k = a^k *10^{b^k}                                */
 /*--------------------------------------------------------------*/
 NOMAD::Double NOMAD::GMesh::getDeltaFrameSize(const size_t i) const
 {
-    NOMAD::Double dMinGran = 1.0;
-
-    if (_granularity[i] > 0)
-    {
-        dMinGran = _granularity[i];
-    }
-
-    NOMAD::Double Delta = dMinGran * _frameSizeMant[i] * pow(10, _frameSizeExp[i].todouble());
-
-    return Delta;
+    return _DeltaFrameSize[i];
 }
 
 
 NOMAD::ArrayOfDouble NOMAD::GMesh::getDeltaFrameSize() const
 {
-    return MeshBase::getDeltaFrameSize();
+    return _DeltaFrameSize;
 }
 
 
@@ -463,6 +483,7 @@ void NOMAD::GMesh::setDeltas(const size_t i,
     _frameSizeExp[i] = roundFrameSizeExp(e);
     NOMAD::Double mant = deltaFrameSize / (gran * pow(10, _frameSizeExp[i].todouble()));
     _frameSizeMant[i] = roundFrameSizeMant(mant);
+    updateMeshSizes(i);
 
     // Sanity checks
     if (_enforceSanityChecks)
@@ -580,7 +601,7 @@ NOMAD::Double NOMAD::GMesh::scaleAndProjectOnMesh(size_t i, const NOMAD::Double
 {
     const NOMAD::Double delta = getdeltaMeshSize(i);
 
-    if (i < _n && _frameSizeMant.isDefined() && _frameSizeExp.isDefined() && delta.isDefined())
+    if (i < _n && _frameSizeMant[i].isDefined() && _frameSizeExp[i].isDefined() && delta.isDefined())
     {
         NOMAD::Double d = getRho(i) * l;
         return d.roundd() * delta;
@@ -629,90 +650,165 @@ NOMAD::Point NOMAD::GMesh::projectOnMesh(const NOMAD::Point& point,
 {
     // Projection on the mesh
     NOMAD::Point proj = point;
-    auto delta = getdeltaMeshSize();
-    // To avoid running around in circles
-    const size_t maxNbTry = 10;
 
     for (size_t i = 0; i < point.size(); ++i)
     {
-        const NOMAD::Double deltaI = delta[i];
+        const NOMAD::Double deltaI = _deltaMeshSize[i];
         bool frameCenterIsOnMesh = (frameCenter[i].isMultipleOf(deltaI));
 
-        // Value which will be used in verifyPointIsOnMesh
-        NOMAD::Double verifValueI = (frameCenterIsOnMesh) ? proj[i]
-                                           : proj[i] - frameCenter[i];
-
-        // Force verifValueI to be a multiple of deltaI.
-        // nbTry = 0 means point is already on mesh.
-        // nbTry = 1 means the projection worked.
-        // nbTry > 1 means the process went hacky by forcing the value to work
-        // for verifyPointIsOnMesh.
-        size_t nbTry = 0;   // Limit on the number of tries
-        while (!verifValueI.isMultipleOf(deltaI) && nbTry <= maxNbTry)
+        if (!projectOnMesh(proj[i], deltaI, frameCenter[i], frameCenterIsOnMesh))
         {
-            NOMAD::Double newVerifValueI;
-            verifValueI = (verifValueI >= 0) ? verifValueI.nextMult(deltaI)
-                                             : - (-verifValueI).nextMult(deltaI);
+            // Some values are just ill-conditionned.
+            std::string s = "Warning: Could not project point (index " + std::to_string(i) + ") ";
+            s += point.display() + " on mesh " + _deltaMeshSize.display();
+            s += " with frame center " + frameCenter.display();
+            NOMAD::OutputInfo outputInfo("Mesh", s, NOMAD::OutputLevel::LEVEL_INFO);
+            NOMAD::OutputQueue::Add(std::move(outputInfo));
+        }
+    }
+
+
+    return proj;
+}
 
-            proj[i] = (frameCenterIsOnMesh) ? verifValueI
-                                            : verifValueI + frameCenter[i];
 
-            // Recompute verifValue for more precision
-            newVerifValueI = (frameCenterIsOnMesh) ? proj[i]
-                                                   : proj[i] - frameCenter[i];
+std::vector<size_t> NOMAD::GMesh::projectOnMesh(NOMAD::PointBatch& batch,
+                                                const NOMAD::Point& frameCenter) const
+{
+    std::vector<size_t> projectedIndexes;
+    const size_t n = batch.getDimension();
+    if (0 == batch.size())
+    {
+        return projectedIndexes;
+    }
+    if (n != _n || frameCenter.size() != _n)
+    {
+        std::string err = "projectOnMesh: Expecting dimension " + std::to_string(_n);
+        err += " for the points and the frame center, but dimensions are ";
+        err += std::to_string(n) + " and " + std::to_string(frameCenter.size()) + ".";
+        throw NOMAD::Exception(__FILE__, __LINE__, err);
+    }
 
-            nbTry++;
+    // The frame center does not change from one point to the other.
+    std::vector<NOMAD::Double> centerValues(n);
+    std::vector<bool> frameCenterIsOnMesh(n);
+    for (size_t i = 0; i < n; ++i)
+    {
+        centerValues[i] = frameCenter[i];
+        frameCenterIsOnMesh[i] = centerValues[i].isMultipleOf(_deltaMeshSize[i]);
+    }
 
-            // Special cases
-            while (newVerifValueI != verifValueI && nbTry <= maxNbTry)
-            {
-                if (verifValueI >= 0)
-                {
-                    verifValueI = NOMAD::max(verifValueI, newVerifValueI);
-                    verifValueI += NOMAD::DEFAULT_EPSILON;
-                    verifValueI = verifValueI.nextMult(deltaI);
-                }
-                else
-                {
-                    verifValueI = NOMAD::min(verifValueI, newVerifValueI);
-                    verifValueI -= NOMAD::DEFAULT_EPSILON;
-                    verifValueI = - (-verifValueI).nextMult(deltaI);
-                }
-
-                proj[i] = (frameCenterIsOnMesh) ? verifValueI
-                                               : verifValueI + frameCenter[i];
-
-                 // Recompute verifValue for more precision
-                newVerifValueI = (frameCenterIsOnMesh) ? proj[i]
-                                                       : proj[i] - frameCenter[i];
-
-                nbTry++;
-            }
+    for (size_t k = 0; k < batch.size(); ++k)
+    {
+        NOMAD::Double* x = batch.getCoordinates(k);
 
-            verifValueI = newVerifValueI;
+        // Same test as verifyPointIsOnMesh().
+        bool isOnMesh = true;
+        for (size_t i = 0; i < n && isOnMesh; ++i)
+        {
+            const NOMAD::Double verifValueI = (frameCenterIsOnMesh[i]) ? x[i] : x[i] - centerValues[i];
+            isOnMesh = verifValueI.isMultipleOf(_deltaMeshSize[i]);
         }
-
-        if (nbTry >= maxNbTry && !verifValueI.isMultipleOf(deltaI))
+        if (isOnMesh)
         {
-            // Some values are just ill-conditionned.
-            std::string s = "Warning: Could not project point (index " + std::to_string(i) + ") ";
-            s += point.display() + " on mesh " + delta.display();
-            s += " with frame center " + frameCenter.display();
-            NOMAD::OutputInfo outputInfo("Mesh", s, NOMAD::OutputLevel::LEVEL_INFO);
-            NOMAD::OutputQueue::Add(std::move(outputInfo));
+            continue;
+        }
 
-            // Revert proj to its original value,
-            // since the hack did not work.
-            proj[i] = point[i];
+        const NOMAD::Point point = batch.getPoint(k);
+        bool projected = false;
+        for (size_t i = 0; i < n; ++i)
+        {
+            if (!projectOnMesh(x[i], _deltaMeshSize[i], centerValues[i], frameCenterIsOnMesh[i]))
+            {
+                // Some values are just ill-conditionned.
+                std::string s = "Warning: Could not project point (index " + std::to_string(i) + ") ";
+                s += point.display() + " on mesh " + _deltaMeshSize.display();
+                s += " with frame center " + frameCenter.display();
+                NOMAD::OutputInfo outputInfo("Mesh", s, NOMAD::OutputLevel::LEVEL_INFO);
+                NOMAD::OutputQueue::Add(std::move(outputInfo));
+            }
+            projected = projected || (x[i] != point[i]);
+        }
+        if (projected)
+        {
+            projectedIndexes.push_back(k);
         }
     }
 
-
-    return proj;
+    return projectedIndexes;
 }
 
 
+bool NOMAD::GMesh::projectOnMesh(NOMAD::Double& value,
+                                 const NOMAD::Double& deltaI,
+                                 const NOMAD::Double& frameCenterI,
+                                 const bool frameCenterIsOnMesh) const
+{
+    const NOMAD::Double initValue = value;
+    // To avoid running around in circles
+    const size_t maxNbTry = 10;
+
+    // Value which will be used in verifyPointIsOnMesh
+    NOMAD::Double verifValueI = (frameCenterIsOnMesh) ? value
+                                       : value - frameCenterI;
+
+    // Force verifValueI to be a multiple of deltaI.
+    // nbTry = 0 means point is already on mesh.
+    // nbTry = 1 means the projection worked.
+    // nbTry > 1 means the process went hacky by forcing the value to work
+    // for verifyPointIsOnMesh.
+    size_t nbTry = 0;   // Limit on the number of tries
+    while (!verifValueI.isMultipleOf(deltaI) && nbTry <= maxNbTry)
+    {
+        NOMAD::Double newVerifValueI;
+        verifValueI = (verifValueI >= 0) ? verifValueI.nextMult(deltaI)
+                                         : - (-verifValueI).nextMult(deltaI);
 
+        value = (frameCenterIsOnMesh) ? verifValueI
+                                      : verifValueI + frameCenterI;
 
+        // Recompute verifValue for more precision
+        newVerifValueI = (frameCenterIsOnMesh) ? value
+                                               : value - frameCenterI;
 
+        nbTry++;
 
+        // Special cases
+        while (newVerifValueI != verifValueI && nbTry <= maxNbTry)
+        {
+            if (verifValueI >= 0)
+            {
+                verifValueI = NOMAD::max(verifValueI, newVerifValueI);
+                verifValueI += NOMAD::DEFAULT_EPSILON;
+                verifValueI = verifValueI.nextMult(deltaI);
+            }
+            else
+            {
+                verifValueI = NOMAD::min(verifValueI, newVerifValueI);
+                verifValueI -= NOMAD::DEFAULT_EPSILON;
+                verifValueI = - (-verifValueI).nextMult(deltaI);
+            }
+
+            value = (frameCenterIsOnMesh) ? verifValueI
+                                          : verifValueI + frameCenterI;
+
+             // Recompute verifValue for more precision
+            newVerifValueI = (frameCenterIsOnMesh) ? value
+                                                   : value - frameCenterI;
+
+            nbTry++;
+        }
+
+        verifValueI = newVerifValueI;
+    }
+
+    if (nbTry >= maxNbTry && !verifValueI.isMultipleOf(deltaI))
+    {
+        // Revert value to its original value,
+        // since the hack did not work.
+        value = initValue;
+        return false;
+    }
+
+    return true;
+}
@@ -76,6 +76,12 @@ class GMesh: public MeshBase
     const ArrayOfDouble  _granularity;  ///< The fixed granularity of the mesh
     bool                 _enforceSanityChecks;   ///< Should we enforce sanity checks?
 
+    // Mesh size, frame size and rho, computed from the frame size
+    // mantissa and exponent each time those change (see GMesh::updateMeshSizes).
+    ArrayOfDouble        _deltaMeshSize;  ///< The current mesh size (delta).
+    ArrayOfDouble        _DeltaFrameSize;  ///< The current frame size (Delta).
+    ArrayOfDouble        _rho;  ///< The current ratio frame size / mesh size.
+
 public:
 
     /// Constructor
@@ -88,7 +94,10 @@ public:
         _frameSizeMant(ArrayOfDouble()),
         _frameSizeExp(ArrayOfDouble()),
         _granularity(parameters->getAttributeValue<ArrayOfDouble>("GRANULARITY")),
-        _enforceSanityChecks(true)
+        _enforceSanityChecks(true),
+        _deltaMeshSize(ArrayOfDouble()),
+        _DeltaFrameSize(ArrayOfDouble()),
+        _rho(ArrayOfDouble())
     {
         init();
     }
@@ -145,7 +154,7 @@ public:
 
 
     Double getRho(const size_t i) const override;
-    ArrayOfDouble getRho() const override { return MeshBase::getRho(); }
+    ArrayOfDouble getRho() const override { return _rho; }
 
     ArrayOfDouble getdeltaMeshSize() const override;
     Double getdeltaMeshSize(const size_t i) const override;
@@ -155,6 +164,13 @@ private:
     Double getdeltaMeshSize(const Double frameSizeExp,
                                    const Double initFrameSizeExp,
                                    const Double granularity) const;
+
+    /// Update the mesh size, frame size and rho of a variable.
+    /**
+     Must be called every time the frame size mantissa or exponent of variable \c i changes. The getters then return the stored values, without calling pow() for each query.
+     \param i      The variable index -- \b IN.
+     */
+    void updateMeshSizes(const size_t i);
 public:
 
     //
@@ -202,8 +218,26 @@ public:
      */
     Point projectOnMesh(const Point& point, const Point& frameCenter) const override;
 
+    /**
+     \copydoc MeshBase::projectOnMesh(PointBatch&, const Point&) const
+     \note This implementation uses the stored mesh sizes and the same projection as GMesh::projectOnMesh(const Point&, const Point&) for each coordinate.
+     */
+    std::vector<size_t> projectOnMesh(PointBatch& batch, const Point& frameCenter) const override;
 
 private:
+    /// Helper for projectOnMesh(): project one coordinate.
+    /**
+     \param value                  The coordinate to project -- \b IN/OUT.
+     \param deltaI                 The mesh size for this coordinate -- \b IN.
+     \param frameCenterI           The frame center coordinate -- \b IN.
+     \param frameCenterIsOnMesh    If the frame center coordinate is a multiple of deltaI -- \b IN.
+     \return                       \c false if the projection failed. The value is then left unchanged.
+     */
+    bool projectOnMesh(Double& value,
+                       const Double& deltaI,
+                       const Double& frameCenterI,
+                       const bool frameCenterIsOnMesh) const;
+
     /// Helper for constructor.
     void init();
 
@@ -161,9 +161,12 @@ bool NOMAD::MadsUpdate::runImp()
         // and then the EvaluatorControl found a full success before 
         // Update is run.
         // For this reason, only test the boolean value success vs. failure.
+        // With asynchronous evaluations, late results of previous
+        // MegaIterations are also found in the cache: skip the test.
         const bool megaIterSuccessful = (megaIter->getSuccessType() >= NOMAD::SuccessType::PARTIAL_SUCCESS);
         const bool successful = (success >= NOMAD::SuccessType::PARTIAL_SUCCESS);
-        if (   (NOMAD::SuccessType::NOT_EVALUATED != megaIter->getSuccessType())
+        if (   !NOMAD::EvcInterface::getEvaluatorControl()->getAsyncEval()
+            && (NOMAD::SuccessType::NOT_EVALUATED != megaIter->getSuccessType())
             && (   (successful != megaIterSuccessful)
                 || (NOMAD::SuccessType::NOT_EVALUATED == success)) )
         {
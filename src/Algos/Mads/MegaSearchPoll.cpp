@@ -87,7 +87,7 @@ bool NOMAD::MegaSearchPoll::runImp()
 
     if ( ! _stopReasons->checkTerminate() )
     {
-        foundBetter = evalTrialPoints(this);
+        foundBetter = evalTrialPoints(this, true /* allowAsyncEval */);
     }
 
     // Update MegaIteration success type with best success found.
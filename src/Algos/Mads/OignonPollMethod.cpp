@@ -143,10 +143,8 @@ std::list<NOMAD::Direction> NOMAD::OignonPollMethod::strategicalDirections() con
 }
 
 // Generate poll directions
-void NOMAD::OignonPollMethod::setPollDirections(std::list<NOMAD::Direction> &directions) const
+void NOMAD::OignonPollMethod::setPollDirections(NOMAD::PointBatch &directions) const
 {
-    directions.clear();
-    
     std::list<NOMAD::Direction> pollDirs = strategicalDirections(); // list of new directions
     
     // Scale the directions and project on the mesh
@@ -158,10 +156,11 @@ void NOMAD::OignonPollMethod::setPollDirections(std::list<NOMAD::Direction> &dir
         throw NOMAD::Exception(__FILE__, __LINE__, err);
     }
 
+    directions = NOMAD::PointBatch(pollDirs.size(), n);
+
     for (auto itDir = pollDirs.begin(); itDir != pollDirs.end(); ++itDir, ++k)
     {
-        directions.push_back(NOMAD::Direction(n, 0.0));
-        NOMAD::Direction* pd = &(*(--directions.end()));    // VRM he's doing it again
+        NOMAD::Double* pd = directions.getCoordinates(k-1);
 
         // Compute infinite norm for direction pointed by itDir.
         
@@ -169,15 +168,17 @@ void NOMAD::OignonPollMethod::setPollDirections(std::list<NOMAD::Direction> &dir
         for (size_t i = 0; i < n; ++i)
         {
             // Scaling and projection on the mesh
-            (*pd)[i] = mesh->scaleAndProjectOnMesh(i, (*itDir)[i]);
+            pd[i] = mesh->scaleAndProjectOnMesh(i, (*itDir)[i]);
             // this projection is made as in the article about grannular variables so every dirction is on the frame when no coeff multiplicates infinite norm
         }
     }
 
-    std::list<NOMAD::Direction>::const_iterator it;
-    for (it = directions.begin(); it != directions.end(); ++it)
+    if (NOMAD::OutputQueue::GoodLevel(NOMAD::OutputLevel::LEVEL_DEBUG))
     {
-        AddOutputDebug("Poll direction: " + it->display());
+        for (size_t kd = 0; kd < directions.size(); ++kd)
+        {
+            AddOutputDebug("Poll direction: " + NOMAD::Direction(directions.getPoint(kd)).display());
+        }
     }
 
     pollDirs.clear();
@@ -188,67 +189,13 @@ void NOMAD::OignonPollMethod::generateTrialPoints()
 {
     AddOutputInfo("Generate points for " + _name, true, false);
 
-    NOMAD::EvalPointSet trialPoints;
-
-    // We need a frame center to start with.
-    auto pollCenter = getIterationFrameCenter();
-    if (nullptr == pollCenter || !pollCenter->ArrayOfDouble::isDefined() || pollCenter->size() != n)
-    {
-        std::string err("NOMAD::Poll::generateTrialPoints: invalid poll center: ");
-        if (nullptr != pollCenter)
-        {
-            err += pollCenter->display();
-        }
-        throw NOMAD::Exception(__FILE__, __LINE__, err);
-    }
-
-    AddOutputDebug("Poll center: " + pollCenter->display());
-
-    //addDirectionToPollCenter(*pollCenter,trialPoints); // creates y_j = x_k + d_j and store them in the set trial points 
-    std::list<NOMAD::Direction> directions;
+    // Creation of the poll directions
+    NOMAD::PointBatch directions;
     setPollDirections(directions);
-    
-    for (std::list<NOMAD::Direction>::iterator it = directions.begin(); it != directions.end() ; ++it)
-    {
-        NOMAD::Point pt(n);
-        
-        // pt = poll center + direction
-        for (size_t i = 0 ; i < n ; ++i )
-        {
-            pt[i] = (*pollCenter)[i] + (*it)[i];
-        }
-        
-        // Snap the points and the corresponding direction to the bounds
-        pt.snapToBounds(_pbParams->getAttributeValue<NOMAD::ArrayOfDouble>("LOWER_BOUND"),
-                        _pbParams->getAttributeValue<NOMAD::ArrayOfDouble>("UPPER_BOUND"),
-                        *pollCenter,
-                        getIterationMesh()->getdeltaMeshSize());
 
-        if (!getIterationMesh()->verifyPointIsOnMesh(pt, *pollCenter))
-        {
-            auto ptdebug = pt;
-            pt = getIterationMesh()->projectOnMesh(pt, *pollCenter);
-            if (ptdebug != pt)
-            {
-                AddOutputWarning("Warning: " + ptdebug.display() + " projected to " + pt.display());
-            }
-        }
+    // The directions become the trial points
+    generateTrialPointsFromDirections(directions);
 
-        if (pt != *pollCenter->getX())
-        {
-            // New EvalPoint to be evaluated.
-            // Add it to the list.
-            bool inserted = insertTrialPoint(NOMAD::EvalPoint(pt));
-            
-            std::string s = "Generated point";
-            s += (inserted) ? ": " : " not inserted: ";
-            s += pt.display();
-            AddOutputInfo(s);
-        }
-    }
-    verifyPointsAreOnMesh(getName());
-    updatePointsWithFrameCenter();
-    
     AddOutputInfo("Generated " + NOMAD::itos(getTrialPointsCount()) + " points");
     AddOutputInfo("Generate points for " + _name, false, true);
     
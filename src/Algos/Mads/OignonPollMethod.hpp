@@ -48,7 +48,7 @@ private:
 
     std::list<NOMAD::Direction> strategicalDirections() const;
 
-    void setPollDirections(std::list<NOMAD::Direction> &directions) const;
+    void setPollDirections(NOMAD::PointBatch &directions) const;
 
     size_t n;// dimension
 
@@ -38,7 +38,7 @@ bool NOMAD::PollMethod::runImp()
         // Show more information in the form of an AlgoComment.
         NOMAD::MainStep::setAlgoComment(getComment());
 
-        foundBetter = evalTrialPoints(this);
+        foundBetter = evalTrialPoints(this, true /* allowAsyncEval */);
         NOMAD::MainStep::resetPreviousAlgoComment();
 
     }
@@ -47,6 +47,78 @@ bool NOMAD::PollMethod::runImp()
 }
 
 
+void NOMAD::PollMethod::generateTrialPointsFromDirections(NOMAD::PointBatch &batch)
+{
+    size_t n = _pbParams->getAttributeValue<size_t>("DIMENSION");
+
+    // We need a poll center to start with.
+    auto pollCenter = getIterationFrameCenter();
+    if (nullptr == pollCenter || !pollCenter->ArrayOfDouble::isDefined() || pollCenter->size() != n)
+    {
+        std::string err("NOMAD::PollMethod::generateTrialPointsFromDirections: invalid poll center: ");
+        if (nullptr != pollCenter)
+        {
+            err += pollCenter->display();
+        }
+        throw NOMAD::Exception(__FILE__, __LINE__, err);
+    }
+    AddOutputDebug("Poll center: " + pollCenter->display());
+
+    auto mesh = getIterationMesh();
+    if (nullptr == mesh)
+    {
+        std::string err("NOMAD::PollMethod::generateTrialPointsFromDirections: Iteration or Mesh not found.");
+        throw NOMAD::Exception(__FILE__, __LINE__, err);
+    }
+
+    // pt = poll center + direction
+    batch.add(*pollCenter);
+
+    // Snap the points and the corresponding direction to the bounds
+    batch.snapToBounds(_pbParams->getAttributeValue<NOMAD::ArrayOfDouble>("LOWER_BOUND"),
+                       _pbParams->getAttributeValue<NOMAD::ArrayOfDouble>("UPPER_BOUND"),
+                       *pollCenter,
+                       mesh->getdeltaMeshSize());
+
+    // Project on the mesh the points that are not on it
+    const bool displayProjection = NOMAD::OutputQueue::GoodLevel(NOMAD::OutputLevel::LEVEL_WARNING);
+    NOMAD::PointBatch batchBeforeProjection;
+    if (displayProjection)
+    {
+        batchBeforeProjection = batch;
+    }
+    auto projectedIndexes = mesh->projectOnMesh(batch, *pollCenter);
+    if (displayProjection)
+    {
+        for (auto k : projectedIndexes)
+        {
+            AddOutputWarning("Warning: " + batchBeforeProjection.getPoint(k).display() + " projected to " + batch.getPoint(k).display());
+        }
+    }
+
+    // The poll center is not a trial point. Remove it first, then the
+    // duplicates, as the trial points set would.
+    batch.removePoint(*pollCenter->getX());
+    batch.removeDuplicates();
+
+    // New EvalPoints to be evaluated.
+    // Add them to the list.
+    const bool doDisplay = NOMAD::OutputQueue::GoodLevel(NOMAD::OutputLevel::LEVEL_INFO);
+    for (size_t k = 0; k < batch.size(); k++)
+    {
+        bool inserted = insertTrialPoint(NOMAD::EvalPoint(batch.getPoint(k)));
+
+        if (doDisplay)
+        {
+            std::string s = "Generated point";
+            s += (inserted) ? ": " : " not inserted: ";
+            s += batch.getPoint(k).display();
+            AddOutputInfo(s);
+        }
+    }
+}
+
+
 void NOMAD::PollMethod::endImp()
 {
     // Compute hMax and update Barrier.
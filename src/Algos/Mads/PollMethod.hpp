@@ -44,6 +44,16 @@ public:
 protected:
     void init();
 
+    /// Generate the trial points from the poll directions
+    /**
+     The trial points are the poll center plus the directions. They are
+     snapped to the bounds and projected on the mesh as a batch. The poll
+     center and the duplicates are removed, and an EvalPoint is inserted in
+     the trial points for each remaining point.
+     \param batch  The poll directions, replaced by the trial points -- \b IN/OUT.
+     */
+    void generateTrialPointsFromDirections(PointBatch &batch);
+
 };
 
 #include "../../nomad_nsend.hpp"
@@ -84,7 +84,7 @@ bool NOMAD::SearchMethod::runImp()
         // Show more information in the form of an AlgoComment.
         NOMAD::MainStep::setAlgoComment(getComment());
 
-        foundBetter = evalTrialPoints(this);
+        foundBetter = evalTrialPoints(this, true /* allowAsyncEval */);
         NOMAD::MainStep::resetPreviousAlgoComment();
 
     }
@@ -51,6 +51,7 @@
  \date   June 2018
  */
 #include "../Cache/CacheSet.hpp"
+#include "../Cache/CacheShardedSet.hpp"
 
 // Generic
 #include "../Algos/CacheInterface.hpp"
@@ -477,7 +478,7 @@ bool NOMAD::MainStep::detectPhaseOne()
 // Helper for start
 void NOMAD::MainStep::createCache() const
 {
-    // Creation of an instance of CacheSet with CacheParameters
+    // Creation of an instance of CacheSet or CacheShardedSet with CacheParameters
     // This must be done ONCE before accessing the singleton using NOMAD::CacheBase::getInstance()
     try
     {
@@ -485,8 +486,16 @@ void NOMAD::MainStep::createCache() const
     }
     catch (...)
     {
-        NOMAD::CacheSet::setInstance(_allParams->getCacheParams(),
-                                     _allParams->getAttributeValue<NOMAD::BBOutputTypeList>("BB_OUTPUT_TYPE"));
+        auto cacheParams = _allParams->getCacheParams();
+        auto bbOutputType = _allParams->getAttributeValue<NOMAD::BBOutputTypeList>("BB_OUTPUT_TYPE");
+        if (cacheParams->getAttributeValue<size_t>("CACHE_NB_SHARDS") > 1)
+        {
+            NOMAD::CacheShardedSet::setInstance(cacheParams, bbOutputType);
+        }
+        else
+        {
+            NOMAD::CacheSet::setInstance(cacheParams, bbOutputType);
+        }
     }
 }
 
@@ -551,7 +560,8 @@ void NOMAD::MainStep::displayUsage( const char* exeName )
       + "Info           : " + strExeName + " -i\n" \
       + "Help           : " + strExeName + " -h [keyword]\n" \
       + "Version        : " + strExeName + " -v\n" \
-      + "Usage          : " + strExeName + " -u\n\n";
+      + "Usage          : " + strExeName + " -u\n" \
+      + "Convert cache  : " + strExeName + " -c input_cache_file output_cache_file\n\n";
 
     // TODO          + "Developer help : " + strExeName + " -d keyword(s) (or 'all')\n"
 
@@ -135,6 +135,61 @@ NOMAD::Point NOMAD::MeshBase::projectOnMesh(const NOMAD::Point& point,
 }
 
 
+std::vector<size_t> NOMAD::MeshBase::projectOnMesh(NOMAD::PointBatch& batch,
+                                                   const NOMAD::Point& frameCenter) const
+{
+    std::vector<size_t> projectedIndexes;
+    const size_t n = batch.getDimension();
+    if (0 == batch.size())
+    {
+        return projectedIndexes;
+    }
+    if (n != _n || frameCenter.size() != _n)
+    {
+        std::string err = "projectOnMesh: Expecting dimension " + std::to_string(_n);
+        err += " for the points and the frame center, but dimensions are ";
+        err += std::to_string(n) + " and " + std::to_string(frameCenter.size()) + ".";
+        throw NOMAD::Exception(__FILE__, __LINE__, err);
+    }
+
+    // Same test as verifyPointIsOnMesh(), with the values that do not
+    // depend on the point computed once.
+    const NOMAD::ArrayOfDouble delta = getdeltaMeshSize();
+    std::vector<NOMAD::Double> deltaValues(n), centerValues(n);
+    std::vector<bool> rebase(n);
+    for (size_t i = 0; i < n; i++)
+    {
+        deltaValues[i] = delta[i];
+        centerValues[i] = frameCenter[i];
+        rebase[i] = !centerValues[i].isMultipleOf(deltaValues[i]);
+    }
+
+    for (size_t k = 0; k < batch.size(); k++)
+    {
+        const NOMAD::Double* x = batch.getCoordinates(k);
+        bool isOnMesh = true;
+        for (size_t i = 0; i < n && isOnMesh; i++)
+        {
+            const NOMAD::Double pointRebaseI = rebase[i] ? x[i] - centerValues[i] : x[i];
+            isOnMesh = pointRebaseI.isMultipleOf(deltaValues[i]);
+        }
+
+        if (!isOnMesh)
+        {
+            const NOMAD::Point point = batch.getPoint(k);
+            const NOMAD::Point proj = projectOnMesh(point, frameCenter);
+            batch.setPoint(k, proj);
+            if (proj != point)
+            {
+                projectedIndexes.push_back(k);
+            }
+        }
+    }
+
+    return projectedIndexes;
+}
+
+
 bool NOMAD::MeshBase::verifyPointIsOnMesh(const NOMAD::Point& point, const NOMAD::Point& center) const
 {
     bool isOnMesh = true;
@@ -60,6 +60,7 @@
 #include "../Math/ArrayOfDouble.hpp"
 #include "../Math/Direction.hpp"
 #include "../Math/Point.hpp"
+#include "../Math/PointBatch.hpp"
 
 #include "../Param/PbParameters.hpp"
 
@@ -228,6 +229,17 @@ public:
     /// Project the point on the mesh centered on frameCenter. No scaling.
     virtual Point projectOnMesh(const Point& point, const Point& frameCenter) const;
 
+    /// Project all the points of a batch on the mesh centered on frameCenter. No scaling.
+    /**
+     The mesh size is computed once for the whole batch. Only the points that
+     are not on the mesh (see verifyPointIsOnMesh()) are projected, with
+     projectOnMesh(const Point&, const Point&).
+     \param batch          The points to project -- \b IN/OUT.
+     \param frameCenter    The frame center -- \b IN.
+     \return               The indexes of the points modified by the projection.
+     */
+    virtual std::vector<size_t> projectOnMesh(PointBatch& batch, const Point& frameCenter) const;
+
     /// Verify if the point is on the mesh.
     /**
     \return     \c true if the point is on the mesh, false otherwise.
@@ -50,6 +50,7 @@
 #include "../../Algos/Iteration.hpp"
 #include "../../Algos/MeshBase.hpp"
 #include "../../Algos/NelderMead/NMSimplexEvalPoint.hpp"
+#include "../../Algos/NelderMead/NMSimplexFactorization.hpp"
 
 #include "../../nomad_nsbegin.hpp"
 
@@ -71,6 +72,11 @@ private:
      */
     std::shared_ptr<NMSimplexEvalPointSet> _nmY ;
 
+    /**
+     Factorization of the simplex, kept between iterations so that the rank, volume and diameter are updated when a vertex is replaced.
+     */
+    std::shared_ptr<NMSimplexFactorization> _nmYFactorization ;
+
     /**
      The simplex "center" at the creation of this iteration.
      The initial simplex is built around this point.
@@ -105,6 +111,7 @@ public:
 
         // Create an empty simplex to be shared among Nelder Mead components
         _nmY = std::make_shared<NMSimplexEvalPointSet>();
+        _nmYFactorization = std::make_shared<NMSimplexFactorization>();
     }
 
 
@@ -125,6 +132,8 @@ public:
 
     const std::shared_ptr<NMSimplexEvalPointSet> getY( void ) const { return _nmY; }
 
+    const std::shared_ptr<NMSimplexFactorization> getYFactorization( void ) const { return _nmYFactorization; }
+
 protected:
 
     /// Implementation of run task.
@@ -93,6 +93,18 @@ int NOMAD::NMIterationUtils::getRankDZ( ) const
     if ( nullptr == _nmY )
         NOMAD::Exception(__FILE__, __LINE__, "The iteration utils must have a simplex to work with");
     
+    // Complete simplex: the factorization gives the rank without an SVD
+    if ( nullptr != _nmYFactorization )
+    {
+        _nmYFactorization->update(*_nmY);
+        const int rank = _nmYFactorization->getRank(_rankEps.todouble());
+        if ( rank >= 0 )
+        {
+            NOMAD::OutputQueue::Add("The rank of DZ=[(y1-y0) (y2-y0) ... (yn-y0)] equals " + std::to_string(rank) + " (simplex factorization)", NOMAD::OutputLevel::LEVEL_DEBUG);
+            return rank;
+        }
+    }
+    
     // The dimension of DZ (k) is related to Y
     size_t k = _nmY->size() - 1 ;
     
@@ -149,6 +161,22 @@ void NOMAD::NMIterationUtils::updateYCharacteristics()
     if ( nullptr == _nmY )
         NOMAD::Exception(__FILE__, __LINE__, "The iteration utils must have a simplex to work with");
     
+    _simplexVon = -1;
+    _simplexVol = -1;
+    
+    // Complete simplex: the diameter and the determinant are maintained
+    // by the factorization when vertices are replaced
+    if ( nullptr != _nmYFactorization )
+    {
+        _nmYFactorization->update(*_nmY);
+        if ( _nmYFactorization->isValid() )
+        {
+            _simplexDiam = _nmYFactorization->getDiameter(_simplexDiamPt1, _simplexDiamPt2);
+            updateYVolumes(_nmYFactorization->getAbsDeterminant(), _nmY->size() - 1);
+            return;
+        }
+    }
+    
     // Update Y diameter
     // -----------------
     updateYDiameter();
@@ -156,9 +184,6 @@ void NOMAD::NMIterationUtils::updateYCharacteristics()
     
     // Update Y volumes
     // ----------------
-    _simplexVon = -1;
-    _simplexVol = -1;
-    
     std::set<NOMAD::EvalPoint>::iterator it1 = _nmY->begin();
     const size_t dim = (*it1).size();
     
@@ -202,9 +227,19 @@ void NOMAD::NMIterationUtils::updateYCharacteristics()
         delete [] V[i];
     delete [] V;
     
-    if ( success )
+    updateYVolumes( (success) ? fabs(det) : -1 , dim );
+    
+    return ;
+}
+
+
+/*---------------------------------------------------------*/
+/*---------------------------------------------------------*/
+void NOMAD::NMIterationUtils::updateYVolumes( double absDet, size_t dim )
+{
+    if ( absDet >= 0 )
     {
-        NOMAD::OutputQueue::Add("The determinant of the matrix: det( [(y1-y0) (y2-y0) ... (ynf-y0)] ) = " + std::to_string(det), NOMAD::OutputLevel::LEVEL_DEBUG);
+        NOMAD::OutputQueue::Add("The determinant of the matrix: |det( [(y1-y0) (y2-y0) ... (ynf-y0)] )| = " + std::to_string(absDet), NOMAD::OutputLevel::LEVEL_DEBUG);
         
         double nfact = 1;
 
@@ -214,7 +249,7 @@ void NOMAD::NMIterationUtils::updateYCharacteristics()
             nfact*=i;
         }
         
-        _simplexVol = fabs(det) / nfact;  // Use fact(n) for volume
+        _simplexVol = absDet / nfact;  // Use fact(n) for volume
         
         if ( _simplexDiam > 0 )
             _simplexVon = _simplexVol / pow(_simplexDiam,dim) ;
@@ -228,7 +263,6 @@ void NOMAD::NMIterationUtils::updateYCharacteristics()
     {
         NOMAD::OutputQueue::Add("Cannot get the volume of simplex Y because determinant failed. Continue", NOMAD::OutputLevel::LEVEL_DEBUG);
     }
-    return ;
 }
 
 
@@ -270,10 +304,14 @@ void NOMAD::NMIterationUtils::displayYInfo()const
     if ( nullptr == _nmY )
         NOMAD::Exception(__FILE__, __LINE__, "The iteration utils must have a simplex to work with");
     
-    NOMAD::OutputInfo dbgInfo("NM iteration utils", "", NOMAD::OutputLevel::LEVEL_DEBUG );
-    
     _parentStep->AddOutputInfo("Number of points in the simplex Y: " + std::to_string(_nmY->size()) );
     
+    // The simplex details are only built if they are displayed
+    if ( ! NOMAD::OutputQueue::GoodLevel(NOMAD::OutputLevel::LEVEL_DEBUG) )
+        return;
+    
+    NOMAD::OutputInfo dbgInfo("NM iteration utils", "", NOMAD::OutputLevel::LEVEL_DEBUG );
+    
     if ( _simplexVol > 0 )
         dbgInfo.addMsg("The volume of the simplex: " + std::to_string( _simplexVol ) );
     else
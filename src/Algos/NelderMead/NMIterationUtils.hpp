@@ -79,6 +79,8 @@ enum class NMStepType
  - Hold a variable NMIterationUtils::_currentStepType for ::NMStepType (phase of Nelder Mead algorithm).
  - Calculate the rank of DZ=[y_i-y_0] using eps as trigger (see ::getRank function)
 
+ When the simplex is complete, the rank, the volume and the diameter are obtained from the NMSimplexFactorization shared by the NM iteration, which is updated in O(n^2) when a vertex is replaced.
+
  */
 class NMIterationUtils : public IterationUtils
 {
@@ -92,6 +94,9 @@ private:
     /// Helper for NMIterationUtils::updateYCharacteristics
     void updateYDiameter ( void );
 
+    /// Helper for NMIterationUtils::updateYCharacteristics: volumes from |det([y_i-y_0])| (negative if not available)
+    void updateYVolumes ( double absDet, size_t dim );
+
 protected:
 
     /// The precision for the rank calculation. Default is ::DEFAULT_EPSILON.
@@ -102,6 +107,8 @@ protected:
 
     std::shared_ptr<NMSimplexEvalPointSet> _nmY;  ///< The Nelder Mead simplex.
 
+    std::shared_ptr<NMSimplexFactorization> _nmYFactorization; ///< Factorization of the simplex, updated when vertices are replaced.
+
     /// Update the simplex diameter and volumes from NMIterationUtils::_nmY
     void updateYCharacteristics ( void ) ;
 
@@ -135,11 +142,15 @@ public:
         _simplexDiamPt2(nullptr),
         _rankEps(DEFAULT_EPSILON),
         _currentStepType(NOMAD::NMStepType::UNSET),
-        _nmY(nullptr)
+        _nmY(nullptr),
+        _nmYFactorization(nullptr)
     {
         auto iter = dynamic_cast<const NMIteration*>(_iterAncestor);
         if ( nullptr != iter )
+        {
             _nmY = iter->getY();
+            _nmYFactorization = iter->getYFactorization();
+        }
     }
 
 
@@ -0,0 +1,374 @@
+/*---------------------------------------------------------------------------------*/
+/*  NOMAD - Nonlinear Optimization by Mesh Adaptive Direct Search -                */
+/*                                                                                 */
+/*  NOMAD - Version 4.0.0 has been created by                                      */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  The copyright of NOMAD - version 4.0.0 is owned by                             */
+/*                 Sebastien Le Digabel        - Polytechnique Montreal            */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  NOMAD v4 has been funded by Rio Tinto, Hydro-Québec, NSERC (Natural Science    */
+/*  and Engineering Research Council of Canada), INOVEE (Innovation en Energie     */
+/*  Electrique and IVADO (The Institute for Data Valorization)                     */
+/*                                                                                 */
+/*  NOMAD v3 was created and developed by Charles Audet, Sebastien Le Digabel,     */
+/*  Christophe Tribes and Viviane Rochon Montplaisir and was funded by AFOSR       */
+/*  and Exxon Mobil.                                                               */
+/*                                                                                 */
+/*  NOMAD v1 and v2 were created and developed by Mark Abramson, Charles Audet,    */
+/*  Gilles Couture, and John E. Dennis Jr., and were funded by AFOSR and           */
+/*  Exxon Mobil.                                                                   */
+/*                                                                                 */
+/*  Contact information:                                                           */
+/*    Polytechnique Montreal - GERAD                                               */
+/*    C.P. 6079, Succ. Centre-ville, Montreal (Quebec) H3C 3A7 Canada              */
+/*    e-mail: nomad@gerad.ca                                                       */
+/*    phone : 1-514-340-6053 #6928                                                 */
+/*    fax   : 1-514-340-5665                                                       */
+/*                                                                                 */
+/*  This program is free software: you can redistribute it and/or modify it        */
+/*  under the terms of the GNU Lesser General Public License as published by       */
+/*  the Free Software Foundation, either version 3 of the License, or (at your     */
+/*  option) any later version.                                                     */
+/*                                                                                 */
+/*  This program is distributed in the hope that it will be useful, but WITHOUT    */
+/*  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or          */
+/*  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License    */
+/*  for more details.                                                              */
+/*                                                                                 */
+/*  You should have received a copy of the GNU Lesser General Public License       */
+/*  along with this program. If not, see <http://www.gnu.org/licenses/>.           */
+/*                                                                                 */
+/*  You can find information on the NOMAD software at www.gerad.ca/nomad           */
+/*---------------------------------------------------------------------------------*/
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+
+#include "../../Algos/NelderMead/NMSimplexFactorization.hpp"
+
+
+/*---------------------------------------------------------*/
+/* Synchronize the slots with the simplex                  */
+/*---------------------------------------------------------*/
+void NOMAD::NMSimplexFactorization::update(const NOMAD::NMSimplexEvalPointSet & Y)
+{
+    if ( Y.empty() || Y.size() != Y.begin()->size() + 1 )
+    {
+        _valid = false;
+        return;
+    }
+
+    const size_t n = Y.begin()->size();
+    bool rebuild = ( ! _valid || n != _n );
+
+    // Find the vertices of Y already in a slot. A slot is matched by the
+    // address of the element of Y, then verified on the coordinates
+    // (an erased element can be replaced by a new one at the same address).
+    std::vector<bool> slotUsed(n+1, false);
+    std::vector<const NOMAD::EvalPoint*> newVertices;
+    if ( ! rebuild )
+    {
+        std::map<const NOMAD::EvalPoint*, size_t> slotOfVertex;
+        for ( size_t s = 0 ; s <= _n ; s++ )
+            slotOfVertex[_vertexPt[s]] = s;
+
+        for ( const auto & y : Y )
+        {
+            auto it = slotOfVertex.find(&y);
+            bool found = ( it != slotOfVertex.end() && ! slotUsed[it->second] );
+            if ( found )
+            {
+                const double * row = &_Y[it->second * _n];
+                for ( size_t j = 0 ; j < _n && found ; j++ )
+                    found = ( row[j] == y[j].todouble() );
+            }
+            if ( found )
+                slotUsed[it->second] = true;
+            else
+                newVertices.push_back(&y);
+        }
+
+        // A rank one update costs about 3n^2 operations and a refactorization
+        // about n^3: refactorize when many vertices have changed.
+        rebuild = ( newVertices.size() > std::max<size_t>(1, _n/4) );
+    }
+
+    if ( rebuild )
+    {
+        _n = n;
+        _Y.assign((_n+1)*_n, 0);
+        _vertexPt.assign(_n+1, nullptr);
+        _D2.assign((_n+1)*(_n+1), 0);
+        _valid = true;
+        _invertible = false;
+
+        size_t s = 0;
+        for ( const auto & y : Y )
+        {
+            replaceVertex(s, y);
+            s++;
+        }
+        refactorize();
+    }
+    else
+    {
+        bool updateOk = true;
+        size_t s = 0;
+        for ( auto y : newVertices )
+        {
+            while ( slotUsed[s] )
+                s++;
+            slotUsed[s] = true;
+            updateOk = replaceVertex(s, *y) && updateOk;
+        }
+
+        if ( ! updateOk || _nbUpdates >= _n )
+            refactorize();
+    }
+
+    updateDiameter();
+}
+
+
+/*---------------------------------------------------------*/
+/* Put a vertex in a slot                                  */
+/*---------------------------------------------------------*/
+bool NOMAD::NMSimplexFactorization::replaceVertex(const size_t slot, const NOMAD::EvalPoint & y)
+{
+    double * row = &_Y[slot * _n];
+
+    // Rank one update of M=[y_i-y_0]: M + u v^T
+    // - For slot i>0, the row i-1 of M changes: u = e_(i-1), v = y - y_i.
+    // - For slot 0, all the rows change: u = (1,...,1), v = y_0 - y.
+    bool updateOk = _invertible;
+    if ( updateOk )
+    {
+        std::vector<double> u(_n, 0), v(_n);
+        if ( slot > 0 )
+        {
+            u[slot-1] = 1;
+            for ( size_t j = 0 ; j < _n ; j++ )
+                v[j] = y[j].todouble() - row[j];
+        }
+        else
+        {
+            u.assign(_n, 1);
+            for ( size_t j = 0 ; j < _n ; j++ )
+                v[j] = row[j] - y[j].todouble();
+        }
+        updateOk = rankOneUpdate(u, v);
+        if ( ! updateOk )
+            _invertible = false;
+    }
+
+    for ( size_t j = 0 ; j < _n ; j++ )
+        row[j] = y[j].todouble();
+    _vertexPt[slot] = &y;
+
+    updateDistances(slot);
+
+    return updateOk;
+}
+
+
+/*---------------------------------------------------------*/
+/* Sherman-Morrison update of the inverse of M             */
+/*---------------------------------------------------------*/
+bool NOMAD::NMSimplexFactorization::rankOneUpdate(const std::vector<double> & u, const std::vector<double> & v)
+{
+    // (M + u v^T)^-1 = M^-1 - (M^-1 u)(v^T M^-1) / (1 + v^T M^-1 u)
+    // det(M + u v^T) = det(M) (1 + v^T M^-1 u)
+    std::vector<double> Bu(_n, 0), vB(_n, 0);
+    for ( size_t i = 0 ; i < _n ; i++ )
+    {
+        const double * Bi = &_Minv[i * _n];
+        double s = 0;
+        for ( size_t j = 0 ; j < _n ; j++ )
+            s += Bi[j] * u[j];
+        Bu[i] = s;
+
+        const double vi = v[i];
+        if ( vi != 0 )
+        {
+            for ( size_t j = 0 ; j < _n ; j++ )
+                vB[j] += vi * Bi[j];
+        }
+    }
+
+    double denom = 1;
+    for ( size_t i = 0 ; i < _n ; i++ )
+        denom += v[i] * Bu[i];
+
+    // The new matrix is (almost) singular relative to the previous one:
+    // the update would lose too many digits.
+    if ( std::fabs(denom) < 1E-6 )
+        return false;
+
+    for ( size_t i = 0 ; i < _n ; i++ )
+    {
+        double * Bi = &_Minv[i * _n];
+        const double c = Bu[i] / denom;
+        if ( c != 0 )
+        {
+            for ( size_t j = 0 ; j < _n ; j++ )
+                Bi[j] -= c * vB[j];
+        }
+    }
+    _det *= denom;
+    _nbUpdates++;
+
+    return true;
+}
+
+
+/*---------------------------------------------------------*/
+/* Inverse and determinant of M from the vertices          */
+/*---------------------------------------------------------*/
+void NOMAD::NMSimplexFactorization::refactorize()
+{
+    _nbUpdates = 0;
+    _invertible = false;
+    _det = 0;
+
+    // A = M, B = I. Gauss-Jordan elimination on [A | B] gives B = M^-1.
+    std::vector<double> A(_n * _n);
+    for ( size_t i = 0 ; i < _n ; i++ )
+        for ( size_t j = 0 ; j < _n ; j++ )
+            A[i * _n + j] = _Y[(i+1) * _n + j] - _Y[j];
+
+    _Minv.assign(_n * _n, 0);
+    for ( size_t i = 0 ; i < _n ; i++ )
+        _Minv[i * _n + i] = 1;
+
+    double det = 1;
+    for ( size_t k = 0 ; k < _n ; k++ )
+    {
+        // Partial pivoting
+        size_t p = k;
+        for ( size_t i = k+1 ; i < _n ; i++ )
+        {
+            if ( std::fabs(A[i * _n + k]) > std::fabs(A[p * _n + k]) )
+                p = i;
+        }
+        const double pivot = A[p * _n + k];
+        if ( pivot == 0 )
+            return; // M is singular
+
+        if ( p != k )
+        {
+            for ( size_t j = 0 ; j < _n ; j++ )
+            {
+                std::swap(A[p * _n + j], A[k * _n + j]);
+                std::swap(_Minv[p * _n + j], _Minv[k * _n + j]);
+            }
+            det = -det;
+        }
+        det *= pivot;
+
+        double * Ak = &A[k * _n];
+        double * Bk = &_Minv[k * _n];
+        for ( size_t j = 0 ; j < _n ; j++ )
+        {
+            Ak[j] /= pivot;
+            Bk[j] /= pivot;
+        }
+        for ( size_t i = 0 ; i < _n ; i++ )
+        {
+            const double c = A[i * _n + k];
+            if ( i == k || c == 0 )
+                continue;
+            double * Ai = &A[i * _n];
+            double * Bi = &_Minv[i * _n];
+            for ( size_t j = 0 ; j < _n ; j++ )
+            {
+                Ai[j] -= c * Ak[j];
+                Bi[j] -= c * Bk[j];
+            }
+        }
+    }
+
+    _det = det;
+    _invertible = true;
+}
+
+
+/*---------------------------------------------------------*/
+/* Distances of a vertex with the other vertices           */
+/*---------------------------------------------------------*/
+void NOMAD::NMSimplexFactorization::updateDistances(const size_t slot)
+{
+    const double * y = &_Y[slot * _n];
+    for ( size_t s = 0 ; s <= _n ; s++ )
+    {
+        const double * z = &_Y[s * _n];
+        double d2 = 0;
+        for ( size_t j = 0 ; j < _n ; j++ )
+            d2 += (y[j] - z[j]) * (y[j] - z[j]);
+        _D2[slot * (_n+1) + s] = d2;
+        _D2[s * (_n+1) + slot] = d2;
+    }
+}
+
+
+void NOMAD::NMSimplexFactorization::updateDiameter()
+{
+    double d2max = -1;
+    for ( size_t s1 = 0 ; s1 <= _n ; s1++ )
+    {
+        for ( size_t s2 = s1+1 ; s2 <= _n ; s2++ )
+        {
+            if ( _D2[s1 * (_n+1) + s2] > d2max )
+            {
+                d2max = _D2[s1 * (_n+1) + s2];
+                _diamSlot1 = s1;
+                _diamSlot2 = s2;
+            }
+        }
+    }
+}
+
+
+/*---------------------------------------------------------*/
+/* Simplex characteristics                                 */
+/*---------------------------------------------------------*/
+int NOMAD::NMSimplexFactorization::getRank(const double eps) const
+{
+    if ( ! _valid || ! _invertible )
+        return -1;
+
+    // The smallest singular value of M is 1/||M^-1||_2 >= 1/||M^-1||_F
+    double normF2 = 0;
+    for ( const auto & b : _Minv )
+        normF2 += b * b;
+
+    if ( normF2 > 0 && 1.0 / std::sqrt(normF2) > eps )
+        return static_cast<int>(_n);
+
+    return -1;
+}
+
+
+double NOMAD::NMSimplexFactorization::getAbsDeterminant() const
+{
+    if ( ! _valid )
+        return -1;
+    return std::fabs(_det);
+}
+
+
+double NOMAD::NMSimplexFactorization::getDiameter(const NOMAD::EvalPoint* & pt1, const NOMAD::EvalPoint* & pt2) const
+{
+    pt1 = nullptr;
+    pt2 = nullptr;
+    if ( ! _valid || _n == 0 )
+        return 0;
+
+    pt1 = _vertexPt[_diamSlot1];
+    pt2 = _vertexPt[_diamSlot2];
+    return std::sqrt(_D2[_diamSlot1 * (_n+1) + _diamSlot2]);
+}
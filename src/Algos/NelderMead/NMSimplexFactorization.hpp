@@ -0,0 +1,133 @@
+/*---------------------------------------------------------------------------------*/
+/*  NOMAD - Nonlinear Optimization by Mesh Adaptive Direct Search -                */
+/*                                                                                 */
+/*  NOMAD - Version 4.0.0 has been created by                                      */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  The copyright of NOMAD - version 4.0.0 is owned by                             */
+/*                 Sebastien Le Digabel        - Polytechnique Montreal            */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  NOMAD v4 has been funded by Rio Tinto, Hydro-Québec, NSERC (Natural Science    */
+/*  and Engineering Research Council of Canada), INOVEE (Innovation en Energie     */
+/*  Electrique and IVADO (The Institute for Data Valorization)                     */
+/*                                                                                 */
+/*  NOMAD v3 was created and developed by Charles Audet, Sebastien Le Digabel,     */
+/*  Christophe Tribes and Viviane Rochon Montplaisir and was funded by AFOSR       */
+/*  and Exxon Mobil.                                                               */
+/*                                                                                 */
+/*  NOMAD v1 and v2 were created and developed by Mark Abramson, Charles Audet,    */
+/*  Gilles Couture, and John E. Dennis Jr., and were funded by AFOSR and           */
+/*  Exxon Mobil.                                                                   */
+/*                                                                                 */
+/*  Contact information:                                                           */
+/*    Polytechnique Montreal - GERAD                                               */
+/*    C.P. 6079, Succ. Centre-ville, Montreal (Quebec) H3C 3A7 Canada              */
+/*    e-mail: nomad@gerad.ca                                                       */
+/*    phone : 1-514-340-6053 #6928                                                 */
+/*    fax   : 1-514-340-5665                                                       */
+/*                                                                                 */
+/*  This program is free software: you can redistribute it and/or modify it        */
+/*  under the terms of the GNU Lesser General Public License as published by       */
+/*  the Free Software Foundation, either version 3 of the License, or (at your     */
+/*  option) any later version.                                                     */
+/*                                                                                 */
+/*  This program is distributed in the hope that it will be useful, but WITHOUT    */
+/*  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or          */
+/*  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License    */
+/*  for more details.                                                              */
+/*                                                                                 */
+/*  You should have received a copy of the GNU Lesser General Public License       */
+/*  along with this program. If not, see <http://www.gnu.org/licenses/>.           */
+/*                                                                                 */
+/*  You can find information on the NOMAD software at www.gerad.ca/nomad           */
+/*---------------------------------------------------------------------------------*/
+#ifndef __NOMAD400_NMSIMPLEXFACTORIZATION__
+#define __NOMAD400_NMSIMPLEXFACTORIZATION__
+
+#include <vector>
+
+#include "../../Algos/NelderMead/NMSimplexEvalPoint.hpp"
+
+#include "../../nomad_nsbegin.hpp"
+
+/// Factorization of the Nelder Mead simplex, updated when vertices are replaced.
+/**
+ The n+1 vertices of the simplex are stored in a contiguous matrix, in a slot order that does not change when the simplex is reordered. The inverse and the determinant of M=[y_i-y_0] (i=1,...,n, y_0 is the vertex in slot 0) and the squared distances between vertices are kept.
+
+ Replacing a vertex is a rank one update of M: the inverse, the determinant and the distances are updated in O(n^2) instead of being recomputed in O(n^3). The factorization is recomputed from scratch when many vertices change at once (initialization, shrink), when an update is badly conditioned, and every n updates to limit the accumulation of rounding errors.
+
+ The determinant and the rank of [y_i-y_0] do not depend on the vertex chosen as y_0, so they can be used for the simplex ordered by NMSimplexEvalPointCompare.
+ */
+class NMSimplexFactorization
+{
+private:
+    size_t _n;                          ///< Dimension of the points. The simplex has _n+1 vertices.
+
+    std::vector<double> _Y;             ///< Vertices ((_n+1) x _n, row major, one row per slot).
+    std::vector<const EvalPoint*> _vertexPt; ///< Element of the simplex in each slot.
+    std::vector<double> _D2;            ///< Squared distances between vertices ((_n+1) x (_n+1)).
+
+    std::vector<double> _Minv;          ///< Inverse of M=[y_i-y_0] (_n x _n, row major). Only valid when _invertible.
+    double _det;                        ///< Determinant of M.
+    bool _invertible;                   ///< M is not singular and _Minv is valid.
+    bool _valid;                        ///< The slots hold a complete simplex.
+    size_t _nbUpdates;                  ///< Number of rank one updates since the last refactorization.
+
+    size_t _diamSlot1, _diamSlot2;      ///< Slots of the two vertices at the diameter distance.
+
+    /// Recompute the inverse and the determinant of M from the vertices (Gauss-Jordan with partial pivoting).
+    void refactorize();
+
+    /// Rank one update of M: M + u v^T. Return false if the update is badly conditioned.
+    bool rankOneUpdate(const std::vector<double> & u, const std::vector<double> & v);
+
+    /// Put the point y in a slot and update the factorization. Return false if a refactorization is needed.
+    bool replaceVertex(const size_t slot, const EvalPoint & y);
+
+    /// Recompute the squared distances of a slot with the other vertices.
+    void updateDistances(const size_t slot);
+
+    /// Find the largest distance between vertices.
+    void updateDiameter();
+
+public:
+    /// Constructor
+    explicit NMSimplexFactorization()
+      : _n(0),
+        _det(0),
+        _invertible(false),
+        _valid(false),
+        _nbUpdates(0),
+        _diamSlot1(0),
+        _diamSlot2(0)
+    {}
+
+    /// Synchronize the factorization with the simplex Y.
+    /**
+     The vertices of Y that are not in a slot replace the vertices that left Y. When Y is not a complete simplex (Y.size() != n+1), the factorization is not valid.
+     */
+    void update(const NMSimplexEvalPointSet & Y);
+
+    /// The factorization holds a complete simplex.
+    bool isValid() const { return _valid; }
+
+    /// Rank of DZ=[y_i-y_0].
+    /**
+     The rank is n when M is invertible and the smallest singular value of M, bounded below by 1/||M^-1||_F, is larger than eps.
+     \return n, or -1 when the factorization cannot decide (the rank must then be computed with an SVD).
+     */
+    int getRank(const double eps) const;
+
+    /// Absolute value of the determinant of M. Return -1 when the simplex is not valid.
+    double getAbsDeterminant() const;
+
+    /// Largest distance between two vertices, and the corresponding vertices.
+    double getDiameter(const EvalPoint* & pt1, const EvalPoint* & pt2) const;
+};
+
+#include "../../nomad_nsend.hpp"
+
+#endif // __NOMAD400_NMSIMPLEXFACTORIZATION__
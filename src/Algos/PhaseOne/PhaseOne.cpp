@@ -60,7 +60,10 @@ void NOMAD::PhaseOne::init()
 
 void NOMAD::PhaseOne::startImp()
 {
-    
+    // Evaluations in progress, if evaluations are asynchronous, must be
+    // done before changing the success computation function.
+    EvcInterface::getEvaluatorControl()->clearQueue(true /* waitRunning */);
+
     // Setup EvalPoint success computation to be based on h rather than f.
     NOMAD::ComputeSuccessType::setComputeSuccessTypeFunction(
                                                              NOMAD::ComputeSuccessType::computeSuccessTypePhaseOne);
@@ -107,7 +110,8 @@ bool NOMAD::PhaseOne::runImp()
 void NOMAD::PhaseOne::endImp()
 {
     // Remove any remaining points from eval queue.
-    EvcInterface::getEvaluatorControl()->clearQueue();
+    // Wait for evaluations in progress, before resetting the success computation function.
+    EvcInterface::getEvaluatorControl()->clearQueue(true /* waitRunning */);
 
     // reset to the previous stats comment
     NOMAD::MainStep::resetPreviousAlgoComment(true); // true: release lock on comment
@@ -141,7 +145,7 @@ void NOMAD::PhaseOne::endImp()
 void NOMAD::PhaseOne::recomputeH(NOMAD::EvalPoint& evalPoint)
 {
     // EvalType BB: Never use Sgte in Phase One
-    auto eval = evalPoint.getEval(NOMAD::EvalType::BB);
+    auto eval = evalPoint.getEvalToModify(NOMAD::EvalType::BB);
     if (nullptr != eval && !eval->getBBO().empty())
     {
         eval->setH(NOMAD::Eval::defaultComputeH(*eval, _bboutputtypes));
@@ -151,7 +155,7 @@ void NOMAD::PhaseOne::recomputeH(NOMAD::EvalPoint& evalPoint)
 
 void NOMAD::PhaseOne::recomputeHPB(NOMAD::EvalPoint& evalPoint)
 {
-    auto eval = evalPoint.getEval(NOMAD::EvalType::BB);
+    auto eval = evalPoint.getEvalToModify(NOMAD::EvalType::BB);
     if (nullptr != eval && !eval->getBBO().empty())
     {
         eval->setH(NOMAD::Eval::computeHPB(*eval, _bboutputtypes));
@@ -126,6 +126,8 @@ void NOMAD::SgtelibModel::reset()
     }
 
     _ready = false;
+    _cacheGeneration = 0;
+    _pendingPoints.clear();
 }
 
 
@@ -284,6 +286,9 @@ void NOMAD::SgtelibModel::startImp()
     // Comment to appear at the end of stats lines
     NOMAD::MainStep::setAlgoComment("(SgtelibModel)");
 
+    // Evaluations in progress, if evaluations are asynchronous, must be
+    // done before changing the success computation function.
+    EvcInterface::getEvaluatorControl()->clearQueue(true /* waitRunning */);
 
     // Setup EvalPoint success computation to be based on sgte rather than bb.
     NOMAD::ComputeSuccessType::setComputeSuccessTypeFunction(
@@ -362,7 +367,8 @@ bool NOMAD::SgtelibModel::runImp()
 void NOMAD::SgtelibModel::endImp()
 {
     // Remove any remaining points from eval queue.
-    EvcInterface::getEvaluatorControl()->clearQueue();
+    // Wait for evaluations in progress, before resetting the success computation function.
+    EvcInterface::getEvaluatorControl()->clearQueue(true /* waitRunning */);
 
     // Reset success computation function
     NOMAD::ComputeSuccessType::setComputeSuccessTypeFunction(
@@ -515,6 +521,10 @@ std::vector<NOMAD::EvalPointPtr> NOMAD::SgtelibModel::getX0s() const
 // To be used outside of SgtelibModel, e.g., in SgtelibSearchMethod.
 NOMAD::EvalPointSet NOMAD::SgtelibModel::createOraclePoints()
 {
+    // Evaluations in progress, if evaluations are asynchronous, must be
+    // done before changing the success computation function.
+    EvcInterface::getEvaluatorControl()->clearQueue(true /* waitRunning */);
+
     // As long as we are managing points using their SGTE evaluation, 
     // setup EvalPoint success computation to be based on SGTE rather than BB.
     // Setting the ComputeSuccessType function ensures that at all steps,
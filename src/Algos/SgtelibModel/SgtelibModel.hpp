@@ -95,6 +95,9 @@ private:
 
     std::shared_ptr<MeshBase> _mesh; ///> Useful for sizes if a mesh is available.
 
+    size_t _cacheGeneration;    ///> Generation of the cache at the last update of the training set.
+    std::vector<EvalPoint> _pendingPoints; ///> Valid points not in the training set yet: too far from the frame centers.
+
 public:
     // Constructor
     explicit SgtelibModel(const Step* parentStep,
@@ -112,7 +115,9 @@ public:
         _foundFeasible(false),
         _modelLowerBound(pbParams->getAttributeValue<size_t>("DIMENSION"), +INF),
         _modelUpperBound(pbParams->getAttributeValue<size_t>("DIMENSION"), -INF),
-        _mesh(mesh)
+        _mesh(mesh),
+        _cacheGeneration(0),
+        _pendingPoints()
     {
         init();
     }
@@ -140,6 +145,11 @@ public:
     std::shared_ptr<MeshBase> getMesh() const { return _mesh; }
     Double getDeltaMNorm() const;
 
+    // Incremental update of the training set
+    size_t getCacheGeneration() const { return _cacheGeneration; }
+    void setCacheGeneration(const size_t generation) { _cacheGeneration = generation; }
+    std::vector<EvalPoint>& getPendingPoints() { return _pendingPoints; }
+
 
     // Utility function to get BB_OUTPUT_TYPE parameter, which is buried in Evaluator.
     static BBOutputTypeList getBBOutputType() 
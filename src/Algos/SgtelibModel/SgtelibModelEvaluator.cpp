@@ -98,111 +98,127 @@ bool NOMAD::SgtelibModelEvaluator::eval_x(NOMAD::EvalPoint &x,
                                           const NOMAD::Double &hMax,
                                           bool &countEval) const
 {
-    // Convert x to subspace, because model is in subspace.
-    x = x.makeSubSpacePointFromFixed(_fixedVariable);
+    // Evaluate a block of one point.
+    NOMAD::Block block(1, std::make_shared<NOMAD::EvalPoint>(x));
+    std::vector<bool> countEvalBlock;
+    std::vector<bool> evalOk = eval_block(block, hMax, countEvalBlock);
 
-    std::string s = "X = " + x.display();
-    NOMAD::OutputQueue::Add(s, _displayLevel);
+    x = *block[0];
+    countEval = countEvalBlock[0];
 
-    size_t n = x.size();
-    const auto bbot = _evalParams->getAttributeValue<NOMAD::BBOutputTypeList>("BB_OUTPUT_TYPE");
+    return evalOk[0];
+}
 
-    size_t nbConstraints = NOMAD::getNbConstraints(bbot);
-    size_t nbModels = NOMAD::SgtelibModel::getNbModels(_modelFeasibility, nbConstraints);
-    // Init the matrices for prediction
-    SGTELIB::Matrix   M_predict (  "M_predict", 1, static_cast<int>(nbModels));
-    SGTELIB::Matrix STD_predict ("STD_predict", 1, static_cast<int>(nbModels));
-    SGTELIB::Matrix CDF_predict ("CDF_predict", 1, static_cast<int>(nbModels));
-    SGTELIB::Matrix  EI_predict ( "EI_predict", 1, static_cast<int>(nbModels));
 
+/*------------------------------------------------------------------------*/
+/*           evaluate the sgtelib_model model on a block of points        */
+/*------------------------------------------------------------------------*/
+std::vector<bool> NOMAD::SgtelibModelEvaluator::eval_block(NOMAD::Block &block,
+                                                           const NOMAD::Double &hMax,
+                                                           std::vector<bool> &countEval) const
+{
+    if (0 == block.size())
+    {
+        throw NOMAD::Exception(__FILE__, __LINE__, "SgtelibModelEvaluator: eval_block called with an empty block");
+    }
 
-    // --------------------- //
-    // In/Out Initialisation //
-    // --------------------- //
-    // Declaration of the stastistical measurements
-    NOMAD::Double pf = 1; // P[x]
-    NOMAD::Double f = 0; // predicted mean of the objective
-    NOMAD::Double sigma_f = 0; // predicted variance of the objective
-    NOMAD::Double pi = 0; // probability of improvement
-    NOMAD::Double ei = 0; // expected improvement
-    NOMAD::Double efi = 0; // expected feasible improvement
-    NOMAD::Double pfi = 0; // probability of feasible improvement
-    NOMAD::Double mu = 0; // uncertainty on the feasibility
-    NOMAD::Double penalty = 0; // exclusion area penalty
-    NOMAD::Double d = 0; // Distance to closest point of the cache
-    NOMAD::Double h = 0; // Constraint violation
+    const int nbPoints = static_cast<int>(block.size());
 
-    // Creation of matrix for input / output of SGTELIB model
-    SGTELIB::Matrix X_predict("X_predict", 1, static_cast<int>(n));
-    // Shall we compute statistical criterias
-    bool useStatisticalCriteria = false;
-    // FORMULATION USED IN THIS EVAL_X
-    const NOMAD::SgtelibModelFormulationType formulation = _modelAlgo->getFormulation();
+    // Build the display strings only if they are displayed.
+    const bool doDisplay = NOMAD::OutputQueue::GoodLevel(_displayLevel);
+    std::string s;
 
-    // Unfortunately, Sgtelib is not thread-safe.
-    // For this reason we have to set part of the eval_x code to critical.
-#ifdef _OPENMP
-    #pragma omp critical(SgtelibEvalX)
-#endif // _OPENMP
+    // Convert points to subspace, because model is in subspace.
+    for (auto& x : block)
     {
-
-        // Set the input matrix
-        for (size_t i = 0; i < n; i++)
+        *x = x->makeSubSpacePointFromFixed(_fixedVariable);
+        if (doDisplay)
         {
-            X_predict.set(0, static_cast<int>(i), x[i].todouble());
+            s = "X = " + x->display();
+            NOMAD::OutputQueue::Add(s, _displayLevel);
         }
+    }
 
-        // Reset point outputs
-        // By default, set everything to -1
-        // Note: Currently NOMAD cannot set a bbo value by index, so we have to
-        // work around by constructing a suitable string.
-        // Note: Why set some default values on bbo?
-        NOMAD::ArrayOfString defbbo(bbot.size(), "-1");
-        x.setBBO(defbbo.display(), bbot, NOMAD::EvalType::SGTE);
+    const size_t n = block[0]->size();
+    const auto& bbot = _evalParams->getAttributeValue(_bbOutputTypeHandle);
 
-        // ------------------------- //
-        //   Objective Prediction    //
-        // ------------------------- //
-        switch (formulation)
+    size_t nbConstraints = NOMAD::getNbConstraints(bbot);
+    size_t nbModels = NOMAD::SgtelibModel::getNbModels(_modelFeasibility, nbConstraints);
+    // Init the matrices for prediction: one row per point
+    SGTELIB::Matrix   M_predict (  "M_predict", nbPoints, static_cast<int>(nbModels));
+    SGTELIB::Matrix STD_predict ("STD_predict", nbPoints, static_cast<int>(nbModels));
+    SGTELIB::Matrix CDF_predict ("CDF_predict", nbPoints, static_cast<int>(nbModels));
+    SGTELIB::Matrix  EI_predict ( "EI_predict", nbPoints, static_cast<int>(nbModels));
+
+    // Creation of matrix for input / output of SGTELIB model
+    SGTELIB::Matrix X_predict("X_predict", nbPoints, static_cast<int>(n));
+    for (int row = 0; row < nbPoints; row++)
+    {
+        const auto& x = *block[row];
+        for (size_t i = 0; i < n; i++)
         {
-            case NOMAD::SgtelibModelFormulationType::FS:
-                useStatisticalCriteria = (_diversification != 0);
-                break;
-            case NOMAD::SgtelibModelFormulationType::FSP:
-            case NOMAD::SgtelibModelFormulationType::EIS:
-            case NOMAD::SgtelibModelFormulationType::EFI:
-            case NOMAD::SgtelibModelFormulationType::EFIS:
-            case NOMAD::SgtelibModelFormulationType::EFIM:
-            case NOMAD::SgtelibModelFormulationType::EFIC:
-            case NOMAD::SgtelibModelFormulationType::PFI:
-                useStatisticalCriteria = true;
-                break;
-            case NOMAD::SgtelibModelFormulationType::D:
-                useStatisticalCriteria = false;
-                break;
-            case NOMAD::SgtelibModelFormulationType::EXTERN:
-            case NOMAD::SgtelibModelFormulationType::UNDEFINED:
-            default:
-                throw SGTELIB::Exception ( __FILE__ , __LINE__ , "Forbiden formulation" );
-                break;
+            X_predict.set(row, static_cast<int>(i), x[i].todouble());
         }
+    }
 
+    // Distance to closest point of the cache, and exclusion area penalty
+    SGTELIB::Matrix D_predict("D_predict", nbPoints, 1);
+    SGTELIB::Matrix P_predict("P_predict", nbPoints, 1);
+
+    // Shall we compute statistical criterias
+    bool useStatisticalCriteria = false;
+    // FORMULATION USED IN THIS EVAL_BLOCK
+    const NOMAD::SgtelibModelFormulationType formulation = _modelAlgo->getFormulation();
+
+    // ------------------------- //
+    //   Objective Prediction    //
+    // ------------------------- //
+    switch (formulation)
+    {
+        case NOMAD::SgtelibModelFormulationType::FS:
+            useStatisticalCriteria = (_diversification != 0);
+            break;
+        case NOMAD::SgtelibModelFormulationType::FSP:
+        case NOMAD::SgtelibModelFormulationType::EIS:
+        case NOMAD::SgtelibModelFormulationType::EFI:
+        case NOMAD::SgtelibModelFormulationType::EFIS:
+        case NOMAD::SgtelibModelFormulationType::EFIM:
+        case NOMAD::SgtelibModelFormulationType::EFIC:
+        case NOMAD::SgtelibModelFormulationType::PFI:
+            useStatisticalCriteria = true;
+            break;
+        case NOMAD::SgtelibModelFormulationType::D:
+            useStatisticalCriteria = false;
+            break;
+        case NOMAD::SgtelibModelFormulationType::EXTERN:
+            throw SGTELIB::Exception(__FILE__, __LINE__,
+                                     "SgtelibModelEvaluator::eval_block: Formulation Extern should not been called in this context.");
+        case NOMAD::SgtelibModelFormulationType::UNDEFINED:
+        default:
+            throw SGTELIB::Exception ( __FILE__ , __LINE__ , "Forbiden formulation" );
+            break;
+    }
+
+    if (doDisplay)
+    {
         s = "Formulation: " + NOMAD::SgtelibModelFormulationTypeToString(formulation);
         s += "; compute stat: " + NOMAD::boolToString(useStatisticalCriteria);
         s += "; found feasible: " + NOMAD::boolToString(_modelAlgo->getFoundFeasible());
         NOMAD::OutputQueue::Add(s, _displayLevel);
+    }
 
+    // Unfortunately, Sgtelib is not thread-safe: predict() builds the model
+    // and computes its metrics on demand.
+    // For this reason the calls to the model are critical. They are done
+    // once for the whole block.
+#ifdef _OPENMP
+    #pragma omp critical(SgtelibEvalX)
+#endif // _OPENMP
+    {
         // Prediction
         if ( formulation == NOMAD::SgtelibModelFormulationType::D )
         {
-            d = _modelAlgo->getTrainingSet()->get_distance_to_closest(X_predict).get(0,0);
-            s = "d = " + d.display();
-            NOMAD::OutputQueue::Add(s, _displayLevel);
-        }
-        else if (formulation == NOMAD::SgtelibModelFormulationType::EXTERN)
-        {
-            throw SGTELIB::Exception(__FILE__, __LINE__,
-                                     "SgtelibModelEvaluator::eval_x: Formulation Extern should not been called in this context.");
+            D_predict = _modelAlgo->getTrainingSet()->get_distance_to_closest(X_predict);
         }
         else
         {
@@ -224,36 +240,125 @@ bool NOMAD::SgtelibModelEvaluator::eval_x(NOMAD::EvalPoint &x,
             NOMAD::OutputQueue::Add("ok", _displayLevel);
         }
 
-        // Get the prediction from the matrices
-        f = M_predict.get(0,0);
+        // ------------------------- //
+        //   exclusion area          //
+        // ------------------------- //
+        if (_tc > 0.0)
+        {
+            P_predict = _modelAlgo->getModel()->get_exclusion_area_penalty(X_predict, _tc);
+        }
+
+    } // pragma omp critical
+
+    // The predictions are available: set the outputs of each point.
+    std::vector<bool> evalOk(block.size(), false);
+    countEval.resize(block.size(), false);
+    for (int row = 0; row < nbPoints; row++)
+    {
+        auto& x = *block[row];
+        const NOMAD::Double d = (formulation == NOMAD::SgtelibModelFormulationType::D)
+                                    ? NOMAD::Double(D_predict.get(row,0))
+                                    : NOMAD::Double(0);
+        const NOMAD::Double penalty = (_tc > 0.0) ? NOMAD::Double(P_predict.get(row,0))
+                                                  : NOMAD::Double(0);
+
+        setModelOutputs(x, row, useStatisticalCriteria,
+                        M_predict, STD_predict, CDF_predict, EI_predict,
+                        d, penalty);
+
+        // ================== //
+        // Exit Status        //
+        // ================== //
+        countEval[row] = true;
+        x.setEvalStatus(NOMAD::EvalStatusType::EVAL_OK, NOMAD::EvalType::SGTE);
+
+        // Convert back x to full space
+        x = x.makeFullSpacePointFromFixed(_fixedVariable);
+
+        // Always eval_ok = true
+        evalOk[row] = true;
+    }
+
+    return evalOk;
+}
+
+
+/*------------------------------------------------------------------------*/
+/*       apply the formulation to the predictions of a single point       */
+/*------------------------------------------------------------------------*/
+void NOMAD::SgtelibModelEvaluator::setModelOutputs(NOMAD::EvalPoint &x,
+                                                   const int row,
+                                                   const bool useStatisticalCriteria,
+                                                   const SGTELIB::Matrix &M_predict,
+                                                   const SGTELIB::Matrix &STD_predict,
+                                                   const SGTELIB::Matrix &CDF_predict,
+                                                   const SGTELIB::Matrix &EI_predict,
+                                                   const NOMAD::Double &d,
+                                                   const NOMAD::Double &penalty) const
+{
+    const bool doDisplay = NOMAD::OutputQueue::GoodLevel(_displayLevel);
+    std::string s;
 
-        if (useStatisticalCriteria)
+    const auto& bbot = _evalParams->getAttributeValue(_bbOutputTypeHandle);
+    size_t nbConstraints = NOMAD::getNbConstraints(bbot);
+    size_t nbModels = NOMAD::SgtelibModel::getNbModels(_modelFeasibility, nbConstraints);
+    const NOMAD::SgtelibModelFormulationType formulation = _modelAlgo->getFormulation();
+
+    // --------------------- //
+    // In/Out Initialisation //
+    // --------------------- //
+    // Declaration of the stastistical measurements
+    NOMAD::Double pf = 1; // P[x]
+    NOMAD::Double f = 0; // predicted mean of the objective
+    NOMAD::Double sigma_f = 0; // predicted variance of the objective
+    NOMAD::Double pi = 0; // probability of improvement
+    NOMAD::Double ei = 0; // expected improvement
+    NOMAD::Double efi = 0; // expected feasible improvement
+    NOMAD::Double pfi = 0; // probability of feasible improvement
+    NOMAD::Double mu = 0; // uncertainty on the feasibility
+    NOMAD::Double h = 0; // Constraint violation
+
+    if (doDisplay && formulation == NOMAD::SgtelibModelFormulationType::D)
+    {
+        s = "d = " + d.display();
+        NOMAD::OutputQueue::Add(s, _displayLevel);
+    }
+
+    // Get the prediction from the matrices
+    f = M_predict.get(row,0);
+
+    if (useStatisticalCriteria)
+    {
+        // If no feasible points is found so far, then sigma_f, ei and pi are bypassed.
+        if (_modelAlgo->getFoundFeasible())
         {
-            // If no feasible points is found so far, then sigma_f, ei and pi are bypassed.
-            if (_modelAlgo->getFoundFeasible())
-            {
-                sigma_f = STD_predict.get(0,0);
-                pi      = CDF_predict.get(0,0);
-                ei      = EI_predict.get(0,0);
-            }
-            else
-            {
-                sigma_f = 1.0; // This inhibits the exploration term in regard to the objective
-                pi      = 1.0; // This implies that pfi = pf
-                ei      = 1.0; // This implies that efi = pf
-            }
-            s = "F = " + f.display() + " +/- " + sigma_f.display();
-            NOMAD::OutputQueue::Add(s, _displayLevel);
+            sigma_f = STD_predict.get(row,0);
+            pi      = CDF_predict.get(row,0);
+            ei      = EI_predict.get(row,0);
         }
         else
         {
-            s = "F = " + f.display();
+            sigma_f = 1.0; // This inhibits the exploration term in regard to the objective
+            pi      = 1.0; // This implies that pfi = pf
+            ei      = 1.0; // This implies that efi = pf
+        }
+        if (doDisplay)
+        {
+            s = "F = " + f.display() + " +/- " + sigma_f.display();
             NOMAD::OutputQueue::Add(s, _displayLevel);
         }
+    }
+    else if (doDisplay)
+    {
+        s = "F = " + f.display();
+        NOMAD::OutputQueue::Add(s, _displayLevel);
+    }
 
-        // ====================================== //
-        // Constraints display                    //
-        // ====================================== //
+    // ====================================== //
+    // Constraints display                    //
+    // ====================================== //
+    if (doDisplay)
+    {
         s = "";
         switch (_modelFeasibility)
         {
@@ -262,9 +367,9 @@ bool NOMAD::SgtelibModelEvaluator::eval_x(NOMAD::EvalPoint &x,
                 {
                     for (size_t i = 1; i < nbModels; i++)
                     {
-                        s += "C" + std::to_string(i) + " = " + std::to_string(M_predict.get(0,static_cast<int>(i)));
-                        s += " +/- " + std::to_string(STD_predict.get(0,static_cast<int>(i)));
-                        s += " (CDF : " + std::to_string(CDF_predict.get(0,static_cast<int>(i))) +  ")";
+                        s += "C" + std::to_string(i) + " = " + std::to_string(M_predict.get(row,static_cast<int>(i)));
+                        s += " +/- " + std::to_string(STD_predict.get(row,static_cast<int>(i)));
+                        s += " (CDF : " + std::to_string(CDF_predict.get(row,static_cast<int>(i))) +  ")";
                     }
                 }
                 else
@@ -272,68 +377,70 @@ bool NOMAD::SgtelibModelEvaluator::eval_x(NOMAD::EvalPoint &x,
                     s += "C = [ ";
                     for (size_t i = 1; i < nbModels; i++)
                     {
-                        s += std::to_string(M_predict.get(0,static_cast<int>(i))) + " ";
-                        s += " ]";
+                        s += std::to_string(M_predict.get(row,static_cast<int>(i))) + " ";
                     }
+                    s += " ]";
                 }
                 break;
 
             case NOMAD::SgtelibModelFeasibilityType::H:
                 s += "Feasibility_Method : H (Aggregate prediction)";
-                s += "H = " + std::to_string(M_predict.get(0,1));
-                s += " +/- " + std::to_string(STD_predict.get(0,1));
-                s += " (CDF : " + std::to_string(CDF_predict.get(0,1)) + ")";
+                s += "H = " + std::to_string(M_predict.get(row,1));
+                s += " +/- " + std::to_string(STD_predict.get(row,1));
+                s += " (CDF : " + std::to_string(CDF_predict.get(row,1)) + ")";
                 break;
             case NOMAD::SgtelibModelFeasibilityType::B:
                 s += "Feasibility_Method : B (binary prediction)";
-                s += "B = " + std::to_string(M_predict.get(0,1));
-                s += " (CDF : " + std::to_string(CDF_predict.get(0,1)) + ")";
+                s += "B = " + std::to_string(M_predict.get(row,1));
+                s += " (CDF : " + std::to_string(CDF_predict.get(row,1)) + ")";
                 break;
             case NOMAD::SgtelibModelFeasibilityType::M:
                 s += "Feasibility_Method : M (Biggest constraint prediction)";
-                s += "M = " + std::to_string(M_predict.get(0,1));
-                s += " +/- " + std::to_string(STD_predict.get(0,1));
-                s += " (CDF : " + std::to_string(CDF_predict.get(0,1)) + ")";
+                s += "M = " + std::to_string(M_predict.get(row,1));
+                s += " +/- " + std::to_string(STD_predict.get(row,1));
+                s += " (CDF : " + std::to_string(CDF_predict.get(row,1)) + ")";
                 break;
             case NOMAD::SgtelibModelFeasibilityType::UNDEFINED:
             default:
                 s = "SGTELIB_MODEL_FEASIBILITY_UNDEFINED";
-                NOMAD::OutputQueue::Add(s, _displayLevel);
                 break;
         }
+        NOMAD::OutputQueue::Add(s, _displayLevel);
+    }
 
-        // ====================================== //
-        // Computation of statistical criteria    //
-        // ====================================== //
-        if ( useStatisticalCriteria )
-        {
-            pf = 1; // General probability of feasibility
-            NOMAD::Double pfj; // Probability of feasibility for constrait cj
-            NOMAD::Double L2 = 0;
+    // ====================================== //
+    // Computation of statistical criteria    //
+    // ====================================== //
+    if ( useStatisticalCriteria )
+    {
+        pf = 1; // General probability of feasibility
+        NOMAD::Double pfj; // Probability of feasibility for constrait cj
+        NOMAD::Double L2 = 0;
 
-            if (nbConstraints > 0)
+        if (nbConstraints > 0)
+        {
+            // Use the CDF of each output in C
+            // If there is only one output in C (models B, H and M) then pf = CDF)
+            for (size_t i = 1; i < nbModels; i++)
             {
-                // Use the CDF of each output in C
-                // If there is only one output in C (models B, H and M) then pf = CDF)
-                for (size_t i = 1; i < nbModels; i++)
-                {
-                    pfj = CDF_predict.get(0,static_cast<int>(i));
-                    L2 += max( 0 , M_predict.get(0,static_cast<int>(i))).pow2();
-                    pf *= pfj;
-                }
-            }   // end (if constraints are present)
-            if (!_modelAlgo->getFoundFeasible() && (pf == 0))
+                pfj = CDF_predict.get(row,static_cast<int>(i));
+                L2 += max( 0 , M_predict.get(row,static_cast<int>(i))).pow2();
+                pf *= pfj;
+            }
+        }   // end (if constraints are present)
+        if (!_modelAlgo->getFoundFeasible() && (pf == 0))
+        {
+            pf = 1.0/(1.0+L2);
+            if (doDisplay)
             {
-                pf = 1.0/(1.0+L2);
                 s = "pf = 0 and L2 = " + L2.display() + " => pF = " + pf.display();
                 NOMAD::OutputQueue::Add(s, _displayLevel);
             }
-            pfi = pi*pf;
-            efi = ei*pf;
-            mu = 4*pf*(1-pf);
         }
-
-    } // pragma omp critical
+        pfi = pi*pf;
+        efi = ei*pf;
+        mu = 4*pf*(1-pf);
+    }
 
     // ====================================== //
     // Application of the formulation         //
@@ -352,7 +459,7 @@ bool NOMAD::SgtelibModelEvaluator::eval_x(NOMAD::EvalPoint &x,
             {
                 if (bbot[i] != NOMAD::BBOutputType::OBJ)
                 {
-                    newbbo[i] = M_predict.get(0,static_cast<int>(k+1)) - _diversification*STD_predict.get(0,static_cast<int>(k+1));
+                    newbbo[i] = M_predict.get(row,static_cast<int>(k+1)) - _diversification*STD_predict.get(row,static_cast<int>(k+1));
                     k++;
                 }
             }
@@ -380,7 +487,7 @@ bool NOMAD::SgtelibModelEvaluator::eval_x(NOMAD::EvalPoint &x,
             {
                 if ( bbot[i] != NOMAD::BBOutputType::OBJ )
                 {
-                    newbbo[i] = M_predict.get(0,static_cast<int>(k+1)) - _diversification*STD_predict.get(0,static_cast<int>(k+1));
+                    newbbo[i] = M_predict.get(row,static_cast<int>(k+1)) - _diversification*STD_predict.get(row,static_cast<int>(k+1));
                     k++;
                 }
             }
@@ -411,10 +518,6 @@ bool NOMAD::SgtelibModelEvaluator::eval_x(NOMAD::EvalPoint &x,
             break;
 
         case NOMAD::SgtelibModelFormulationType::EXTERN:
-            s = "SgtelibModel formulation: " + NOMAD::SgtelibModelFormulationTypeToString(formulation);
-            NOMAD::OutputQueue::Add(s, _displayLevel);
-            break;
-
         case NOMAD::SgtelibModelFormulationType::UNDEFINED:
         default:
             s = "SgtelibModel formulation: " + NOMAD::SgtelibModelFormulationTypeToString(formulation);
@@ -427,7 +530,6 @@ bool NOMAD::SgtelibModelEvaluator::eval_x(NOMAD::EvalPoint &x,
     // ------------------------- //
     if (_tc > 0.0)
     {
-        penalty = _modelAlgo->getModel()->get_exclusion_area_penalty(X_predict, _tc).get(0,0);
         obj += penalty;
     }
 
@@ -441,7 +543,8 @@ bool NOMAD::SgtelibModelEvaluator::eval_x(NOMAD::EvalPoint &x,
             newbbo[i] = obj;
         }
     }
-    x.setBBO(newbbo.display(), bbot, NOMAD::EvalType::SGTE);
+    // The outputs are numbers: they are set without going through a string.
+    x.setBBO(NOMAD::BBOutput(newbbo), bbot, NOMAD::EvalType::SGTE);
 
     evalH(newbbo, bbot, h);
     x.setF(obj, NOMAD::EvalType::SGTE);
@@ -450,7 +553,7 @@ bool NOMAD::SgtelibModelEvaluator::eval_x(NOMAD::EvalPoint &x,
     // ================== //
     //       DISPLAY      //
     // ================== //
-    if (useStatisticalCriteria)
+    if (doDisplay && useStatisticalCriteria)
     {
         s = "f_min                    f_min = " + std::to_string(_modelAlgo->getTrainingSet()->get_f_min());
         NOMAD::OutputQueue::Add(s, _displayLevel);
@@ -467,28 +570,19 @@ bool NOMAD::SgtelibModelEvaluator::eval_x(NOMAD::EvalPoint &x,
         s = "Expected Feasible Imp.     EFI = " + efi.display();
         NOMAD::OutputQueue::Add(s, _displayLevel);
     }
-    s = "Exclusion area penalty = " + penalty.display();
-    NOMAD::OutputQueue::Add(s, _displayLevel);
-    s = "Model Output = (" + x.getBBO(NOMAD::EvalType::SGTE) + ")";
-    NOMAD::OutputQueue::Add(s, _displayLevel);
+    if (doDisplay)
+    {
+        s = "Exclusion area penalty = " + penalty.display();
+        NOMAD::OutputQueue::Add(s, _displayLevel);
+        s = "Model Output = (" + x.getBBO(NOMAD::EvalType::SGTE) + ")";
+        NOMAD::OutputQueue::Add(s, _displayLevel);
+    }
 
     if (!pf.isDefined() || !pi.isDefined())
     {
         throw SGTELIB::Exception ( __FILE__ , __LINE__ ,
-                                  "SgtelibModelEvaluator::eval_x: NaN values in pi or pf." );
+                                  "SgtelibModelEvaluator::eval_block: NaN values in pi or pf." );
     }
-
-    // ================== //
-    // Exit Status        //
-    // ================== //
-    countEval = true;
-    x.setEvalStatus(NOMAD::EvalStatusType::EVAL_OK, NOMAD::EvalType::SGTE);
-
-    // Convert back x to full space
-    x = x.makeFullSpacePointFromFixed(_fixedVariable);
-
-    // Always eval_ok = true
-    return true;
 }
 
 
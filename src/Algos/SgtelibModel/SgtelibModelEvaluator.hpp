@@ -81,6 +81,15 @@ public:
                 const Double &hMax __attribute__((unused)),
                 bool &countEval) const override;
 
+    /// Evaluate the model on all points of the block.
+    /**
+     The model is built once and the whole block is predicted with a single
+     call to SGTELIB, as a matrix with one row per point.
+     */
+    std::vector<bool> eval_block(Block &block,
+                                 const Double &hMax __attribute__((unused)),
+                                 std::vector<bool> &countEval) const override;
+
     static void evalH(const ArrayOfDouble& bbo,
                       const BBOutputTypeList& bbot,
                       Double &h);
@@ -89,6 +98,17 @@ public:
 private:
     void init();
 
+    /// Apply the formulation to the predictions of one row, and set the outputs of x.
+    void setModelOutputs(EvalPoint &x,
+                         const int row,
+                         const bool useStatisticalCriteria,
+                         const SGTELIB::Matrix &M_predict,
+                         const SGTELIB::Matrix &STD_predict,
+                         const SGTELIB::Matrix &CDF_predict,
+                         const SGTELIB::Matrix &EI_predict,
+                         const Double &d,
+                         const Double &penalty) const;
+
 
 };
 
@@ -119,7 +119,10 @@ bool NOMAD::SgtelibModelOptimize::runImp()
                                                 getSubFixedVariable());
 
         // Replace the EvaluatorControl's evaluator with this one
-        // we just created
+        // we just created.
+        // Points in the queue and evaluations in progress, if evaluations
+        // are asynchronous, are for the main evaluator: Flush them first.
+        EvcInterface::getEvaluatorControl()->clearQueue(true /* waitRunning */);
         auto mainEvaluator = EvcInterface::getEvaluatorControl()->getEvaluatorUPtr();
         EvcInterface::getEvaluatorControl()->setEvaluator(std::move(ev));
 
@@ -143,6 +146,7 @@ bool NOMAD::SgtelibModelOptimize::runImp()
         updateOraclePoints();
 
         // When we are done, restore mainEvaluator
+        EvcInterface::getEvaluatorControl()->clearQueue(true /* waitRunning */);
         EvcInterface::getEvaluatorControl()->setEvaluator(std::move(mainEvaluator));
     }
 
@@ -54,6 +54,10 @@
 #include "../../Type/SgtelibModelFormulationType.hpp"
 #include "../../../ext/sgtelib/src/Surrogate.hpp"
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif // _OPENMP
+
 NOMAD::SgtelibModelUpdate::~SgtelibModelUpdate()
 {
 }
@@ -80,6 +84,8 @@ void NOMAD::SgtelibModelUpdate::startImp()
 // ancestor SgtelibModel (modelAlgo).
 //
 // 1- Get relevant points in cache, around current frame centers.
+//    Only the points evaluated since the previous update are looked at:
+//    the other points are already in the training set.
 // 2- Add points to training set, and build new model.
 // 3- Assess if model is ready. Update its bounds.
 //
@@ -130,9 +136,19 @@ bool NOMAD::SgtelibModelUpdate::runImp()
     //
     std::vector<NOMAD::EvalPoint> evalPointList;
     // Get valid points: notably, they have a BB evaluation.
-    // Use CacheInterface to ensure the points are converted to subspace
+    // Use CacheInterface to ensure the points are converted to subspace.
+    // Only the points evaluated since the previous update are read, not the
+    // whole cache. At the first update, this is all evaluated points.
     NOMAD::CacheInterface cacheInterface(this);
-    cacheInterface.find(validForUpdate, evalPointList);
+    size_t generation = modelAlgo->getCacheGeneration();
+    cacheInterface.findEvaluatedSince(generation, validForUpdate, evalPointList);
+    modelAlgo->setCacheGeneration(generation);
+
+    // Points that were too far from the frame centers at a previous update
+    // are considered again.
+    auto& pendingPoints = modelAlgo->getPendingPoints();
+    evalPointList.insert(evalPointList.end(), pendingPoints.begin(), pendingPoints.end());
+    pendingPoints.clear();
 
     // Minimum and maximum number of valid points to build a model
     const size_t minNbPoints = _runParams->getAttributeValue<size_t>("SGTELIB_MIN_POINTS_FOR_MODEL");
@@ -172,6 +188,10 @@ bool NOMAD::SgtelibModelUpdate::runImp()
                 pointAdded = true;
             }
         }
+        if (!pointAdded)
+        {
+            pendingPoints.push_back(evalPoint);
+        }
     }
     evalPointList = evalPointListWithinRadius;
     size_t nbValidPoints = evalPointList.size();
@@ -194,7 +214,11 @@ bool NOMAD::SgtelibModelUpdate::runImp()
         nbValidPoints = evalPointList.size();
     }
 */
-    if (nbValidPoints < minNbPoints)
+    std::shared_ptr<SGTELIB::TrainingSet> trainingSet = modelAlgo->getTrainingSet();
+    std::shared_ptr<SGTELIB::Surrogate> model = modelAlgo->getModel();
+
+    // The points already in the training set count.
+    if (static_cast<size_t>(trainingSet->get_nb_points()) + nbValidPoints < minNbPoints)
     {
         // If no points available, it is impossible to build a model.
         auto sgteStopReason = NOMAD::AlgoStopReasons<NOMAD::SgtelibModelStopType>::get(_stopReasons);
@@ -208,7 +232,7 @@ bool NOMAD::SgtelibModelUpdate::runImp()
     {
         s += "s";
     }
-    s += " in cache of size " + std::to_string(NOMAD::CacheBase::getInstance()->size());
+    s += " to add, in cache of size " + std::to_string(NOMAD::CacheBase::getInstance()->size());
     AddOutputInfo(s, _displayLevel);
 
     for (auto evalPoint : evalPointList)
@@ -286,9 +310,6 @@ bool NOMAD::SgtelibModelUpdate::runImp()
     //
     // 2- Add points to training set, and build new model.
     //
-    std::shared_ptr<SGTELIB::TrainingSet> trainingSet = modelAlgo->getTrainingSet();
-    std::shared_ptr<SGTELIB::Surrogate> model = modelAlgo->getModel();
-
     s = "Current nb of points: " + std::to_string(trainingSet->get_nb_points());
     AddOutputInfo(s, _displayLevel);
 
@@ -302,7 +323,17 @@ bool NOMAD::SgtelibModelUpdate::runImp()
         AddOutputInfo("OK", _displayLevel);
         AddOutputInfo("Build model...", _displayLevel);
 
+#ifdef _OPENMP
+        // sgtelib builds the models in parallel. The build is done in the
+        // parallel region of the main step, while the other threads wait
+        // for points to evaluate: allow one more level of parallelism.
+        const int maxActiveLevels = omp_get_max_active_levels();
+        omp_set_max_active_levels(std::max(maxActiveLevels, 2));
+#endif // _OPENMP
         model->build();
+#ifdef _OPENMP
+        omp_set_max_active_levels(maxActiveLevels);
+#endif // _OPENMP
         AddOutputInfo("OK.", _displayLevel);
     }
 
@@ -5,7 +5,13 @@
 #define __NOMAD400_CACHEATTRIBUTESDEFINITION__
 
 _definition = {
-{ "MAX_CACHE_SIZE",  "size_t",  "INF",  " Termination criterion on the number of evaluation points stored in the cache ",  " \n  \n . The program terminates as soon as the cache reaches this size. \n  \n . Argument: one positive integer (expressed in number of evaluation points). \n  \n . Example: MAX_CACHE_SIZE 10000 \n  \n . Default: INF\n\n",  "  advanced termination cache  "  , "false" , "false" , "true" },
-{ "CACHE_FILE",  "std::string",  "",  " Cache file name ",  " \n  \n . Cache file. If the specified file does not exist, it will be created. \n  \n . Argument: one string. \n  \n . If the string is empty, no cache file will be created. \n  \n . Points already in the cache file will not be reevaluated. \n  \n . Example: CACHE_FILE cache.txt \n  \n . Default: Empty string.\n\n",  "  basic cache file  "  , "false" , "false" , "true" } };
+{ "MAX_CACHE_SIZE",  "size_t",  "INF",  " Termination criterion on the number of evaluation points stored in the cache ",  " \n  \n . The program terminates as soon as the cache reaches this size. \n  \n . If CACHE_EVICTION is set, points are evicted from the cache instead. \n  \n . Argument: one positive integer (expressed in number of evaluation points). \n  \n . Example: MAX_CACHE_SIZE 10000 \n  \n . Default: INF\n\n",  "  advanced termination cache  "  , "false" , "false" , "true" },
+{ "CACHE_EVICTION",  "NOMAD::CacheEvictionType",  "NONE",  " Policy to evict points from a cache that reached MAX_CACHE_SIZE ",  " \n  \n . When the cache reaches MAX_CACHE_SIZE points, points are removed \n   from the cache following this policy, so that the cache size stays under \n   MAX_CACHE_SIZE. The evicted points are not written to the cache file. \n  \n . Arguments: one string in {'NONE', 'LRU', 'HITS', 'F', 'DISTANCE'}: \n     NONE:     No eviction \n     LRU:      Evict the least recently inserted or found points first \n     HITS:     Evict the points with the fewest cache hits first \n     F:        Evict the points without f first, then the infeasible points \n               with the greatest h, then the feasible points with the \n               greatest f \n     DISTANCE: Evict the points farthest from the best point first \n  \n . For all policies, trial points that were not evaluated are evicted first. \n   Points being evaluated, and the best feasible and infeasible points, are \n   never evicted. \n  \n . Only used if MAX_CACHE_SIZE is finite and CACHE_NB_SHARDS is 1. \n  \n . Example: CACHE_EVICTION F \n  \n . Default: NONE\n\n",  "  advanced cache eviction purge memory size  "  , "false" , "false" , "true" },
+{ "CACHE_FILE",  "std::string",  "",  " Cache file name ",  " \n  \n . Cache file. If the specified file does not exist, it will be created. \n  \n . Argument: one string. \n  \n . If the string is empty, no cache file will be created. \n  \n . Points already in the cache file will not be reevaluated. \n  \n . Example: CACHE_FILE cache.txt \n  \n . Default: Empty string.\n\n",  "  basic cache file  "  , "false" , "false" , "true" },
+{ "CACHE_NB_SHARDS",  "size_t",  "1",  " Number of independently locked shards of the cache ",  " \n  \n . Number of parts in which the cache points are split. Each part has its own \n   lock, so that threads inserting and finding points in different parts of the \n   cache do not wait for each other. \n  \n . Argument: one positive integer. \n  \n . If set to 1, the cache is a single set protected by a single lock. \n  \n . Useful with many threads (NB_THREADS_OPENMP) and a cheap blackbox. \n  \n . Example: CACHE_NB_SHARDS 64 \n  \n . Default: 1\n\n",  "  advanced cache thread threads parallel shard shards lock  "  , "false" , "false" , "true" },
+{ "CACHE_SPATIAL_INDEX",  "bool",  "false",  " Maintain a spatial index on the cache points ",  " \n  \n . Maintain a k-d tree on the coordinates of the cache points, and the list \n   of cache points belonging to each subproblem (fixed variables) queried. \n  \n . Argument: one boolean ('yes' or 'no'). \n  \n . Radius and nearest points queries, and the search of the best points of a \n   subproblem, do not go through all the cache. \n  \n . Useful for long runs, when the cache holds many points. \n  \n . Only used with a single cache shard (CACHE_NB_SHARDS 1). \n  \n . Example: CACHE_SPATIAL_INDEX yes \n  \n . Default: false\n\n",  "  advanced cache index kd tree spatial distance nearest neighbor neighbors  "  , "false" , "false" , "true" },
+{ "CACHE_FILE_BINARY",  "bool",  "false",  " Write the cache file in binary format ",  " \n  \n . Write the cache file (CACHE_FILE) in a binary, column-oriented format, \n   instead of the text format. \n  \n . Argument: one boolean ('yes' or 'no'). \n  \n . The format of an existing cache file is detected when it is read, so a \n   text cache file can be read and then written in binary format. \n  \n . Reading a binary cache file is much faster than reading a text cache file. \n   Useful for restarts of long runs. \n  \n . Use nomad -c to convert a cache file from one format to the other. \n  \n . Example: CACHE_FILE_BINARY yes \n  \n . Default: false\n\n",  "  advanced cache file binary format restart  "  , "false" , "false" , "true" },
+{ "CACHE_JOURNAL",  "bool",  "false",  " Append evaluated points to a journal instead of rewriting the cache file ",  " \n  \n . Each evaluated point is appended to the file CACHE_FILE.journal as soon as \n   its evaluation is done. The journal is merged into the cache file when the \n   cache file is written: at the end of the run, and when the journal holds \n   CACHE_JOURNAL_COMPACTION points. \n  \n . Argument: one boolean ('yes' or 'no'). \n  \n . If the run is interrupted, only the evaluations in progress are lost. The \n   journal is read with the cache file at the next run. \n  \n . Only used if CACHE_FILE is set. \n  \n . Example: CACHE_JOURNAL yes \n  \n . Default: false\n\n",  "  advanced cache file journal log restart crash  "  , "false" , "false" , "true" },
+{ "CACHE_JOURNAL_COMPACTION",  "size_t",  "INF",  " Number of points in the cache journal that triggers writing the cache file ",  " \n  \n . When the cache journal (CACHE_JOURNAL) holds this number of points, the \n   cache file is written, and the journal is emptied. \n  \n . Argument: one positive integer. \n  \n . Writing the cache file takes a time proportional to the cache size, while \n   appending a point to the journal does not depend on the cache size. \n  \n . Example: CACHE_JOURNAL_COMPACTION 10000 \n  \n . Default: INF\n\n",  "  advanced cache file journal compaction  "  , "false" , "false" , "true" } };
 
 #endif
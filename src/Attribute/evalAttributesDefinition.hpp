@@ -6,6 +6,7 @@
 
 _definition = {
 { "BB_EXE",  "std::string",  "",  " Blackbox executable ",  " \n  \n . Blackbox executable name \n  \n . List of strings \n  \n . Required for batch mode \n  \n . Unused in library mode \n  \n . One executable can give several outputs \n  \n . Use \' or \", and \'$\', to specify names or commands with spaces \n  \n . When the \'$\' character is put in first position of a string, it is \n   considered as global and no path will be added \n  \n . Examples \n     . BB_EXE bb.exe \n     . BB_EXE \'$nice bb.exe\' \n     . BB_EXE \'$python bb.py\' \n  \n . Default: Empty string.\n\n",  "  basic blackbox blackboxes bb exe executable executables binary output outputs batch  "  , "false" , "false" , "true" },
+{ "BB_EXE_PERSISTENT",  "bool",  "false",  " Keep the blackbox executable running between evaluations ",  " \n  \n . When true, the blackbox executable BB_EXE is launched once per thread, \n   and is sent the points to evaluate on its standard input, instead of being \n   launched for each block of points with a temporary input file. \n  \n . Argument: one boolean ('yes' or 'no'). \n  \n . Protocol, for each block of points: \n     . NOMAD writes a line with the number of points p, followed by p lines \n       holding the coordinates of a point each. \n     . The blackbox writes p lines with the outputs of each point, in the \n       same format as a regular blackbox, and flushes its output. \n     . The blackbox exits when its standard input is closed. \n  \n . Useful for blackboxes that take a short time to evaluate, or that have a \n   long initialization. \n  \n . A blackbox that exits is launched again for the next block. The points \n   that were not answered are in error. \n  \n . Not available on Windows. \n  \n . Example: BB_EXE_PERSISTENT yes \n  \n . Default: false\n\n",  "  advanced blackbox bb exe executable persistent process pipe worker batch  "  , "false" , "false" , "true" },
 { "TMP_DIR",  "std::string",  "/tmp/",  " Directory where to put temporary files ",  " \n  \n . Temporary directory for blackbox input/output files \n  \n . Argument: one string indicating a directory \n  \n . Improved performance with a local temporary directory \n  \n . Example: TMP_DIR /tmp \n  \n . Default: /tmp/\n\n",  "  advanced  "  , "false" , "false" , "true" },
 { "BB_OUTPUT_TYPE",  "NOMAD::BBOutputTypeList",  "OBJ",  " Type of outputs provided by the blackboxes ",  " \n  \n . Blackbox output types \n  \n . List of types for each blackbox output \n  \n . Available types \n     . OBJ       : objective value to minimize (define twice for bi-objective) \n     . PB        : constraint <= 0 treated with Progressive Barrier (PB) \n     . EB        : constraint <= 0 treated with Extreme Barrier (EB) \n     . F         : constraint <= 0 treated with Filter \n     . NOTHING   : this output is ignored \n     . EXTRA_O   : same as 'NOTHING' \n     .  -        : same as 'NOTHING' \n  \n . Equality constraints are not natively supported \n  \n . See parameters LOWER_BOUND and UPPER_BOUND for bound constraints \n  \n . Examples \n     . BB_EXE bb.exe                   # these two lines define \n     . BB_OUTPUT_TYPE OBJ EB EB        # that bb.exe outputs three values \n  \n . Default: OBJ\n\n",  "  basic bb exe blackbox blackboxs output outputs constraint constraints type types  "  , "false" , "false" , "true" } };
 
@@ -53,6 +53,18 @@
  */
 
 #include "../Cache/CacheBase.hpp"
+#include "../Cache/CacheFileBinary.hpp"
+#include "../Output/OutputQueue.hpp"
+#include "../Util/fileutils.hpp"
+
+#include <algorithm> // For sort, unique
+#include <cstdio>   // For rename, remove
+
+// Init static members
+NOMAD::BBOutputTypeList NOMAD::CacheBase::_bbOutputType = NOMAD::BBOutputTypeList();
+std::unique_ptr<NOMAD::CacheBase> NOMAD::CacheBase::_single = nullptr;
+
+std::atomic<size_t> NOMAD::CacheBase::_nbCacheHits;
 
 
 // Initialize CacheBase class.
@@ -66,6 +78,7 @@ void NOMAD::CacheBase::init()
     }
 
     _maxSize  = _cacheParams->getAttributeValue<size_t>("MAX_CACHE_SIZE") ;
+    _journalCompaction = _cacheParams->getAttributeValue<size_t>("CACHE_JOURNAL_COMPACTION");
     _filename = _cacheParams->getAttributeValue<std::string>("CACHE_FILE");
     // Verify filename has full path, otherwise, confusion will arise
     if (!_filename.empty() && !NOMAD::isAbsolute(_filename))
@@ -85,9 +98,310 @@ bool isTrue(const NOMAD::EvalPoint& evalPoint __attribute__((unused)))
 }
 
 
+bool hasBBEval(const NOMAD::EvalPoint& evalPoint)
+{
+    return (nullptr != evalPoint.getEval(NOMAD::EvalType::BB));
+}
+
+
 size_t NOMAD::CacheBase::getAllPoints(std::vector<NOMAD::EvalPoint> &evalPointList) const
 {
     evalPointList.clear();
     return find(isTrue, evalPointList);
 }
 
+
+
+size_t NOMAD::CacheBase::getGeneration() const
+{
+#ifdef _OPENMP
+    omp_set_lock(&_evaluatedPointsLock);
+#endif // _OPENMP
+    size_t generation = _evaluatedPointsStart + _evaluatedPoints.size();
+#ifdef _OPENMP
+    omp_unset_lock(&_evaluatedPointsLock);
+#endif // _OPENMP
+
+    return generation;
+}
+
+
+size_t NOMAD::CacheBase::findEvaluatedSince(size_t &generation,
+                                            bool (*crit)(const NOMAD::EvalPoint&),
+                                            std::vector<NOMAD::EvalPoint> &evalPointList) const
+{
+    evalPointList.clear();
+
+    std::vector<NOMAD::EvalPoint> newPoints;
+#ifdef _OPENMP
+    omp_set_lock(&_evaluatedPointsLock);
+#endif // _OPENMP
+    const size_t start = (generation > _evaluatedPointsStart) ? generation - _evaluatedPointsStart : 0;
+    if (start < _evaluatedPoints.size())
+    {
+        newPoints.assign(_evaluatedPoints.begin() + start, _evaluatedPoints.end());
+    }
+    generation = _evaluatedPointsStart + _evaluatedPoints.size();
+#ifdef _OPENMP
+    omp_unset_lock(&_evaluatedPointsLock);
+#endif // _OPENMP
+
+    // A point may have been evaluated more than once: keep its last evaluation.
+    std::stable_sort(newPoints.begin(), newPoints.end(), NOMAD::EvalPointCompare());
+    for (size_t i = 0; i < newPoints.size(); i++)
+    {
+        const bool isLast = (i + 1 == newPoints.size()
+                             || *newPoints[i].getX() != *newPoints[i+1].getX());
+        if (isLast && crit(newPoints[i]))
+        {
+            evalPointList.push_back(newPoints[i]);
+        }
+    }
+
+    return evalPointList.size();
+}
+
+
+void NOMAD::CacheBase::addToEvaluatedPoints(const NOMAD::EvalPoint& evalPoint,
+                                            const NOMAD::EvalType& evalType)
+{
+    if (NOMAD::EvalType::BB != evalType)
+    {
+        return;
+    }
+
+#ifdef _OPENMP
+    omp_set_lock(&_evaluatedPointsLock);
+#endif // _OPENMP
+    _evaluatedPoints.push_back(evalPoint);
+#ifdef _OPENMP
+    omp_unset_lock(&_evaluatedPointsLock);
+#endif // _OPENMP
+}
+
+
+void NOMAD::CacheBase::clearEvaluatedPoints()
+{
+#ifdef _OPENMP
+    omp_set_lock(&_evaluatedPointsLock);
+#endif // _OPENMP
+    _evaluatedPointsStart += _evaluatedPoints.size();
+    _evaluatedPoints.clear();
+#ifdef _OPENMP
+    omp_unset_lock(&_evaluatedPointsLock);
+#endif // _OPENMP
+}
+
+
+// Display only EvalPoints that have a BB eval that is good. Only eval status
+// is checked.
+// This method is used to write points to cache.
+// Derived classes may override it to avoid the copy of the points.
+std::ostream& NOMAD::CacheBase::displayPointsWithEval(std::ostream& os) const
+{
+    std::vector<NOMAD::EvalPoint> evalPointList;
+    getAllPoints(evalPointList);
+    for (auto evalPoint : evalPointList)
+    {
+        if (nullptr != evalPoint.getEval(NOMAD::EvalType::BB) && evalPoint.getEval(NOMAD::EvalType::BB)->goodForCacheFile())
+        {
+            os << evalPoint << std::endl;
+        }
+    }
+
+    return os;
+}
+
+
+// Write _filename, in the format given by CACHE_FILE_BINARY.
+bool NOMAD::CacheBase::writeFile() const
+{
+    const bool binary = _cacheParams->getAttributeValue<bool>("CACHE_FILE_BINARY");
+    if (nullptr == _journal)
+    {
+        return binary ? NOMAD::CacheFileBinary::write(*this, _filename)
+                      : NOMAD::write(*this, _filename);
+    }
+
+    // Compaction. New points are appended to a new journal from now on.
+    // The points of the rotated journal are already in the cache.
+    if (!_journal->rotate())
+    {
+        // Another thread is writing the cache file.
+        return false;
+    }
+
+    // Write a temporary file, so that the cache file is complete at any time.
+    const std::string tmpFilename = _filename + ".tmp";
+    bool writeSuccess = binary ? NOMAD::CacheFileBinary::write(*this, tmpFilename)
+                               : NOMAD::write(*this, tmpFilename);
+    if (writeSuccess)
+    {
+#ifdef _MSC_VER
+        // rename does not replace an existing file on Windows.
+        std::remove(_filename.c_str());
+#endif
+        writeSuccess = (0 == std::rename(tmpFilename.c_str(), _filename.c_str()));
+        if (!writeSuccess)
+        {
+            std::cerr << "Warning: Cannot rename " << tmpFilename << " to " << _filename << std::endl;
+        }
+    }
+    _journal->removeRotated(writeSuccess);
+
+    return writeSuccess;
+}
+
+
+// Read _filename, as written by writeFile(), and add the points to the cache.
+// Then replay the journal.
+bool NOMAD::CacheBase::readFile()
+{
+    bool fileRead = false;
+    if (NOMAD::checkReadFile(_filename))
+    {
+        std::string s = "Read cache file " + _filename;
+        NOMAD::OutputQueue::Add(s, NOMAD::OutputLevel::LEVEL_NORMAL);
+        // The format of the file is detected, independently of CACHE_FILE_BINARY.
+        if (NOMAD::CacheFileBinary::isBinaryFile(_filename))
+        {
+            fileRead = NOMAD::CacheFileBinary::read(*this, _filename);
+        }
+        else
+        {
+            fileRead = NOMAD::read(*this, _filename);
+        }
+    }
+
+    if (!_filename.empty() && _cacheParams->getAttributeValue<bool>("CACHE_JOURNAL"))
+    {
+        // Replay before setting _journal, so that the replayed points
+        // are not appended to the journal again.
+        auto journal = std::unique_ptr<NOMAD::CacheJournal>(new NOMAD::CacheJournal(_filename + ".journal"));
+        const size_t nbReplayed = journal->replay(*this);
+        _journal = std::move(journal);
+
+        if (nbReplayed > 0)
+        {
+            std::string s = "Read " + NOMAD::itos(nbReplayed) + " points from cache journal " + _journal->getFileName();
+            NOMAD::OutputQueue::Add(s, NOMAD::OutputLevel::LEVEL_NORMAL);
+            fileRead = true;
+
+            // Merge the journal into the cache file now.
+            write();
+        }
+    }
+
+    if (fileRead)
+    {
+        // The points read start the list of evaluated points.
+        std::vector<NOMAD::EvalPoint> evalPointList;
+        find(hasBBEval, evalPointList);
+        clearEvaluatedPoints();
+#ifdef _OPENMP
+        omp_set_lock(&_evaluatedPointsLock);
+#endif // _OPENMP
+        _evaluatedPoints = std::move(evalPointList);
+#ifdef _OPENMP
+        omp_unset_lock(&_evaluatedPointsLock);
+#endif // _OPENMP
+    }
+
+    return fileRead;
+}
+
+
+// Recompute f and h, using BB eval.
+void NOMAD::CacheBase::recomputeFH(NOMAD::EvalPoint& evalPoint)
+{
+    auto eval = evalPoint.getEvalToModify(NOMAD::EvalType::BB);
+    if (eval)
+    {
+        eval->recomputeFH(_bbOutputType);
+    }
+}
+
+
+// Header of the text cache file.
+void NOMAD::CacheBase::writeHeader(std::ostream& os,
+                                   const size_t nbCacheHits,
+                                   const NOMAD::BBOutputTypeList& bbOutputType)
+{
+    os << "CACHE_HITS " << nbCacheHits << std::endl;
+    os << "BB_OUTPUT_TYPE " << bbOutputType << std::endl;
+}
+
+
+void NOMAD::CacheBase::readHeader(std::istream& is,
+                                  size_t& nbCacheHits,
+                                  NOMAD::BBOutputTypeList& bbOutputType)
+{
+    std::string s;
+
+    is >> s;
+    if ("CACHE_HITS" == s)
+    {
+        is >> nbCacheHits;
+    }
+    else
+    {
+        // Put back s to istream.
+        for (unsigned i = 0; i < s.size(); i++)
+        {
+            is.unget();
+        }
+    }
+
+    is >> s;
+    if ("BB_OUTPUT_TYPE" == s)
+    {
+        NOMAD::BBOutputTypeList bbOutputTypes;
+
+        while (is >> s && is.good() && !is.eof())
+        {
+            if (NOMAD::ArrayOfDouble::pStart == s)
+            {
+                is.unget();
+                break;
+            }
+            else
+            {
+                bbOutputTypes.push_back(NOMAD::stringToBBOutputType(s));
+            }
+        }
+
+        bbOutputType = bbOutputTypes;
+    }
+}
+
+
+// Display only EvalPoints that have an eval.
+std::ostream& NOMAD::operator<<(std::ostream& os, const NOMAD::CacheBase& cache)
+{
+    NOMAD::CacheBase::writeHeader(os, cache.getNbCacheHits(), cache.getBbOutputType());
+    cache.displayPointsWithEval(os);
+
+    return os;
+}
+
+
+// Get these EvalPoints from stream
+std::istream& NOMAD::operator>>(std::istream& is, NOMAD::CacheBase& cache)
+{
+    size_t cacheHits = cache.getNbCacheHits();
+    NOMAD::BBOutputTypeList bbOutputType = cache.getBbOutputType();
+    NOMAD::CacheBase::readHeader(is, cacheHits, bbOutputType);
+    cache.setNbCacheHits(cacheHits);
+    cache.setBBOutputType(bbOutputType);
+
+    NOMAD::EvalPoint evalPoint;
+    while (is >> evalPoint && is.good() && !is.eof())
+    {
+        cache.insert(evalPoint);
+    }
+
+    // Need to recompute F and H on all cache points
+    cache.processOnAllPoints(NOMAD::CacheBase::recomputeFH);
+
+    return is;
+}
@@ -61,6 +61,7 @@
 #include <atomic>       // For atomic
 #include <vector>
 
+#include "../Cache/CacheJournal.hpp"
 #include "../Eval/EvalPoint.hpp"
 #include "../Param/CacheParameters.hpp"
 
@@ -74,8 +75,8 @@ class CacheSet;
  *
  * The cache itself is implemented in derived classes.
  * It could be a set (CacheSet), an unordered_set (CacheSet with
- * precompiler option USE_UNORDEREDSET), map, multimap,
- * SQL database, etc.
+ * precompiler option USE_UNORDEREDSET), a set split in independently
+ * locked shards (CacheShardedSet), map, multimap, SQL database, etc.
  */
 class CacheBase {
 
@@ -101,6 +102,33 @@ protected:
     of the file.
      */
     std::string _filename;
+
+    /// Journal of the points evaluated since the cache file was written.
+    /**
+     * Only used with parameter CACHE_JOURNAL. Set when the cache file is read.
+     */
+    std::unique_ptr<CacheJournal> _journal;
+
+    /// Number of points in the journal that triggers the writing of the cache file.
+    size_t _journalCompaction;
+
+    /// Points with a blackbox evaluation, in the order they were evaluated.
+    /**
+     * The points read from the cache file come first. Then each blackbox
+       evaluation recorded by update() is appended.
+     * The generation of the cache is the number of blackbox evaluations
+       recorded since the cache was created. Steps that only need the
+       evaluated points, or only the points evaluated since their previous
+       visit, use it instead of going through the whole cache.
+     */
+    std::vector<EvalPoint> _evaluatedPoints;
+
+    /// Generation of the first point of _evaluatedPoints. Increased by clear().
+    size_t _evaluatedPointsStart;
+
+#ifdef _OPENMP
+    mutable omp_lock_t _evaluatedPointsLock; ///< Lock on _evaluatedPoints
+#endif // _OPENMP
     
 
     /// Maximum number of points to be stored in the cache.
@@ -114,6 +142,8 @@ protected:
     
     static std::unique_ptr<CacheBase> _single; ///< The singleton
 
+    static BBOutputTypeList _bbOutputType; ///< Corresponds to parameter BB_OUTPUT_TYPE used for this cache
+
     /// Dimension of the points in the cache.
     /**
      * Used for verification only.
@@ -132,12 +162,62 @@ protected:
      \param cacheParams The cache parameters -- \b IN.
      */
     explicit CacheBase(const std::shared_ptr<CacheParameters>& cacheParams)
-      : _cacheParams (cacheParams),
+      : _journal(nullptr),
+        _journalCompaction(0),
+        _evaluatedPoints(),
+        _evaluatedPointsStart(0),
+        _cacheParams (cacheParams),
         _n(0)
     {
+#ifdef _OPENMP
+        omp_init_lock(&_evaluatedPointsLock);
+#endif // _OPENMP
         init();
     }
 
+    /// Write the cache file, in text or binary format (parameter CACHE_FILE_BINARY).
+    /**
+     * With a journal, this is a compaction: the journal is merged into the
+       cache file, which is replaced atomically.
+     * Helper for write().
+     */
+    bool writeFile() const;
+
+    /// Read the cache file, in text or binary format, and replay the journal.
+    /**
+     * The format of the cache file is detected.
+     * Helper for read().
+     */
+    bool readFile();
+
+    /// Append an evaluated point to the journal, if there is one.
+    /**
+     * To be called by update(), after the cache is updated.
+     \param evalPoint   The eval point with its updated Eval   -- \b IN.
+     \param evalType    Which Eval was updated                  -- \b IN.
+     */
+    void appendToJournal(const EvalPoint& evalPoint, const EvalType& evalType) const
+    {
+        if (nullptr != _journal && EvalType::BB == evalType)
+        {
+            _journal->append(evalPoint);
+        }
+    }
+
+    /// Record a blackbox evaluation: the generation of the cache is increased.
+    /**
+     * To be called by update(), after the cache is updated.
+     \param evalPoint   The eval point with its updated Eval   -- \b IN.
+     \param evalType    Which Eval was updated                  -- \b IN.
+     */
+    void addToEvaluatedPoints(const EvalPoint& evalPoint, const EvalType& evalType);
+
+    /// Forget the recorded evaluations. The generation is not reset.
+    /**
+     * To be called by clear().
+     */
+    void clearEvaluatedPoints();
+
 public:
     /// Copy constructor not available
     CacheBase ( CacheBase const & ) = delete;
@@ -162,7 +242,12 @@ public:
     }
 
     /// Destructor
-    virtual ~CacheBase(void) = default;
+    virtual ~CacheBase(void)
+    {
+#ifdef _OPENMP
+        omp_destroy_lock(&_evaluatedPointsLock);
+#endif // _OPENMP
+    }
 
 
     
@@ -179,6 +264,15 @@ public:
     
     void setMaxSize(const size_t maxSize) { _maxSize = maxSize; }
 
+    /// Get the list of blackbox output types
+    static BBOutputTypeList getBbOutputType() { return _bbOutputType; }
+
+    /// Set the list of blackbox output type
+    /**
+     \param bbOutputType    The list to use in cache -- \b IN.
+     */
+    static void setBBOutputType(const BBOutputTypeList& bbOutputType) { _bbOutputType = bbOutputType; }
+
     /*---------------*/
     /* Other methods */
     /*---------------*/
@@ -333,6 +427,18 @@ public:
                         std::vector<EvalPoint> &evalPointList,
                         int maxEvalPoints = 0) const = 0;
 
+    /// Get the k eval points nearest to point X (pure virtual).
+    /**
+     * Ties on the distance are broken using the order of EvalPointCompare.
+     \param X                The point of reference                              -- \b IN.
+     \param k                The number of points to select                      -- \b IN.
+     \param evalPointList    The nearest eval points, nearest first              -- \b OUT.
+     \return                 The number of eval points found.
+     */
+    virtual size_t findNearest(const Point& X,
+                               const size_t k,
+                               std::vector<EvalPoint> &evalPointList) const = 0;
+
     /// Find using criteria.
     /**
      All the points for which crit() return \c true are put in evalPointList.
@@ -355,6 +461,25 @@ public:
      \return                  The dimension of the list.
      */
     size_t getAllPoints(std::vector<EvalPoint> &evalPointList) const;
+
+    /// Get the generation of the cache: the number of blackbox evaluations recorded by update().
+    size_t getGeneration() const;
+
+    /// Find using criteria, among the points evaluated since a generation.
+    /**
+     Only the points evaluated since the generation are looked at, not the
+     whole cache. Generation 0 gives all the points with a blackbox evaluation.
+     A point evaluated twice since the generation is found once, with its
+     last evaluation. Points evicted from the cache are still found.
+
+     \param generation       The generation of the previous call. Updated to the current generation -- \b IN/OUT.
+     \param crit             The criteria function                                -- \b IN.
+     \param evalPointList    The eval points evaluated since generation, that satisfy crit -- \b OUT.
+     \return                 The number of eval points found.
+     */
+    size_t findEvaluatedSince(size_t &generation,
+                              bool (*crit)(const EvalPoint&),
+                              std::vector<EvalPoint> &evalPointList) const;
     
     /// Update EvalPoint in cache.
     /**
@@ -386,6 +511,12 @@ public:
         std::cerr << "Warning: purge is not implemented for this type of cache." << std::endl;
     }
 
+    /// Number of points evicted from the cache to stay under MAX_CACHE_SIZE.
+    virtual size_t getNbEvicted() const { return 0; }
+
+    /// Number of evicted points that were inserted again in the cache.
+    virtual size_t getNbEvictedReinserted() const { return 0; }
+
     /**
      * \brief Write cache to file.
      *
@@ -396,6 +527,53 @@ public:
     /// Read a cache file and load it.
     virtual bool read() = 0;
 
+    /// Write the cache file if the journal holds enough points (parameter CACHE_JOURNAL_COMPACTION).
+    /**
+     * Does nothing if there is no journal.
+     */
+    void compactJournalIfNeeded() const
+    {
+        if (nullptr != _journal && _journal->getNbEntries() >= _journalCompaction)
+        {
+            write();
+        }
+    }
+
+    /** Display only EvalPoints that have an eval.
+     * This method is used to write the cache file.
+     * The default implementation goes through getAllPoints().
+     * \note the EvalPoint's Eval must satisfy method Eval::goodForCacheFile().
+     */
+    virtual std::ostream& displayPointsWithEval(std::ostream& os) const;
+
+    /// Recompute F and H on a cache point.
+    /**
+      Helper for read - where only BBO is set.
+     \param evalPoint       The eval point to update in cache -- \b IN.
+     */
+    static void recomputeFH(EvalPoint& evalPoint);
+
+    /// Write the header of a text cache file.
+    /**
+     \param os              The stream                  -- \b IN/OUT.
+     \param nbCacheHits     The number of cache hits    -- \b IN.
+     \param bbOutputType    The parameter BB_OUTPUT_TYPE -- \b IN.
+     */
+    static void writeHeader(std::ostream& os,
+                            const size_t nbCacheHits,
+                            const BBOutputTypeList& bbOutputType);
+
+    /// Read the header of a text cache file.
+    /**
+     * Values that are not in the header are left unchanged.
+     \param is              The stream                  -- \b IN/OUT.
+     \param nbCacheHits     The number of cache hits    -- \b IN/OUT.
+     \param bbOutputType    The parameter BB_OUTPUT_TYPE -- \b IN/OUT.
+     */
+    static void readHeader(std::istream& is,
+                           size_t& nbCacheHits,
+                           BBOutputTypeList& bbOutputType);
+
 
 private:
     
@@ -406,6 +584,12 @@ private:
     void init();
 };
 
+/// Display only EvalPoints that have an eval.
+std::ostream& operator<<(std::ostream& os, const CacheBase& cache);
+
+/// Get these EvalPoints from stream
+std::istream& operator>>(std::istream& is, CacheBase& cache);
+
 #include "../nomad_nsend.hpp"
 
 #endif // __NOMAD400_CACHEBASE__
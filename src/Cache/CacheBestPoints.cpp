@@ -0,0 +1,315 @@
+/*---------------------------------------------------------------------------------*/
+/*  NOMAD - Nonlinear Optimization by Mesh Adaptive Direct Search -                */
+/*                                                                                 */
+/*  NOMAD - Version 4.0.0 has been created by                                      */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  The copyright of NOMAD - version 4.0.0 is owned by                             */
+/*                 Sebastien Le Digabel        - Polytechnique Montreal            */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  NOMAD v4 has been funded by Rio Tinto, Hydro-Québec, NSERC (Natural Science    */
+/*  and Engineering Research Council of Canada), INOVEE (Innovation en Energie     */
+/*  Electrique and IVADO (The Institute for Data Valorization)                     */
+/*                                                                                 */
+/*  NOMAD v3 was created and developed by Charles Audet, Sebastien Le Digabel,     */
+/*  Christophe Tribes and Viviane Rochon Montplaisir and was funded by AFOSR       */
+/*  and Exxon Mobil.                                                               */
+/*                                                                                 */
+/*  NOMAD v1 and v2 were created and developed by Mark Abramson, Charles Audet,    */
+/*  Gilles Couture, and John E. Dennis Jr., and were funded by AFOSR and           */
+/*  Exxon Mobil.                                                                   */
+/*                                                                                 */
+/*  Contact information:                                                           */
+/*    Polytechnique Montreal - GERAD                                               */
+/*    C.P. 6079, Succ. Centre-ville, Montreal (Quebec) H3C 3A7 Canada              */
+/*    e-mail: nomad@gerad.ca                                                       */
+/*    phone : 1-514-340-6053 #6928                                                 */
+/*    fax   : 1-514-340-5665                                                       */
+/*                                                                                 */
+/*  This program is free software: you can redistribute it and/or modify it        */
+/*  under the terms of the GNU Lesser General Public License as published by       */
+/*  the Free Software Foundation, either version 3 of the License, or (at your     */
+/*  option) any later version.                                                     */
+/*                                                                                 */
+/*  This program is distributed in the hope that it will be useful, but WITHOUT    */
+/*  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or          */
+/*  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License    */
+/*  for more details.                                                              */
+/*                                                                                 */
+/*  You should have received a copy of the GNU Lesser General Public License       */
+/*  along with this program. If not, see <http://www.gnu.org/licenses/>.           */
+/*                                                                                 */
+/*  You can find information on the NOMAD software at www.gerad.ca/nomad           */
+/*---------------------------------------------------------------------------------*/
+/**
+ \file   CacheBestPoints.cpp
+ \brief  Best feasible and infeasible points of a cache, maintained on insertion (implementation)
+ \see    CacheBestPoints.hpp
+ */
+#include "../Cache/CacheBestPoints.hpp"
+
+#include <algorithm>
+
+
+bool NOMAD::CacheBestPoints::canBeUsed(const NOMAD::EvalType& evalType)
+{
+    return (NOMAD::EvalType::BB == evalType && NOMAD::Eval::isDefaultComputeSuccessType());
+}
+
+
+void NOMAD::CacheBestPoints::invalidate()
+{
+    _feas.clear();
+    _inf.clear();
+    _nbFeasUnordered = 0;
+    _nbInfUnordered = 0;
+    _valid = false;
+}
+
+
+void NOMAD::CacheBestPoints::clear()
+{
+    invalidate();
+    _valid = true;
+}
+
+
+void NOMAD::CacheBestPoints::rebuild(const NOMAD::CacheEvalPointSet& cache)
+{
+    clear();
+    for (auto it = cache.begin(); it != cache.end(); ++it)
+    {
+        insert(&(*it));
+    }
+}
+
+
+NOMAD::CacheBestPoints::EntryType NOMAD::CacheBestPoints::getEntryType(const NOMAD::EvalPoint* evalPoint,
+                                                                       double& f,
+                                                                       double& h)
+{
+    const NOMAD::Eval* eval = evalPoint->getEval(NOMAD::EvalType::BB);
+    if (nullptr == eval || NOMAD::EvalStatusType::EVAL_OK != eval->getEvalStatus())
+    {
+        return EntryType::NONE;
+    }
+    if (eval->toBeRecomputed())
+    {
+        // Typically, a point read from a cache file. Its keys are not known yet.
+        return EntryType::UNKNOWN;
+    }
+
+    const NOMAD::Double fEval = eval->getF();
+    const NOMAD::Double hEval = eval->getH();
+    if (!hEval.isDefined())
+    {
+        return EntryType::INF_UNORDERED;
+    }
+    if (eval->isFeasible())
+    {
+        if (!fEval.isDefined())
+        {
+            return EntryType::FEAS_UNORDERED;
+        }
+        f = fEval.todouble();
+        h = hEval.todouble();
+        return EntryType::FEAS;
+    }
+    // With h = INF, the points are not ordered by Eval::compEvalFindBest.
+    if (!fEval.isDefined() || NOMAD::INF == hEval)
+    {
+        return EntryType::INF_UNORDERED;
+    }
+    f = fEval.todouble();
+    h = hEval.todouble();
+
+    return EntryType::INF;
+}
+
+
+void NOMAD::CacheBestPoints::insert(const NOMAD::EvalPoint* evalPoint)
+{
+    double f = 0, h = 0;
+    switch (getEntryType(evalPoint, f, h))
+    {
+        case EntryType::FEAS:
+            _feas.insert(FeasMap::value_type(f, evalPoint));
+            break;
+        case EntryType::FEAS_UNORDERED:
+            _nbFeasUnordered++;
+            break;
+        case EntryType::INF:
+            _inf.insert(InfMap::value_type(std::make_pair(h, f), evalPoint));
+            break;
+        case EntryType::INF_UNORDERED:
+            _nbInfUnordered++;
+            break;
+        case EntryType::UNKNOWN:
+            invalidate();
+            break;
+        case EntryType::NONE:
+        default:
+            break;
+    }
+}
+
+
+void NOMAD::CacheBestPoints::erase(const NOMAD::EvalPoint* evalPoint)
+{
+    double f = 0, h = 0;
+    bool found = true;
+    switch (getEntryType(evalPoint, f, h))
+    {
+        case EntryType::FEAS:
+        {
+            found = false;
+            auto range = _feas.equal_range(f);
+            for (auto it = range.first; it != range.second; ++it)
+            {
+                if (it->second == evalPoint)
+                {
+                    _feas.erase(it);
+                    found = true;
+                    break;
+                }
+            }
+            break;
+        }
+        case EntryType::FEAS_UNORDERED:
+            found = (_nbFeasUnordered > 0);
+            if (found)
+            {
+                _nbFeasUnordered--;
+            }
+            break;
+        case EntryType::INF:
+        {
+            found = false;
+            auto range = _inf.equal_range(std::make_pair(h, f));
+            for (auto it = range.first; it != range.second; ++it)
+            {
+                if (it->second == evalPoint)
+                {
+                    _inf.erase(it);
+                    found = true;
+                    break;
+                }
+            }
+            break;
+        }
+        case EntryType::INF_UNORDERED:
+            found = (_nbInfUnordered > 0);
+            if (found)
+            {
+                _nbInfUnordered--;
+            }
+            break;
+        case EntryType::UNKNOWN:
+            found = false;
+            break;
+        case EntryType::NONE:
+        default:
+            break;
+    }
+
+    if (!found)
+    {
+        // The Eval was modified without being erased first.
+        invalidate();
+    }
+}
+
+
+bool NOMAD::CacheBestPoints::findBestFeas(const NOMAD::Point& fixedVariable,
+                                          std::vector<NOMAD::EvalPoint> &evalPointList) const
+{
+    evalPointList.clear();
+    if (!_valid || _nbFeasUnordered > 0)
+    {
+        return false;
+    }
+
+    const NOMAD::Eval* bestEval = nullptr;
+    for (auto it = _feas.begin(); it != _feas.end(); ++it)
+    {
+        const NOMAD::EvalPoint* evalPoint = it->second;
+        if (nullptr != bestEval && NOMAD::Double(it->first) > bestEval->getF())
+        {
+            // All other points have a worse f.
+            break;
+        }
+        if (!evalPoint->hasFixed(fixedVariable))
+        {
+            continue;
+        }
+        const NOMAD::Eval* eval = evalPoint->getEval(NOMAD::EvalType::BB);
+        if (nullptr == bestEval)
+        {
+            bestEval = eval;
+            evalPointList.push_back(*evalPoint);
+        }
+        else if (*eval == *bestEval)
+        {
+            evalPointList.push_back(*evalPoint);
+        }
+    }
+    // Give the points in the same order as going through the cache.
+    std::sort(evalPointList.begin(), evalPointList.end(), NOMAD::EvalPointCompare());
+
+    return true;
+}
+
+
+bool NOMAD::CacheBestPoints::findBestInf(const NOMAD::Double& hMax,
+                                         const NOMAD::Point& fixedVariable,
+                                         std::vector<NOMAD::EvalPoint> &evalPointList) const
+{
+    evalPointList.clear();
+    if (!_valid)
+    {
+        return false;
+    }
+
+    const NOMAD::Eval* bestEval = nullptr;
+    for (auto it = _inf.begin(); it != _inf.end(); ++it)
+    {
+        const NOMAD::EvalPoint* evalPoint = it->second;
+        if (NOMAD::Double(it->first.first) > hMax)
+        {
+            // All other points have a greater h.
+            break;
+        }
+        if (nullptr != bestEval && NOMAD::Double(it->first.first) > bestEval->getH())
+        {
+            // All other points have a worse h.
+            break;
+        }
+        if (!evalPoint->hasFixed(fixedVariable))
+        {
+            continue;
+        }
+        const NOMAD::Eval* eval = evalPoint->getEval(NOMAD::EvalType::BB);
+        if (nullptr == bestEval)
+        {
+            bestEval = eval;
+            evalPointList.push_back(*evalPoint);
+        }
+        else if (*eval == *bestEval)
+        {
+            evalPointList.push_back(*evalPoint);
+        }
+    }
+
+    if (evalPointList.empty() && _nbInfUnordered > 0)
+    {
+        // The best infeasible points, if any, have h = INF.
+        return false;
+    }
+    // Give the points in the same order as going through the cache.
+    std::sort(evalPointList.begin(), evalPointList.end(), NOMAD::EvalPointCompare());
+
+    return true;
+}
@@ -0,0 +1,258 @@
+/*---------------------------------------------------------------------------------*/
+/*  NOMAD - Nonlinear Optimization by Mesh Adaptive Direct Search -                */
+/*                                                                                 */
+/*  NOMAD - Version 4.0.0 has been created by                                      */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  The copyright of NOMAD - version 4.0.0 is owned by                             */
+/*                 Sebastien Le Digabel        - Polytechnique Montreal            */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  NOMAD v4 has been funded by Rio Tinto, Hydro-Québec, NSERC (Natural Science    */
+/*  and Engineering Research Council of Canada), INOVEE (Innovation en Energie     */
+/*  Electrique and IVADO (The Institute for Data Valorization)                     */
+/*                                                                                 */
+/*  NOMAD v3 was created and developed by Charles Audet, Sebastien Le Digabel,     */
+/*  Christophe Tribes and Viviane Rochon Montplaisir and was funded by AFOSR       */
+/*  and Exxon Mobil.                                                               */
+/*                                                                                 */
+/*  NOMAD v1 and v2 were created and developed by Mark Abramson, Charles Audet,    */
+/*  Gilles Couture, and John E. Dennis Jr., and were funded by AFOSR and           */
+/*  Exxon Mobil.                                                                   */
+/*                                                                                 */
+/*  Contact information:                                                           */
+/*    Polytechnique Montreal - GERAD                                               */
+/*    C.P. 6079, Succ. Centre-ville, Montreal (Quebec) H3C 3A7 Canada              */
+/*    e-mail: nomad@gerad.ca                                                       */
+/*    phone : 1-514-340-6053 #6928                                                 */
+/*    fax   : 1-514-340-5665                                                       */
+/*                                                                                 */
+/*  This program is free software: you can redistribute it and/or modify it        */
+/*  under the terms of the GNU Lesser General Public License as published by       */
+/*  the Free Software Foundation, either version 3 of the License, or (at your     */
+/*  option) any later version.                                                     */
+/*                                                                                 */
+/*  This program is distributed in the hope that it will be useful, but WITHOUT    */
+/*  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or          */
+/*  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License    */
+/*  for more details.                                                              */
+/*                                                                                 */
+/*  You should have received a copy of the GNU Lesser General Public License       */
+/*  along with this program. If not, see <http://www.gnu.org/licenses/>.           */
+/*                                                                                 */
+/*  You can find information on the NOMAD software at www.gerad.ca/nomad           */
+/*---------------------------------------------------------------------------------*/
+/**
+ \file   CacheEviction.cpp
+ \brief  Choice of the points evicted from a cache (implementation)
+ \see    CacheEviction.hpp
+ */
+#include "../Cache/CacheEviction.hpp"
+
+#include <algorithm>    // For find
+#include <functional>   // For hash
+#include <limits>
+
+
+void NOMAD::CacheEviction::clear()
+{
+    _entries.clear();
+    _queue.clear();
+}
+
+
+void NOMAD::CacheEviction::insert(const NOMAD::EvalPoint* evalPoint)
+{
+    if (!_evictedHashes.empty())
+    {
+        const size_t h = evalPoint->getX()->hash();
+        auto it = _evictedHashes.find(h);
+        if (it != _evictedHashes.end())
+        {
+            // This point was evicted, and is needed again.
+            _nbReinserted++;
+            _evictedHashes.erase(it);
+        }
+    }
+
+    Entry& entry = _entries[evalPoint];
+    entry._nbHits = 0;
+    entry._lastAccess = ++_time;
+    entry._queued = false;
+    requeue(evalPoint, entry);
+}
+
+
+void NOMAD::CacheEviction::hit(const NOMAD::EvalPoint* evalPoint)
+{
+    auto it = _entries.find(evalPoint);
+    if (it != _entries.end())
+    {
+        Entry& entry = it->second;
+        entry._nbHits++;
+        entry._lastAccess = ++_time;
+        if (NOMAD::CacheEvictionType::F != _type)
+        {
+            requeue(evalPoint, entry);
+        }
+    }
+}
+
+
+void NOMAD::CacheEviction::update(const NOMAD::EvalPoint* evalPoint)
+{
+    auto it = _entries.find(evalPoint);
+    if (it != _entries.end())
+    {
+        requeue(evalPoint, it->second);
+    }
+}
+
+
+void NOMAD::CacheEviction::erase(const NOMAD::EvalPoint* evalPoint)
+{
+    auto it = _entries.find(evalPoint);
+    if (it != _entries.end())
+    {
+        if (it->second._queued)
+        {
+            _queue.erase(std::make_pair(it->second._key, evalPoint));
+        }
+        _entries.erase(it);
+    }
+}
+
+
+void NOMAD::CacheEviction::evict(const size_t k,
+                                 const NOMAD::Point& reference,
+                                 const std::vector<const NOMAD::EvalPoint*>& kept,
+                                 std::vector<const NOMAD::EvalPoint*>& evicted)
+{
+    evicted.clear();
+
+    if (NOMAD::CacheEvictionType::DISTANCE == _type
+        && reference.isComplete() && reference.size() > 0
+        && (reference.size() != _reference.size() || reference != _reference))
+    {
+        // The distances are relative to the new reference point.
+        _reference = reference;
+        _queue.clear();
+        for (auto& entry : _entries)
+        {
+            entry.second._queued = false;
+            requeue(entry.first, entry.second);
+        }
+    }
+
+    auto itQueue = _queue.begin();
+    while (evicted.size() < k && itQueue != _queue.end())
+    {
+        const NOMAD::EvalPoint* evalPoint = itQueue->second;
+        if (kept.end() != std::find(kept.begin(), kept.end(), evalPoint))
+        {
+            ++itQueue;
+            continue;
+        }
+        itQueue = _queue.erase(itQueue);
+        _entries.erase(evalPoint);
+        evicted.push_back(evalPoint);
+        _nbEvicted++;
+
+        // Remember the point, to count it if it is inserted again.
+        if (_maxNbEvictedHashes > 0)
+        {
+            const size_t h = evalPoint->getX()->hash();
+            if (_evictedHashes.insert(h).second)
+            {
+                _evictedOrder.push_back(h);
+            }
+            if (_evictedOrder.size() > _maxNbEvictedHashes)
+            {
+                _evictedHashes.erase(_evictedOrder.front());
+                _evictedOrder.pop_front();
+            }
+        }
+    }
+}
+
+
+NOMAD::CacheEviction::Key NOMAD::CacheEviction::computeKey(const NOMAD::EvalPoint* evalPoint,
+                                                           const Entry& entry) const
+{
+    const double lastAccess = static_cast<double>(entry._lastAccess);
+    const NOMAD::Eval* eval = evalPoint->getEval(NOMAD::EvalType::BB);
+    if (nullptr == eval
+        || NOMAD::EvalStatusType::EVAL_NOT_STARTED == eval->getEvalStatus()
+        || NOMAD::EvalStatusType::EVAL_STATUS_UNDEFINED == eval->getEvalStatus())
+    {
+        // Trial points that were not evaluated, typically because of
+        // opportunism, are evicted first, oldest first, for all policies.
+        return Key(-1, lastAccess, 0.0);
+    }
+
+    switch (_type)
+    {
+        case NOMAD::CacheEvictionType::HITS:
+            return Key(0, static_cast<double>(entry._nbHits), lastAccess);
+        case NOMAD::CacheEvictionType::F:
+        {
+            if (eval->toBeRecomputed() || NOMAD::EvalStatusType::EVAL_OK != eval->getEvalStatus())
+            {
+                // No f: evicted first. The key is updated after f is recomputed.
+                return Key(0, lastAccess, 0.0);
+            }
+            const NOMAD::Double f = eval->getF();
+            const NOMAD::Double h = eval->getH();
+            if (!f.isDefined())
+            {
+                return Key(0, lastAccess, 0.0);
+            }
+            if (!h.isDefined() || !eval->isFeasible())
+            {
+                // Greatest h first, then greatest f.
+                const double hValue = h.isDefined() ? h.todouble() : std::numeric_limits<double>::max();
+                return Key(1, -hValue, -f.todouble());
+            }
+            return Key(2, -f.todouble(), lastAccess);
+        }
+        case NOMAD::CacheEvictionType::DISTANCE:
+        {
+            double dist = 0.0;
+            if (_reference.size() == evalPoint->size())
+            {
+                dist = NOMAD::Point::dist(_reference, *evalPoint->getX()).todouble();
+            }
+            return Key(0, -dist, lastAccess);
+        }
+        case NOMAD::CacheEvictionType::LRU:
+        case NOMAD::CacheEvictionType::NONE:
+        default:
+            return Key(0, lastAccess, 0.0);
+    }
+}
+
+
+bool NOMAD::CacheEviction::isEvictable(const NOMAD::EvalPoint* evalPoint)
+{
+    // Only the blackbox Eval is considered
+    const NOMAD::Eval* eval = evalPoint->getEval(NOMAD::EvalType::BB);
+    return (nullptr == eval || NOMAD::EvalStatusType::EVAL_IN_PROGRESS != eval->getEvalStatus());
+}
+
+
+void NOMAD::CacheEviction::requeue(const NOMAD::EvalPoint* evalPoint, Entry& entry)
+{
+    if (entry._queued)
+    {
+        _queue.erase(std::make_pair(entry._key, evalPoint));
+        entry._queued = false;
+    }
+    if (isEvictable(evalPoint))
+    {
+        entry._key = computeKey(evalPoint, entry);
+        _queue.insert(std::make_pair(entry._key, evalPoint));
+        entry._queued = true;
+    }
+}
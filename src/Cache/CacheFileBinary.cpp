@@ -0,0 +1,526 @@
+/*---------------------------------------------------------------------------------*/
+/*  NOMAD - Nonlinear Optimization by Mesh Adaptive Direct Search -                */
+/*                                                                                 */
+/*  NOMAD - Version 4.0.0 has been created by                                      */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  The copyright of NOMAD - version 4.0.0 is owned by                             */
+/*                 Sebastien Le Digabel        - Polytechnique Montreal            */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  NOMAD v4 has been funded by Rio Tinto, Hydro-Québec, NSERC (Natural Science    */
+/*  and Engineering Research Council of Canada), INOVEE (Innovation en Energie     */
+/*  Electrique and IVADO (The Institute for Data Valorization)                     */
+/*                                                                                 */
+/*  NOMAD v3 was created and developed by Charles Audet, Sebastien Le Digabel,     */
+/*  Christophe Tribes and Viviane Rochon Montplaisir and was funded by AFOSR       */
+/*  and Exxon Mobil.                                                               */
+/*                                                                                 */
+/*  NOMAD v1 and v2 were created and developed by Mark Abramson, Charles Audet,    */
+/*  Gilles Couture, and John E. Dennis Jr., and were funded by AFOSR and           */
+/*  Exxon Mobil.                                                                   */
+/*                                                                                 */
+/*  Contact information:                                                           */
+/*    Polytechnique Montreal - GERAD                                               */
+/*    C.P. 6079, Succ. Centre-ville, Montreal (Quebec) H3C 3A7 Canada              */
+/*    e-mail: nomad@gerad.ca                                                       */
+/*    phone : 1-514-340-6053 #6928                                                 */
+/*    fax   : 1-514-340-5665                                                       */
+/*                                                                                 */
+/*  This program is free software: you can redistribute it and/or modify it        */
+/*  under the terms of the GNU Lesser General Public License as published by       */
+/*  the Free Software Foundation, either version 3 of the License, or (at your     */
+/*  option) any later version.                                                     */
+/*                                                                                 */
+/*  This program is distributed in the hope that it will be useful, but WITHOUT    */
+/*  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or          */
+/*  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License    */
+/*  for more details.                                                              */
+/*                                                                                 */
+/*  You should have received a copy of the GNU Lesser General Public License       */
+/*  along with this program. If not, see <http://www.gnu.org/licenses/>.           */
+/*                                                                                 */
+/*  You can find information on the NOMAD software at www.gerad.ca/nomad           */
+/*---------------------------------------------------------------------------------*/
+/**
+ \file   CacheFileBinary.cpp
+ \brief  Binary, column-oriented cache file (implementation)
+ \see    CacheFileBinary.hpp
+ */
+#include "../Cache/CacheBase.hpp"
+#include "../Cache/CacheFileBinary.hpp"
+#include "../Output/OutputQueue.hpp"
+#include "../Util/ArrayOfString.hpp"
+#include "../Util/fileutils.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <limits>
+
+#ifndef _MSC_VER
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// Init static members
+const std::string NOMAD::CacheFileBinary::MAGIC = "NOMADCBF";
+const uint32_t NOMAD::CacheFileBinary::VERSION = 1;
+const uint32_t NOMAD::CacheFileBinary::BYTE_ORDER_MARK = 0x01020304;
+const uint64_t NOMAD::CacheFileBinary::NO_RAW_BBO = std::numeric_limits<uint64_t>::max();
+
+
+// Round up to a multiple of 8 bytes, to keep the sections aligned.
+static size_t pad8(const size_t size)
+{
+    return (size + 7) / 8 * 8;
+}
+
+
+// Convert m doubles to a raw blackbox output.
+// Use the shortest representation that gives back the same double,
+// starting with the default precision of streams.
+static std::string doublesToBBO(const double* bbo, const size_t m)
+{
+    std::string rawBBO;
+    char buffer[32];
+    for (size_t j = 0; j < m; j++)
+    {
+        snprintf(buffer, sizeof(buffer), "%g", bbo[j]);
+        if (std::strtod(buffer, nullptr) != bbo[j])
+        {
+            snprintf(buffer, sizeof(buffer), "%.15g", bbo[j]);
+        }
+        if (std::strtod(buffer, nullptr) != bbo[j])
+        {
+            snprintf(buffer, sizeof(buffer), "%.17g", bbo[j]);
+        }
+        if (j > 0)
+        {
+            rawBBO += " ";
+        }
+        rawBBO += buffer;
+    }
+
+    return rawBBO;
+}
+
+
+// Convert a raw blackbox output to m doubles.
+// Return false if it cannot be done without loss: the doubles must
+// give back the same raw output, token by token.
+static bool bboToDoubles(const std::string& rawBBO, const size_t m, double* bbo)
+{
+    NOMAD::ArrayOfString array(rawBBO);
+    if (array.size() != m)
+    {
+        return false;
+    }
+    for (size_t j = 0; j < m; j++)
+    {
+        NOMAD::Double d;
+        if (!d.atof(array[j]) || !d.isDefined())
+        {
+            return false;
+        }
+        bbo[j] = d.todouble();
+        if (doublesToBBO(&bbo[j], 1) != array[j])
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+
+NOMAD::CacheFileBinary::CacheFileBinary(const std::string& filename)
+  : _filename(filename),
+    _data(nullptr),
+    _dataSize(0),
+#ifdef _MSC_VER
+    _buffer(),
+#endif
+    _header(),
+    _bbOutputType(),
+    _x(nullptr),
+    _bbo(nullptr),
+    _rawBBOOffset(nullptr),
+    _numberEval(nullptr),
+    _evalStatus(nullptr),
+    _text(nullptr)
+{
+    open();
+}
+
+
+NOMAD::CacheFileBinary::~CacheFileBinary()
+{
+    close();
+}
+
+
+void NOMAD::CacheFileBinary::open()
+{
+#ifdef _MSC_VER
+    std::ifstream fin(_filename, std::ios::in | std::ios::binary);
+    if (fin.fail())
+    {
+        throw NOMAD::Exception(__FILE__, __LINE__, "Cannot open binary cache file " + _filename);
+    }
+    _buffer.assign(std::istreambuf_iterator<char>(fin), std::istreambuf_iterator<char>());
+    _data = _buffer.data();
+    _dataSize = _buffer.size();
+#else
+    int fd = ::open(_filename.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+        throw NOMAD::Exception(__FILE__, __LINE__, "Cannot open binary cache file " + _filename);
+    }
+    struct stat st;
+    if (fstat(fd, &st) < 0)
+    {
+        ::close(fd);
+        throw NOMAD::Exception(__FILE__, __LINE__, "Cannot get size of binary cache file " + _filename);
+    }
+    _dataSize = static_cast<size_t>(st.st_size);
+    if (_dataSize > 0)
+    {
+        void* data = mmap(nullptr, _dataSize, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (MAP_FAILED == data)
+        {
+            ::close(fd);
+            throw NOMAD::Exception(__FILE__, __LINE__, "Cannot map binary cache file " + _filename);
+        }
+        _data = static_cast<const char*>(data);
+    }
+    // The mapping stays valid after the file descriptor is closed.
+    ::close(fd);
+#endif
+
+    size_t offset = 0;
+    std::memcpy(&_header, getSection(offset, sizeof(Header)), sizeof(Header));
+    if (0 != MAGIC.compare(0, MAGIC.size(), _header._magic, sizeof(_header._magic)))
+    {
+        close();
+        throw NOMAD::Exception(__FILE__, __LINE__, "Not a binary cache file: " + _filename);
+    }
+    if (BYTE_ORDER_MARK != _header._byteOrderMark)
+    {
+        close();
+        throw NOMAD::Exception(__FILE__, __LINE__, "Binary cache file " + _filename + " was written on an architecture with a different byte order");
+    }
+    if (VERSION != _header._version)
+    {
+        close();
+        throw NOMAD::Exception(__FILE__, __LINE__, "Binary cache file " + _filename + " has version " + std::to_string(_header._version) + ", expecting version " + std::to_string(VERSION));
+    }
+
+    const size_t nbPoints = _header._nbPoints;
+    const char* bbOutputType = getSection(offset, _header._bbOutputTypeSize);
+    _x              = getSection(offset, pad8(nbPoints * _header._n * sizeof(double)));
+    _bbo            = getSection(offset, pad8(nbPoints * _header._m * sizeof(double)));
+    _rawBBOOffset   = getSection(offset, pad8(nbPoints * sizeof(uint64_t)));
+    _numberEval     = getSection(offset, pad8(nbPoints * sizeof(int32_t)));
+    _evalStatus     = getSection(offset, pad8(nbPoints * sizeof(uint8_t)));
+    _text           = getSection(offset, _header._textSize);
+
+    // BB_OUTPUT_TYPE text is padded with '\0'.
+    std::string sBBOutputType(bbOutputType, strnlen(bbOutputType, _header._bbOutputTypeSize));
+    _bbOutputType = NOMAD::stringToBBOutputTypeList(sBBOutputType);
+}
+
+
+void NOMAD::CacheFileBinary::close()
+{
+#ifdef _MSC_VER
+    _buffer.clear();
+#else
+    if (nullptr != _data)
+    {
+        munmap(const_cast<char*>(_data), _dataSize);
+    }
+#endif
+    _data = nullptr;
+    _dataSize = 0;
+}
+
+
+const char* NOMAD::CacheFileBinary::getSection(size_t& offset, const size_t size)
+{
+    if (offset + size > _dataSize)
+    {
+        close();
+        throw NOMAD::Exception(__FILE__, __LINE__, "Binary cache file " + _filename + " is truncated");
+    }
+    const char* section = _data + offset;
+    offset += size;
+
+    return section;
+}
+
+
+NOMAD::EvalPoint NOMAD::CacheFileBinary::getEvalPoint(const size_t i) const
+{
+    if (i >= _header._nbPoints)
+    {
+        throw NOMAD::Exception(__FILE__, __LINE__, "Binary cache file " + _filename + ": point index out of range");
+    }
+
+    const size_t n = _header._n;
+    const size_t m = _header._m;
+
+    NOMAD::Point point(n);
+    const char* x = _x + i * n * sizeof(double);
+    for (size_t j = 0; j < n; j++)
+    {
+        double xj;
+        std::memcpy(&xj, x + j * sizeof(double), sizeof(double));
+        point[j] = xj;
+    }
+    NOMAD::EvalPoint evalPoint(point);
+
+    uint8_t evalStatus;
+    std::memcpy(&evalStatus, _evalStatus + i * sizeof(uint8_t), sizeof(uint8_t));
+    if (NOMAD::EvalStatusType::EVAL_STATUS_UNDEFINED != static_cast<NOMAD::EvalStatusType>(evalStatus))
+    {
+        // Never use sgte in cache files
+        evalPoint.setEvalStatus(static_cast<NOMAD::EvalStatusType>(evalStatus), NOMAD::EvalType::BB);
+
+        uint64_t rawBBOOffset;
+        std::memcpy(&rawBBOOffset, _rawBBOOffset + i * sizeof(uint64_t), sizeof(uint64_t));
+        std::string rawBBO;
+        if (NO_RAW_BBO == rawBBOOffset)
+        {
+            std::vector<double> bbo(m);
+            if (m > 0)
+            {
+                std::memcpy(bbo.data(), _bbo + i * m * sizeof(double), m * sizeof(double));
+            }
+            rawBBO = doublesToBBO(bbo.data(), m);
+        }
+        else
+        {
+            uint32_t length;
+            std::memcpy(&length, _text + rawBBOOffset, sizeof(uint32_t));
+            rawBBO.assign(_text + rawBBOOffset + sizeof(uint32_t), length);
+        }
+        evalPoint.setBBO(NOMAD::BBOutput(rawBBO), NOMAD::EvalType::BB);
+        evalPoint.getEvalToModify(NOMAD::EvalType::BB)->toRecompute(true);
+
+        int32_t numberEval;
+        std::memcpy(&numberEval, _numberEval + i * sizeof(int32_t), sizeof(int32_t));
+        evalPoint.setNumberEval(static_cast<short>(numberEval));
+    }
+
+    return evalPoint;
+}
+
+
+bool NOMAD::CacheFileBinary::isBinaryFile(const std::string& filename)
+{
+    std::ifstream fin(filename, std::ios::in | std::ios::binary);
+    if (fin.fail())
+    {
+        return false;
+    }
+    std::string magic(MAGIC.size(), '\0');
+    fin.read(&magic[0], MAGIC.size());
+
+    return (fin.gcount() == static_cast<std::streamsize>(MAGIC.size()) && MAGIC == magic);
+}
+
+
+bool NOMAD::CacheFileBinary::write(const std::string& filename,
+                                   const std::vector<NOMAD::EvalPoint>& evalPointList,
+                                   const size_t nbCacheHits,
+                                   const NOMAD::BBOutputTypeList& bbOutputType)
+{
+    const size_t nbPoints = evalPointList.size();
+    const size_t n = (nbPoints > 0) ? evalPointList[0].size() : 0;
+    const size_t m = bbOutputType.size();
+
+    // Fill the columns
+    std::vector<double>     x(nbPoints * n);
+    std::vector<double>     bbo(nbPoints * m, 0.0);
+    std::vector<uint64_t>   rawBBOOffset(nbPoints, NO_RAW_BBO);
+    std::vector<int32_t>    numberEval(nbPoints, 0);
+    std::vector<uint8_t>    evalStatus(nbPoints, static_cast<uint8_t>(NOMAD::EvalStatusType::EVAL_STATUS_UNDEFINED));
+    std::string             text;
+
+    for (size_t i = 0; i < nbPoints; i++)
+    {
+        const NOMAD::EvalPoint& evalPoint = evalPointList[i];
+        if (evalPoint.size() != n)
+        {
+            std::cerr << "Warning: CacheFileBinary: Cannot write points of different sizes in " << filename << std::endl;
+            return false;
+        }
+        for (size_t j = 0; j < n; j++)
+        {
+            x[i * n + j] = evalPoint[j].todouble();
+        }
+
+        // Never use sgte in cache files
+        const NOMAD::Eval* eval = evalPoint.getEval(NOMAD::EvalType::BB);
+        if (nullptr == eval)
+        {
+            continue;
+        }
+        evalStatus[i] = static_cast<uint8_t>(eval->getEvalStatus());
+        numberEval[i] = evalPoint.getNumberEval();
+        const std::string rawBBO = eval->getBBO();
+        if (!bboToDoubles(rawBBO, m, bbo.data() + i * m))
+        {
+            // Keep the raw output as text
+            std::fill(bbo.begin() + i * m, bbo.begin() + (i + 1) * m, 0.0);
+            rawBBOOffset[i] = text.size();
+            uint32_t length = static_cast<uint32_t>(rawBBO.size());
+            text.append(reinterpret_cast<const char*>(&length), sizeof(uint32_t));
+            text += rawBBO;
+        }
+    }
+
+    std::string sBBOutputType = NOMAD::BBOutputTypeListToString(bbOutputType);
+    sBBOutputType.resize(pad8(sBBOutputType.size() + 1), '\0');
+
+    Header header;
+    std::memset(&header, 0, sizeof(Header));
+    std::memcpy(header._magic, MAGIC.c_str(), sizeof(header._magic));
+    header._version             = VERSION;
+    header._byteOrderMark       = BYTE_ORDER_MARK;
+    header._n                   = n;
+    header._m                   = m;
+    header._nbPoints            = nbPoints;
+    header._nbCacheHits         = nbCacheHits;
+    header._bbOutputTypeSize    = sBBOutputType.size();
+    header._textSize            = text.size();
+
+    std::ofstream fout(filename, std::ios::out | std::ios::binary | std::ios::trunc);
+    if (fout.fail())
+    {
+        std::cerr << "Warning: CacheFileBinary: Cannot write to file " << filename << std::endl;
+        return false;
+    }
+
+    // Write a section, padded to 8 bytes.
+    auto writeSection = [&fout](const void* data, const size_t size)
+    {
+        static const char zeros[8] = {0};
+        if (size > 0)
+        {
+            fout.write(static_cast<const char*>(data), size);
+        }
+        fout.write(zeros, pad8(size) - size);
+    };
+
+    fout.write(reinterpret_cast<const char*>(&header), sizeof(Header));
+    fout.write(sBBOutputType.c_str(), sBBOutputType.size());
+    writeSection(x.data(), x.size() * sizeof(double));
+    writeSection(bbo.data(), bbo.size() * sizeof(double));
+    writeSection(rawBBOOffset.data(), rawBBOOffset.size() * sizeof(uint64_t));
+    writeSection(numberEval.data(), numberEval.size() * sizeof(int32_t));
+    writeSection(evalStatus.data(), evalStatus.size() * sizeof(uint8_t));
+    fout.write(text.c_str(), text.size());
+
+    bool writeSuccess = !fout.fail();
+    fout.close();
+
+    return writeSuccess;
+}
+
+
+bool NOMAD::CacheFileBinary::write(const NOMAD::CacheBase& cache, const std::string& filename)
+{
+    std::vector<NOMAD::EvalPoint> evalPointList;
+    cache.getAllPoints(evalPointList);
+
+    // Only write the points that would be written in a text cache file.
+    std::vector<NOMAD::EvalPoint> evalPointsToWrite;
+    evalPointsToWrite.reserve(evalPointList.size());
+    for (auto& evalPoint : evalPointList)
+    {
+        const NOMAD::Eval* eval = evalPoint.getEval(NOMAD::EvalType::BB);
+        if (nullptr != eval && eval->goodForCacheFile())
+        {
+            evalPointsToWrite.push_back(std::move(evalPoint));
+        }
+    }
+
+    return write(filename, evalPointsToWrite, cache.getNbCacheHits(), cache.getBbOutputType());
+}
+
+
+bool NOMAD::CacheFileBinary::read(NOMAD::CacheBase& cache, const std::string& filename)
+{
+    NOMAD::CacheFileBinary cacheFile(filename);
+
+    cache.setNbCacheHits(cacheFile.getNbCacheHits());
+    if (!cacheFile.getBbOutputType().empty())
+    {
+        cache.setBBOutputType(cacheFile.getBbOutputType());
+    }
+
+    for (size_t i = 0; i < cacheFile.size(); i++)
+    {
+        cache.insert(cacheFile.getEvalPoint(i));
+    }
+
+    // Need to recompute F and H on all cache points
+    cache.processOnAllPoints(NOMAD::CacheBase::recomputeFH);
+
+    return true;
+}
+
+
+bool NOMAD::CacheFileBinary::convert(const std::string& inputFilename,
+                                     const std::string& outputFilename)
+{
+    if (!NOMAD::checkReadFile(inputFilename))
+    {
+        std::cerr << "Warning: CacheFileBinary: Cannot read file " << inputFilename << std::endl;
+        return false;
+    }
+
+    bool writeSuccess = false;
+    if (isBinaryFile(inputFilename))
+    {
+        // Binary to text
+        NOMAD::CacheFileBinary cacheFile(inputFilename);
+        std::ofstream fout(outputFilename);
+        if (fout.fail())
+        {
+            std::cerr << "Warning: CacheFileBinary: Cannot write to file " << outputFilename << std::endl;
+            return false;
+        }
+        NOMAD::CacheBase::writeHeader(fout, cacheFile.getNbCacheHits(), cacheFile.getBbOutputType());
+        for (size_t i = 0; i < cacheFile.size(); i++)
+        {
+            fout << cacheFile.getEvalPoint(i) << std::endl;
+        }
+        writeSuccess = !fout.fail();
+    }
+    else
+    {
+        // Text to binary
+        std::ifstream fin(inputFilename);
+        size_t nbCacheHits = 0;
+        NOMAD::BBOutputTypeList bbOutputType;
+        NOMAD::CacheBase::readHeader(fin, nbCacheHits, bbOutputType);
+
+        std::vector<NOMAD::EvalPoint> evalPointList;
+        NOMAD::EvalPoint evalPoint;
+        while (fin >> evalPoint && fin.good() && !fin.eof())
+        {
+            evalPointList.push_back(evalPoint);
+        }
+        writeSuccess = write(outputFilename, evalPointList, nbCacheHits, bbOutputType);
+    }
+
+    return writeSuccess;
+}
@@ -0,0 +1,227 @@
+/*---------------------------------------------------------------------------------*/
+/*  NOMAD - Nonlinear Optimization by Mesh Adaptive Direct Search -                */
+/*                                                                                 */
+/*  NOMAD - Version 4.0.0 has been created by                                      */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  The copyright of NOMAD - version 4.0.0 is owned by                             */
+/*                 Sebastien Le Digabel        - Polytechnique Montreal            */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  NOMAD v4 has been funded by Rio Tinto, Hydro-Québec, NSERC (Natural Science    */
+/*  and Engineering Research Council of Canada), INOVEE (Innovation en Energie     */
+/*  Electrique and IVADO (The Institute for Data Valorization)                     */
+/*                                                                                 */
+/*  NOMAD v3 was created and developed by Charles Audet, Sebastien Le Digabel,     */
+/*  Christophe Tribes and Viviane Rochon Montplaisir and was funded by AFOSR       */
+/*  and Exxon Mobil.                                                               */
+/*                                                                                 */
+/*  NOMAD v1 and v2 were created and developed by Mark Abramson, Charles Audet,    */
+/*  Gilles Couture, and John E. Dennis Jr., and were funded by AFOSR and           */
+/*  Exxon Mobil.                                                                   */
+/*                                                                                 */
+/*  Contact information:                                                           */
+/*    Polytechnique Montreal - GERAD                                               */
+/*    C.P. 6079, Succ. Centre-ville, Montreal (Quebec) H3C 3A7 Canada              */
+/*    e-mail: nomad@gerad.ca                                                       */
+/*    phone : 1-514-340-6053 #6928                                                 */
+/*    fax   : 1-514-340-5665                                                       */
+/*                                                                                 */
+/*  This program is free software: you can redistribute it and/or modify it        */
+/*  under the terms of the GNU Lesser General Public License as published by       */
+/*  the Free Software Foundation, either version 3 of the License, or (at your     */
+/*  option) any later version.                                                     */
+/*                                                                                 */
+/*  This program is distributed in the hope that it will be useful, but WITHOUT    */
+/*  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or          */
+/*  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License    */
+/*  for more details.                                                              */
+/*                                                                                 */
+/*  You should have received a copy of the GNU Lesser General Public License       */
+/*  along with this program. If not, see <http://www.gnu.org/licenses/>.           */
+/*                                                                                 */
+/*  You can find information on the NOMAD software at www.gerad.ca/nomad           */
+/*---------------------------------------------------------------------------------*/
+/**
+ * \file   CacheFileBinary.hpp
+ * \brief  Binary, column-oriented cache file, read through a memory mapping.
+ * \see    CacheFileBinary.cpp
+ */
+
+#ifndef __NOMAD400_CACHEFILEBINARY__
+#define __NOMAD400_CACHEFILEBINARY__
+
+#include <cstdint>
+
+#include "../Eval/EvalPoint.hpp"
+#include "../Type/BBOutputType.hpp"
+
+#include "../nomad_nsbegin.hpp"
+
+class CacheBase;
+
+/// Binary cache file.
+/**
+ * Layout of the file (version 1), all values in native byte order:
+ * - Header: magic string "NOMADCBF", version, byte order mark, dimension n,
+     number of blackbox outputs m, number of points, number of cache hits,
+     sizes of the sections below.
+ * - BB_OUTPUT_TYPE, as text.
+ * - Coordinates: n doubles per point, contiguous.
+ * - Blackbox outputs: m doubles per point, contiguous.
+ * - Raw blackbox output offsets: one per point. When the raw output cannot
+     be written as m doubles (wrong number of outputs, undefined or
+     non-numerical outputs), it is kept as text, at this offset in the text
+     section. Otherwise, NO_RAW_BBO.
+ * - Number of evaluations: one int32 per point.
+ * - Evaluation status: one byte per point (EvalStatusType).
+ * - Text section.
+ *
+ * The file is mapped in memory when it is opened. Points are only converted
+   to EvalPoint when they are asked for, with getEvalPoint().
+ *
+ * Only the blackbox Eval is written, like for the text cache file.
+ */
+class CacheFileBinary
+{
+private:
+    static const std::string MAGIC;         ///< First bytes of the file
+    static const uint32_t VERSION;          ///< Version of the format
+    static const uint32_t BYTE_ORDER_MARK;  ///< To detect a file written on another architecture
+    static const uint64_t NO_RAW_BBO;       ///< Offset for points written as doubles
+
+    /// Fixed size header
+    struct Header
+    {
+        char     _magic[8];
+        uint32_t _version;
+        uint32_t _byteOrderMark;
+        uint64_t _n;
+        uint64_t _m;
+        uint64_t _nbPoints;
+        uint64_t _nbCacheHits;
+        uint64_t _bbOutputTypeSize;   ///< Size of the BB_OUTPUT_TYPE text, padded to 8 bytes
+        uint64_t _textSize;           ///< Size of the text section
+    };
+
+    std::string         _filename;      ///< Name of the file
+    const char*         _data;          ///< Beginning of the file in memory
+    size_t              _dataSize;      ///< Size of the file
+#ifdef _MSC_VER
+    std::vector<char>   _buffer;        ///< No memory mapping: file is read in memory
+#endif
+
+    Header              _header;        ///< Copy of the header
+    BBOutputTypeList    _bbOutputType;  ///< Parameter BB_OUTPUT_TYPE used to write the file
+
+    // Beginning of each section
+    const char*         _x;
+    const char*         _bbo;
+    const char*         _rawBBOOffset;
+    const char*         _numberEval;
+    const char*         _evalStatus;
+    const char*         _text;
+
+public:
+    /// Constructor: open the file and map it in memory.
+    /**
+     * Throw an exception if the file is not a valid binary cache file.
+     \param filename    The binary cache file -- \b IN.
+     */
+    explicit CacheFileBinary(const std::string& filename);
+
+    /// Destructor: unmap the file.
+    virtual ~CacheFileBinary();
+
+    /// Copy constructor not available
+    CacheFileBinary(const CacheFileBinary&) = delete;
+
+    /// Operator= not available
+    CacheFileBinary& operator=(const CacheFileBinary&) = delete;
+
+    /// Number of points in the file
+    size_t size() const { return _header._nbPoints; }
+
+    /// Dimension of the points
+    size_t getN() const { return _header._n; }
+
+    /// Number of cache hits when the file was written
+    size_t getNbCacheHits() const { return _header._nbCacheHits; }
+
+    /// Parameter BB_OUTPUT_TYPE when the file was written
+    const BBOutputTypeList& getBbOutputType() const { return _bbOutputType; }
+
+    /// Convert the i-th point of the file to an EvalPoint.
+    /**
+     * Like for the text cache file, f and h need to be recomputed.
+     \param i   Index of the point, lower than size() -- \b IN.
+     \return    The EvalPoint, with its blackbox Eval if there is one.
+     */
+    EvalPoint getEvalPoint(const size_t i) const;
+
+    /// Test if a file is a binary cache file.
+    /**
+     \param filename    The file to test -- \b IN.
+     \return            \c true if the file starts with the binary cache file magic string.
+     */
+    static bool isBinaryFile(const std::string& filename);
+
+    /// Write points in a binary cache file.
+    /**
+     \param filename        The binary cache file               -- \b IN.
+     \param evalPointList   The points to write                 -- \b IN.
+     \param nbCacheHits     The number of cache hits            -- \b IN.
+     \param bbOutputType    The parameter BB_OUTPUT_TYPE        -- \b IN.
+     \return                \c true if the file was written.
+     */
+    static bool write(const std::string& filename,
+                      const std::vector<EvalPoint>& evalPointList,
+                      const size_t nbCacheHits,
+                      const BBOutputTypeList& bbOutputType);
+
+    /// Write the cache in a binary cache file.
+    /**
+     * Only the points with an Eval that is good for cache file are written.
+     \param cache       The cache               -- \b IN.
+     \param filename    The binary cache file   -- \b IN.
+     \return            \c true if the file was written.
+     */
+    static bool write(const CacheBase& cache, const std::string& filename);
+
+    /// Insert the points of a binary cache file in the cache.
+    /**
+     * Also set the number of cache hits and BB_OUTPUT_TYPE, and recompute f and h,
+       like for the text cache file.
+     \param cache       The cache               -- \b IN/OUT.
+     \param filename    The binary cache file   -- \b IN.
+     \return            \c true if the file was read.
+     */
+    static bool read(CacheBase& cache, const std::string& filename);
+
+    /// Convert a cache file from text to binary, or from binary to text.
+    /**
+     * The format of the input file is detected. The output file is written in the other format.
+     \param inputFilename   The cache file to convert   -- \b IN.
+     \param outputFilename  The converted cache file    -- \b IN.
+     \return                \c true if the output file was written.
+     */
+    static bool convert(const std::string& inputFilename,
+                        const std::string& outputFilename);
+
+private:
+    /// Map the file in memory and verify the header.
+    void open();
+
+    /// Unmap the file.
+    void close();
+
+    /// Pointer to the beginning of a section, with verification of the file size.
+    const char* getSection(size_t& offset, const size_t size);
+};
+
+
+#include "../nomad_nsend.hpp"
+
+#endif // __NOMAD400_CACHEFILEBINARY__
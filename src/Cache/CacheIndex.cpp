@@ -0,0 +1,450 @@
+/*---------------------------------------------------------------------------------*/
+/*  NOMAD - Nonlinear Optimization by Mesh Adaptive Direct Search -                */
+/*                                                                                 */
+/*  NOMAD - Version 4.0.0 has been created by                                      */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  The copyright of NOMAD - version 4.0.0 is owned by                             */
+/*                 Sebastien Le Digabel        - Polytechnique Montreal            */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  NOMAD v4 has been funded by Rio Tinto, Hydro-Québec, NSERC (Natural Science    */
+/*  and Engineering Research Council of Canada), INOVEE (Innovation en Energie     */
+/*  Electrique and IVADO (The Institute for Data Valorization)                     */
+/*                                                                                 */
+/*  NOMAD v3 was created and developed by Charles Audet, Sebastien Le Digabel,     */
+/*  Christophe Tribes and Viviane Rochon Montplaisir and was funded by AFOSR       */
+/*  and Exxon Mobil.                                                               */
+/*                                                                                 */
+/*  NOMAD v1 and v2 were created and developed by Mark Abramson, Charles Audet,    */
+/*  Gilles Couture, and John E. Dennis Jr., and were funded by AFOSR and           */
+/*  Exxon Mobil.                                                                   */
+/*                                                                                 */
+/*  Contact information:                                                           */
+/*    Polytechnique Montreal - GERAD                                               */
+/*    C.P. 6079, Succ. Centre-ville, Montreal (Quebec) H3C 3A7 Canada              */
+/*    e-mail: nomad@gerad.ca                                                       */
+/*    phone : 1-514-340-6053 #6928                                                 */
+/*    fax   : 1-514-340-5665                                                       */
+/*                                                                                 */
+/*  This program is free software: you can redistribute it and/or modify it        */
+/*  under the terms of the GNU Lesser General Public License as published by       */
+/*  the Free Software Foundation, either version 3 of the License, or (at your     */
+/*  option) any later version.                                                     */
+/*                                                                                 */
+/*  This program is distributed in the hope that it will be useful, but WITHOUT    */
+/*  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or          */
+/*  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License    */
+/*  for more details.                                                              */
+/*                                                                                 */
+/*  You should have received a copy of the GNU Lesser General Public License       */
+/*  along with this program. If not, see <http://www.gnu.org/licenses/>.           */
+/*                                                                                 */
+/*  You can find information on the NOMAD software at www.gerad.ca/nomad           */
+/*---------------------------------------------------------------------------------*/
+/**
+ \file   CacheIndex.cpp
+ \brief  Spatial and subproblem indexes on the points of a cache (implementation)
+ \see    CacheIndex.hpp
+ */
+#include "../Cache/CacheIndex.hpp"
+
+#include <algorithm>
+#include <queue>
+
+const size_t NOMAD::CacheIndex::NONE = NOMAD::INF_SIZE_T;
+const size_t NOMAD::CacheIndex::MAX_NB_PATTERNS = 16;
+
+
+void NOMAD::CacheIndex::clear()
+{
+    _nodes.clear();
+    _root = NONE;
+    _nbBuilt = 0;
+    _nbErased = 0;
+    _patterns.clear();
+}
+
+
+void NOMAD::CacheIndex::rebuild(const NOMAD::CacheEvalPointSet& cache)
+{
+    std::vector<const NOMAD::EvalPoint*> evalPoints;
+    evalPoints.reserve(cache.size());
+    for (auto it = cache.begin(); it != cache.end(); ++it)
+    {
+        evalPoints.push_back(&(*it));
+    }
+
+    buildTree(evalPoints);
+
+    for (auto& pattern : _patterns)
+    {
+        pattern._evalPoints.clear();
+        for (auto evalPoint : evalPoints)
+        {
+            if (evalPoint->hasFixed(pattern._fixedVariable))
+            {
+                pattern._evalPoints.push_back(evalPoint);
+            }
+        }
+    }
+}
+
+
+void NOMAD::CacheIndex::buildTree(std::vector<const NOMAD::EvalPoint*>& evalPoints)
+{
+    _nodes.clear();
+    _nodes.reserve(evalPoints.size());
+    _n = evalPoints.empty() ? 0 : evalPoints[0]->size();
+    _root = build(evalPoints.begin(), evalPoints.end(), 0);
+    _nbBuilt = _nodes.size();
+    _nbErased = 0;
+}
+
+
+size_t NOMAD::CacheIndex::build(std::vector<const NOMAD::EvalPoint*>::iterator first,
+                                std::vector<const NOMAD::EvalPoint*>::iterator last,
+                                const size_t depth)
+{
+    if (first == last)
+    {
+        return NONE;
+    }
+
+    const size_t dim = depth % _n;
+    auto mid = first + (last - first) / 2;
+    std::nth_element(first, mid, last,
+                     [dim](const NOMAD::EvalPoint* p1, const NOMAD::EvalPoint* p2)
+                     { return (*p1)[dim].todouble() < (*p2)[dim].todouble(); });
+
+    const size_t index = _nodes.size();
+    _nodes.push_back({*mid, dim, (**mid)[dim].todouble(), NONE, NONE});
+    // Build children after the parent is in place, since _nodes may be reallocated.
+    const size_t left = build(first, mid, depth + 1);
+    const size_t right = build(mid + 1, last, depth + 1);
+    _nodes[index]._left = left;
+    _nodes[index]._right = right;
+
+    return index;
+}
+
+
+void NOMAD::CacheIndex::insert(const NOMAD::EvalPoint* evalPoint)
+{
+    insertInPatterns(evalPoint);
+
+    if (_nodes.size() + 1 >= 2 * _nbBuilt + 32)
+    {
+        // Rebuild balanced. Amortized, the cost is logarithmic per insertion.
+        std::vector<const NOMAD::EvalPoint*> evalPoints;
+        evalPoints.reserve(size() + 1);
+        for (const auto& node : _nodes)
+        {
+            if (nullptr != node._evalPoint)
+            {
+                evalPoints.push_back(node._evalPoint);
+            }
+        }
+        evalPoints.push_back(evalPoint);
+        buildTree(evalPoints);
+        return;
+    }
+
+    if (NONE == _root)
+    {
+        _n = evalPoint->size();
+    }
+
+    // Descend the tree and add a leaf.
+    size_t parent = _root;
+    size_t* child = &_root;
+    size_t dim = 0;
+    while (NONE != *child)
+    {
+        parent = *child;
+        const Node& node = _nodes[parent];
+        child = ((*evalPoint)[node._dim].todouble() < node._split)
+                    ? &_nodes[parent]._left : &_nodes[parent]._right;
+        dim = (node._dim + 1) % _n;
+    }
+    // child points into _nodes, which push_back may reallocate.
+    const size_t index = _nodes.size();
+    const bool isRoot = (NONE == parent);
+    const bool isLeft = !isRoot && (child == &_nodes[parent]._left);
+    _nodes.push_back({evalPoint, dim, (*evalPoint)[dim].todouble(), NONE, NONE});
+    if (isRoot)
+    {
+        _root = index;
+    }
+    else if (isLeft)
+    {
+        _nodes[parent]._left = index;
+    }
+    else
+    {
+        _nodes[parent]._right = index;
+    }
+}
+
+
+void NOMAD::CacheIndex::erase(const NOMAD::EvalPoint* evalPoint)
+{
+    for (auto& pattern : _patterns)
+    {
+        auto it = std::find(pattern._evalPoints.begin(), pattern._evalPoints.end(), evalPoint);
+        if (it != pattern._evalPoints.end())
+        {
+            pattern._evalPoints.erase(it);
+        }
+    }
+
+    // Descend the tree. Points with the same coordinate as the split
+    // may be on both sides.
+    std::vector<size_t> stack;
+    if (NONE != _root)
+    {
+        stack.push_back(_root);
+    }
+    while (!stack.empty())
+    {
+        Node& node = _nodes[stack.back()];
+        stack.pop_back();
+        if (node._evalPoint == evalPoint)
+        {
+            node._evalPoint = nullptr;
+            _nbErased++;
+            break;
+        }
+        const double x = (*evalPoint)[node._dim].todouble();
+        if (x <= node._split && NONE != node._left)
+        {
+            stack.push_back(node._left);
+        }
+        if (x >= node._split && NONE != node._right)
+        {
+            stack.push_back(node._right);
+        }
+    }
+
+    if (2 * _nbErased > _nodes.size())
+    {
+        std::vector<const NOMAD::EvalPoint*> evalPoints;
+        evalPoints.reserve(size());
+        for (const auto& node : _nodes)
+        {
+            if (nullptr != node._evalPoint)
+            {
+                evalPoints.push_back(node._evalPoint);
+            }
+        }
+        buildTree(evalPoints);
+    }
+}
+
+
+void NOMAD::CacheIndex::findInRadius(const NOMAD::Point& X,
+                                     const NOMAD::Double& distance,
+                                     std::vector<const NOMAD::EvalPoint*>& evalPoints) const
+{
+    evalPoints.clear();
+    if (NONE == _root || X.size() != _n || !distance.isDefined())
+    {
+        return;
+    }
+
+    // Slightly enlarge the radius for the pruning: Point::dist() <= distance
+    // is compared with a tolerance. Candidates are then confirmed exactly.
+    const double r = distance.todouble() * (1.0 + 1e-12) + 2.0 * NOMAD::Double::getEpsilon();
+    const double r2 = r * r;
+
+    std::vector<size_t> stack;
+    stack.push_back(_root);
+    while (!stack.empty())
+    {
+        const Node& node = _nodes[stack.back()];
+        stack.pop_back();
+
+        if (nullptr != node._evalPoint)
+        {
+            const NOMAD::EvalPoint& y = *node._evalPoint;
+            double d2 = 0.0;
+            for (size_t i = 0; i < _n && d2 <= r2; i++)
+            {
+                const double diff = X[i].todouble() - y[i].todouble();
+                d2 += diff * diff;
+            }
+            if (d2 <= r2 && NOMAD::Point::dist(X, y) <= distance)
+            {
+                evalPoints.push_back(node._evalPoint);
+            }
+        }
+
+        const double diff = X[node._dim].todouble() - node._split;
+        const size_t nearChild = (diff < 0) ? node._left : node._right;
+        const size_t farChild  = (diff < 0) ? node._right : node._left;
+        if (NONE != farChild && diff * diff <= r2)
+        {
+            stack.push_back(farChild);
+        }
+        if (NONE != nearChild)
+        {
+            stack.push_back(nearChild);
+        }
+    }
+}
+
+
+void NOMAD::CacheIndex::findNearest(const NOMAD::Point& X,
+                                    const size_t k,
+                                    std::vector<const NOMAD::EvalPoint*>& evalPoints) const
+{
+    evalPoints.clear();
+    if (NONE == _root || X.size() != _n || 0 == k)
+    {
+        return;
+    }
+
+    typedef std::pair<double, const NOMAD::EvalPoint*> Candidate;
+    NOMAD::EvalPointCompare evalPointCompare;
+    auto candidateLess = [&evalPointCompare](const Candidate& c1, const Candidate& c2)
+    {
+        return (c1.first < c2.first)
+               || (c1.first == c2.first && evalPointCompare(*c1.second, *c2.second));
+    };
+    // Max-heap: the worst of the best k candidates is on top.
+    std::priority_queue<Candidate, std::vector<Candidate>, decltype(candidateLess)> best(candidateLess);
+
+    std::vector<size_t> stack;
+    stack.push_back(_root);
+    while (!stack.empty())
+    {
+        const Node& node = _nodes[stack.back()];
+        stack.pop_back();
+
+        if (nullptr != node._evalPoint)
+        {
+            const NOMAD::EvalPoint& y = *node._evalPoint;
+            double d2 = 0.0;
+            for (size_t i = 0; i < _n; i++)
+            {
+                const double diff = X[i].todouble() - y[i].todouble();
+                d2 += diff * diff;
+            }
+            const Candidate candidate(d2, node._evalPoint);
+            if (best.size() < k)
+            {
+                best.push(candidate);
+            }
+            else if (candidateLess(candidate, best.top()))
+            {
+                best.pop();
+                best.push(candidate);
+            }
+        }
+
+        const double diff = X[node._dim].todouble() - node._split;
+        const size_t nearChild = (diff < 0) ? node._left : node._right;
+        const size_t farChild  = (diff < 0) ? node._right : node._left;
+        // The far side may hold a closer point only if the splitting plane
+        // is within the current bound.
+        if (NONE != farChild && (best.size() < k || diff * diff <= best.top().first))
+        {
+            stack.push_back(farChild);
+        }
+        if (NONE != nearChild)
+        {
+            stack.push_back(nearChild);
+        }
+    }
+
+    evalPoints.resize(best.size());
+    for (size_t i = best.size(); i > 0; i--)
+    {
+        evalPoints[i-1] = best.top().second;
+        best.pop();
+    }
+}
+
+
+const std::vector<const NOMAD::EvalPoint*>& NOMAD::CacheIndex::getPattern(const NOMAD::Point& fixedVariable,
+                                                                          const NOMAD::CacheEvalPointSet& cache)
+{
+    for (const auto& pattern : _patterns)
+    {
+        if (samePattern(pattern._fixedVariable, fixedVariable))
+        {
+            return pattern._evalPoints;
+        }
+    }
+
+    // New pattern. Forget the oldest one if there are too many.
+    if (_patterns.size() >= MAX_NB_PATTERNS)
+    {
+        _patterns.erase(_patterns.begin());
+    }
+    Pattern newPattern;
+    newPattern._fixedVariable = fixedVariable;
+    for (auto it = cache.begin(); it != cache.end(); ++it)
+    {
+        if (it->hasFixed(fixedVariable))
+        {
+            newPattern._evalPoints.push_back(&(*it));
+        }
+    }
+    _patterns.push_back(std::move(newPattern));
+
+    return _patterns.back()._evalPoints;
+}
+
+
+bool NOMAD::CacheIndex::isSubproblem(const NOMAD::Point& fixedVariable)
+{
+    for (size_t i = 0; i < fixedVariable.size(); i++)
+    {
+        if (fixedVariable[i].isDefined())
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+
+void NOMAD::CacheIndex::insertInPatterns(const NOMAD::EvalPoint* evalPoint)
+{
+    for (auto& pattern : _patterns)
+    {
+        if (evalPoint->hasFixed(pattern._fixedVariable))
+        {
+            pattern._evalPoints.push_back(evalPoint);
+        }
+    }
+}
+
+
+bool NOMAD::CacheIndex::samePattern(const NOMAD::Point& fixedVariable1,
+                                    const NOMAD::Point& fixedVariable2)
+{
+    if (fixedVariable1.size() != fixedVariable2.size())
+    {
+        return false;
+    }
+    for (size_t i = 0; i < fixedVariable1.size(); i++)
+    {
+        const NOMAD::Double& v1 = fixedVariable1[i];
+        const NOMAD::Double& v2 = fixedVariable2[i];
+        if (v1.isDefined() != v2.isDefined())
+        {
+            return false;
+        }
+        if (v1.isDefined() && v1 != v2)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
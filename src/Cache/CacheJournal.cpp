@@ -0,0 +1,216 @@
+/*---------------------------------------------------------------------------------*/
+/*  NOMAD - Nonlinear Optimization by Mesh Adaptive Direct Search -                */
+/*                                                                                 */
+/*  NOMAD - Version 4.0.0 has been created by                                      */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  The copyright of NOMAD - version 4.0.0 is owned by                             */
+/*                 Sebastien Le Digabel        - Polytechnique Montreal            */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  NOMAD v4 has been funded by Rio Tinto, Hydro-Québec, NSERC (Natural Science    */
+/*  and Engineering Research Council of Canada), INOVEE (Innovation en Energie     */
+/*  Electrique and IVADO (The Institute for Data Valorization)                     */
+/*                                                                                 */
+/*  NOMAD v3 was created and developed by Charles Audet, Sebastien Le Digabel,     */
+/*  Christophe Tribes and Viviane Rochon Montplaisir and was funded by AFOSR       */
+/*  and Exxon Mobil.                                                               */
+/*                                                                                 */
+/*  NOMAD v1 and v2 were created and developed by Mark Abramson, Charles Audet,    */
+/*  Gilles Couture, and John E. Dennis Jr., and were funded by AFOSR and           */
+/*  Exxon Mobil.                                                                   */
+/*                                                                                 */
+/*  Contact information:                                                           */
+/*    Polytechnique Montreal - GERAD                                               */
+/*    C.P. 6079, Succ. Centre-ville, Montreal (Quebec) H3C 3A7 Canada              */
+/*    e-mail: nomad@gerad.ca                                                       */
+/*    phone : 1-514-340-6053 #6928                                                 */
+/*    fax   : 1-514-340-5665                                                       */
+/*                                                                                 */
+/*  This program is free software: you can redistribute it and/or modify it        */
+/*  under the terms of the GNU Lesser General Public License as published by       */
+/*  the Free Software Foundation, either version 3 of the License, or (at your     */
+/*  option) any later version.                                                     */
+/*                                                                                 */
+/*  This program is distributed in the hope that it will be useful, but WITHOUT    */
+/*  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or          */
+/*  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License    */
+/*  for more details.                                                              */
+/*                                                                                 */
+/*  You should have received a copy of the GNU Lesser General Public License       */
+/*  along with this program. If not, see <http://www.gnu.org/licenses/>.           */
+/*                                                                                 */
+/*  You can find information on the NOMAD software at www.gerad.ca/nomad           */
+/*---------------------------------------------------------------------------------*/
+/**
+ \file   CacheJournal.cpp
+ \brief  Append-only journal of the cache file (implementation)
+ \see    CacheJournal.hpp
+ */
+#include "../Cache/CacheBase.hpp"
+#include "../Cache/CacheJournal.hpp"
+#include "../Output/OutputQueue.hpp"
+#include "../Util/fileutils.hpp"
+
+#include <cstdio>   // For rename, remove
+
+
+NOMAD::CacheJournal::CacheJournal(const std::string& filename)
+  : _filename(filename),
+    _rotatedFilename(filename + ".old"),
+    _fout(),
+    _nbEntries(0),
+    _compacting(false)
+{
+#ifdef _OPENMP
+    omp_init_lock(&_journalLock);
+#endif // _OPENMP
+}
+
+
+NOMAD::CacheJournal::~CacheJournal()
+{
+    if (_fout.is_open())
+    {
+        _fout.close();
+    }
+#ifdef _OPENMP
+    omp_destroy_lock(&_journalLock);
+#endif // _OPENMP
+}
+
+
+void NOMAD::CacheJournal::append(const NOMAD::EvalPoint& evalPoint)
+{
+    // Never use sgte in cache files
+    const NOMAD::Eval* eval = evalPoint.getEval(NOMAD::EvalType::BB);
+    if (nullptr == eval || !eval->goodForCacheFile())
+    {
+        return;
+    }
+
+#ifdef _OPENMP
+    omp_set_lock(&_journalLock);
+#endif // _OPENMP
+    if (!_fout.is_open())
+    {
+        _fout.open(_filename, std::ios::out | std::ios::app);
+        if (_fout.fail())
+        {
+            std::cerr << "Warning: CacheJournal: Cannot write to file " << _filename << std::endl;
+        }
+    }
+    if (_fout.is_open())
+    {
+        // std::endl flushes the stream.
+        _fout << evalPoint << std::endl;
+        _nbEntries++;
+    }
+#ifdef _OPENMP
+    omp_unset_lock(&_journalLock);
+#endif // _OPENMP
+}
+
+
+size_t NOMAD::CacheJournal::replay(NOMAD::CacheBase& cache) const
+{
+    size_t nbPoints = replayFile(cache, _rotatedFilename);
+    nbPoints += replayFile(cache, _filename);
+
+    if (nbPoints > 0)
+    {
+        // Need to recompute F and H on all cache points
+        cache.processOnAllPoints(NOMAD::CacheBase::recomputeFH);
+    }
+
+    return nbPoints;
+}
+
+
+size_t NOMAD::CacheJournal::replayFile(NOMAD::CacheBase& cache, const std::string& filename)
+{
+    size_t nbPoints = 0;
+    if (!NOMAD::checkReadFile(filename))
+    {
+        return nbPoints;
+    }
+
+    std::ifstream fin(filename);
+    NOMAD::EvalPoint evalPoint;
+    // Replayed points that are already in the cache are not cache hits.
+    const size_t nbCacheHits = cache.getNbCacheHits();
+    try
+    {
+        while (fin >> evalPoint && fin.good() && !fin.eof())
+        {
+            // Later entries replace the earlier ones.
+            if (!cache.insert(evalPoint))
+            {
+                cache.update(evalPoint, NOMAD::EvalType::BB);
+            }
+            nbPoints++;
+        }
+    }
+    catch (NOMAD::Exception &e)
+    {
+        // The last point may have been partially written when the run was interrupted.
+        std::string s = "Warning: CacheJournal: Stop reading " + filename + " after " + std::to_string(nbPoints) + " points: " + e.what();
+        NOMAD::OutputQueue::Add(s, NOMAD::OutputLevel::LEVEL_WARNING);
+    }
+    cache.setNbCacheHits(nbCacheHits);
+
+    return nbPoints;
+}
+
+
+bool NOMAD::CacheJournal::rotate()
+{
+    if (_compacting.exchange(true))
+    {
+        // Another thread is doing a compaction.
+        return false;
+    }
+
+#ifdef _OPENMP
+    omp_set_lock(&_journalLock);
+#endif // _OPENMP
+    if (_fout.is_open())
+    {
+        _fout.close();
+    }
+    if (NOMAD::checkReadFile(_filename))
+    {
+        if (NOMAD::checkReadFile(_rotatedFilename))
+        {
+            // A previous compaction did not succeed. Keep its points.
+            std::ifstream fin(_filename);
+            std::ofstream fout(_rotatedFilename, std::ios::out | std::ios::app);
+            fout << fin.rdbuf();
+            fin.close();
+            fout.close();
+            std::remove(_filename.c_str());
+        }
+        else
+        {
+            std::rename(_filename.c_str(), _rotatedFilename.c_str());
+        }
+    }
+    _nbEntries = 0;
+#ifdef _OPENMP
+    omp_unset_lock(&_journalLock);
+#endif // _OPENMP
+
+    return true;
+}
+
+
+void NOMAD::CacheJournal::removeRotated(const bool success)
+{
+    if (success)
+    {
+        std::remove(_rotatedFilename.c_str());
+    }
+    _compacting = false;
+}
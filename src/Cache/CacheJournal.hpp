@@ -0,0 +1,164 @@
+/*---------------------------------------------------------------------------------*/
+/*  NOMAD - Nonlinear Optimization by Mesh Adaptive Direct Search -                */
+/*                                                                                 */
+/*  NOMAD - Version 4.0.0 has been created by                                      */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  The copyright of NOMAD - version 4.0.0 is owned by                             */
+/*                 Sebastien Le Digabel        - Polytechnique Montreal            */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  NOMAD v4 has been funded by Rio Tinto, Hydro-Québec, NSERC (Natural Science    */
+/*  and Engineering Research Council of Canada), INOVEE (Innovation en Energie     */
+/*  Electrique and IVADO (The Institute for Data Valorization)                     */
+/*                                                                                 */
+/*  NOMAD v3 was created and developed by Charles Audet, Sebastien Le Digabel,     */
+/*  Christophe Tribes and Viviane Rochon Montplaisir and was funded by AFOSR       */
+/*  and Exxon Mobil.                                                               */
+/*                                                                                 */
+/*  NOMAD v1 and v2 were created and developed by Mark Abramson, Charles Audet,    */
+/*  Gilles Couture, and John E. Dennis Jr., and were funded by AFOSR and           */
+/*  Exxon Mobil.                                                                   */
+/*                                                                                 */
+/*  Contact information:                                                           */
+/*    Polytechnique Montreal - GERAD                                               */
+/*    C.P. 6079, Succ. Centre-ville, Montreal (Quebec) H3C 3A7 Canada              */
+/*    e-mail: nomad@gerad.ca                                                       */
+/*    phone : 1-514-340-6053 #6928                                                 */
+/*    fax   : 1-514-340-5665                                                       */
+/*                                                                                 */
+/*  This program is free software: you can redistribute it and/or modify it        */
+/*  under the terms of the GNU Lesser General Public License as published by       */
+/*  the Free Software Foundation, either version 3 of the License, or (at your     */
+/*  option) any later version.                                                     */
+/*                                                                                 */
+/*  This program is distributed in the hope that it will be useful, but WITHOUT    */
+/*  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or          */
+/*  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License    */
+/*  for more details.                                                              */
+/*                                                                                 */
+/*  You should have received a copy of the GNU Lesser General Public License       */
+/*  along with this program. If not, see <http://www.gnu.org/licenses/>.           */
+/*                                                                                 */
+/*  You can find information on the NOMAD software at www.gerad.ca/nomad           */
+/*---------------------------------------------------------------------------------*/
+/**
+ * \file   CacheJournal.hpp
+ * \brief  Append-only journal of the points evaluated since the cache file was written.
+ * \see    CacheJournal.cpp
+ */
+
+#ifndef __NOMAD400_CACHEJOURNAL__
+#define __NOMAD400_CACHEJOURNAL__
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif // _OPENMP
+
+#include <atomic>
+#include <fstream>
+
+#include "../Eval/EvalPoint.hpp"
+
+#include "../nomad_nsbegin.hpp"
+
+class CacheBase;
+
+/// Journal of the cache file.
+/**
+ * Each point is appended to the journal as soon as its blackbox evaluation
+   is done, in the format of the lines of the text cache file. The journal
+   is flushed after each point: if the run is interrupted, only the
+   evaluations in progress are lost.
+ *
+ * The journal is merged into the cache file when the cache file is
+   written (compaction). The compaction is done in this order:
+ * 1. rotate(): the journal is renamed to the rotated journal. New points are
+      appended to a new journal.
+ * 2. The cache is written to a temporary file, which is then renamed to the
+      cache file. All points of the rotated journal are in the cache at this
+      time, since a point is added to the journal after the cache is updated.
+ * 3. removeRotated(): the rotated journal is removed.
+ *
+ * If the run is interrupted at any time, the cache file, the rotated journal
+   and the journal hold all evaluated points. They are replayed in this order
+   when the cache file is read. Replaying a point twice is harmless.
+ */
+class CacheJournal
+{
+private:
+    std::string         _filename;          ///< Name of the journal
+    std::string         _rotatedFilename;   ///< Name of the journal during compaction
+    std::ofstream       _fout;              ///< Journal stream, opened at the first append
+    size_t              _nbEntries;         ///< Number of points appended since the last rotation
+    std::atomic<bool>   _compacting;        ///< True while a thread is doing a compaction
+
+#ifdef _OPENMP
+    omp_lock_t          _journalLock;       ///< Lock on the journal stream
+#endif // _OPENMP
+
+public:
+    /// Constructor
+    /**
+     \param filename    Name of the journal -- \b IN.
+     */
+    explicit CacheJournal(const std::string& filename);
+
+    /// Destructor
+    virtual ~CacheJournal();
+
+    /// Copy constructor not available
+    CacheJournal(const CacheJournal&) = delete;
+
+    /// Operator= not available
+    CacheJournal& operator=(const CacheJournal&) = delete;
+
+    const std::string& getFileName() const { return _filename; }
+
+    /// Number of points appended since the last compaction
+    size_t getNbEntries() const { return _nbEntries; }
+
+    /// Append an evaluated point to the journal, and flush.
+    /**
+     * Points with an Eval that is not good for the cache file are ignored.
+     \param evalPoint   The point with its blackbox Eval -- \b IN.
+     */
+    void append(const EvalPoint& evalPoint);
+
+    /// Insert or update the points of the rotated journal and of the journal in the cache.
+    /**
+     * F and h are recomputed, like for the text cache file.
+     * Must be called before the cache appends points to this journal.
+     \param cache   The cache   -- \b IN/OUT.
+     \return        The number of points replayed.
+     */
+    size_t replay(CacheBase& cache) const;
+
+    /// Start a compaction.
+    /**
+     * The journal is closed and renamed to the rotated journal. If there was
+       already a rotated journal (interrupted compaction), the journal is
+       appended to it.
+     \return \c false if another thread is already doing a compaction.
+     */
+    bool rotate();
+
+    /// End a compaction.
+    /**
+     * If the cache file was written, the rotated journal is removed.
+       Otherwise, it is kept and will be merged at the next compaction.
+     \param success     \c true if the cache file was written -- \b IN.
+     */
+    void removeRotated(const bool success);
+
+private:
+    /// Insert or update the points of a journal file in the cache.
+    static size_t replayFile(CacheBase& cache, const std::string& filename);
+};
+
+
+#include "../nomad_nsend.hpp"
+
+#endif // __NOMAD400_CACHEJOURNAL__
@@ -55,15 +55,11 @@
 #include "../Math/Point.hpp"
 #include "../Output/OutputQueue.hpp"
 
+#include <algorithm>
 #include <fstream>
 #include <iostream>
 
 // Init static members
-NOMAD::BBOutputTypeList NOMAD::CacheSet::_bbOutputType = NOMAD::BBOutputTypeList();
-std::unique_ptr<NOMAD::CacheBase> NOMAD::CacheBase::_single = nullptr;
-
-std::atomic<size_t> NOMAD::CacheBase::_nbCacheHits;
-
 #ifdef _OPENMP
 omp_lock_t NOMAD::CacheSet::_cacheLock;
 #endif // _OPENMP
@@ -77,6 +73,10 @@ void NOMAD::CacheSet::init()
     {
         throw NOMAD::Exception(__FILE__, __LINE__, "CacheParameters::checkAndComply() needs to be called before constructing a CacheSet.");
     }
+    _useIndex = _cacheParams->getAttributeValue<bool>("CACHE_SPATIAL_INDEX");
+    auto evictionType = _cacheParams->getAttributeValue<NOMAD::CacheEvictionType>("CACHE_EVICTION");
+    _useEviction = (NOMAD::CacheEvictionType::NONE != evictionType);
+    _eviction = NOMAD::CacheEviction(evictionType);
 #ifdef _OPENMP
     omp_init_lock(&_cacheLock);
 #endif // _OPENMP
@@ -173,11 +173,35 @@ bool NOMAD::CacheSet::insert(const NOMAD::EvalPoint &evalPoint)
         _n = evalPoint.size();
     }
 
-    std::pair<EvalPointSet::iterator,bool> ret;
+    std::pair<CacheEvalPointSet::iterator,bool> ret;
 #ifdef _OPENMP
     omp_set_lock(&_cacheLock);
 #endif // _OPENMP
     ret = _cache.insert(evalPoint);
+    if (ret.second)
+    {
+        _bestPoints.insert(&*ret.first);
+        if (_useIndex)
+        {
+            _index.insert(&*ret.first);
+        }
+    }
+    if (_useEviction)
+    {
+        if (ret.second)
+        {
+            _eviction.insert(&*ret.first);
+            if (NOMAD::INF_SIZE_T != _maxSize && _cache.size() > _maxSize)
+            {
+                // ret.first may be evicted: it is not used anymore.
+                evictPoints(_eviction, _cache.size() - _maxSize);
+            }
+        }
+        else
+        {
+            _eviction.hit(&*ret.first);
+        }
+    }
 #ifdef _OPENMP
     omp_unset_lock(&_cacheLock);
 #endif // _OPENMP
@@ -196,7 +220,27 @@ bool NOMAD::CacheSet::insert(const NOMAD::EvalPoint &evalPoint)
 size_t NOMAD::CacheSet::find(const NOMAD::Point& x, NOMAD::EvalPoint &evalPoint) const
 {
     size_t nbFound = 0;
-    EvalPointSet::const_iterator it;
+    CacheEvalPointSet::const_iterator it;
+    if (_useEviction)
+    {
+        // The point could be evicted by another thread. Lock, and
+        // register the hit for the eviction policy.
+#ifdef _OPENMP
+        omp_set_lock(&_cacheLock);
+#endif // _OPENMP
+        it = _cache.find(NOMAD::EvalPoint(x));
+        if (it != _cache.end())
+        {
+            evalPoint = *it;
+            _eviction.hit(&*it);
+            nbFound = 1;
+        }
+#ifdef _OPENMP
+        omp_unset_lock(&_cacheLock);
+#endif // _OPENMP
+        return nbFound;
+    }
+
     it = _cache.find(NOMAD::EvalPoint(x));
     if (it != _cache.end())
     {
@@ -228,21 +272,50 @@ bool NOMAD::CacheSet::smartInsert(const NOMAD::EvalPoint &evalPoint,
 
     bool inserted = false;
     bool doEval = true;
-    std::pair<EvalPointSet::iterator,bool> ret;   // Return of the insert()
+    std::pair<CacheEvalPointSet::iterator,bool> ret;   // Return of the insert()
 #ifdef _OPENMP
     omp_set_lock(&_cacheLock);
 #endif // _OPENMP
     ret = _cache.insert(evalPoint);
+    if (ret.second)
+    {
+        _bestPoints.insert(&*ret.first);
+        if (_useIndex)
+        {
+            _index.insert(&*ret.first);
+        }
+    }
+    inserted = ret.second;
+    bool canEval = (*ret.first).toEval(maxNumberEval, evalType);
+    const bool hasEval = (nullptr != (ret.first)->getEval(evalType));
+    // The display is only used for the info messages and the warning below.
+    const bool doDisplay = !(inserted && canEval)
+                           && (canEval || (NOMAD::EvalType::BB == evalType && NOMAD::OutputQueue::GoodLevel(NOMAD::OutputLevel::LEVEL_INFO)));
+    const std::string pointDisplay = doDisplay ? ret.first->display() : "";
+    if (_useEviction)
+    {
+        if (inserted)
+        {
+            _eviction.insert(&*ret.first);
+            if (NOMAD::INF_SIZE_T != _maxSize && _cache.size() > _maxSize)
+            {
+                // ret.first may be evicted: it is not used anymore.
+                evictPoints(_eviction, _cache.size() - _maxSize);
+            }
+        }
+        else
+        {
+            _eviction.hit(&*ret.first);
+        }
+    }
 #ifdef _OPENMP
     omp_unset_lock(&_cacheLock);
 #endif // _OPENMP
-    inserted = ret.second;
-    bool canEval = (*ret.first).toEval(maxNumberEval, evalType);
     if (inserted && canEval)
     {
         doEval = true;
     }
-    else if (nullptr == (ret.first)->getEval(evalType))
+    else if (!hasEval)
     {
         // Point already inserted, but not evaluated.
         // NOTE: We do not know if this point is in the evaluation queue yet, or not.
@@ -254,7 +327,7 @@ bool NOMAD::CacheSet::smartInsert(const NOMAD::EvalPoint &evalPoint,
         if (NOMAD::EvalType::BB == evalType)
         {
             std::string s = "Point already inserted in cache, but not evaluated: ";
-            s += ret.first->display();
+            s += pointDisplay;
             NOMAD::OutputQueue::Add(s, NOMAD::OutputLevel::LEVEL_INFO);
         }
 
@@ -270,12 +343,12 @@ bool NOMAD::CacheSet::smartInsert(const NOMAD::EvalPoint &evalPoint,
         {
             _nbCacheHits++;
             std::string s = "Cache hit: ";
-            s += ret.first->display();
+            s += pointDisplay;
             NOMAD::OutputQueue::Add(s, NOMAD::OutputLevel::LEVEL_INFO);
         }
         if (doEval)
         {
-            std::cerr << "Warning: CacheSet: smartInsert: New evaluation of point found in cache " << (*ret.first).display() << std::endl;
+            std::cerr << "Warning: CacheSet: smartInsert: New evaluation of point found in cache " << pointDisplay << std::endl;
         }
     }
 
@@ -305,7 +378,7 @@ size_t NOMAD::CacheSet::find(const NOMAD::Eval &refeval,
                              const EvalType& evalType) const
 {
     evalPointList.clear();
-    EvalPointSet::const_iterator it;
+    CacheEvalPointSet::const_iterator it;
     for (it = _cache.begin(); it != _cache.end(); ++it)
     {
         const NOMAD::Eval* eval = it->getEval(evalType);
@@ -315,8 +388,7 @@ size_t NOMAD::CacheSet::find(const NOMAD::Eval &refeval,
         }
         if (comp(*eval, refeval))
         {
-            NOMAD::EvalPoint evalPoint(*it);
-            evalPointList.push_back(evalPoint);
+            evalPointList.push_back(*it);
         }
     }
 
@@ -333,36 +405,36 @@ size_t NOMAD::CacheSet::findBest(bool (*comp)(const NOMAD::Eval&, const NOMAD::E
                      const EvalType& evalType) const
 {
     evalPointList.clear();
-    EvalPointSet::const_iterator it;
-    auto refeval = std::shared_ptr<NOMAD::Eval>(nullptr);
+    // The Eval of the best points found so far. It is shared by the
+    // points of evalPointList, so it is not copied.
+    const NOMAD::Eval* refeval = nullptr;
 
-    for (it = _cache.begin(); it != _cache.end(); ++it)
+    auto checkPoint = [&](const NOMAD::EvalPoint& evalPoint)
     {
-        NOMAD::EvalPoint evalPoint(*it);
         const NOMAD::Eval* eval = evalPoint.getEval(evalType);
         if (nullptr == eval || NOMAD::EvalStatusType::EVAL_OK != eval->getEvalStatus())
         {
-            continue;
+            return;
         }
         if (findFeas != eval->isFeasible())
         {
-            continue;
+            return;
         }
         if (eval->getH() > hMax)
         {
-            continue;
+            return;
         }
         // Must be in the sub-space defined by fixedVariable
         if (!evalPoint.hasFixed(fixedVariable))
         {
-            continue;
+            return;
         }
 
         if (nullptr == refeval)
         {
             // Found first point
-            refeval = std::make_shared<NOMAD::Eval>(*eval);
             evalPointList.push_back(evalPoint);
+            refeval = evalPointList[0].getEval(evalType);
         }
         else if (*eval == *refeval)
         {
@@ -372,10 +444,35 @@ size_t NOMAD::CacheSet::findBest(bool (*comp)(const NOMAD::Eval&, const NOMAD::E
         else if (comp(*eval, *refeval))
         {
             // Found a better point
-            *refeval = *eval;
             // Reset list with new best
             evalPointList.clear();
             evalPointList.push_back(evalPoint);
+            refeval = evalPointList[0].getEval(evalType);
+        }
+    };
+
+    if (_useIndex && NOMAD::CacheIndex::isSubproblem(fixedVariable))
+    {
+        // Only go through the points of the subproblem.
+#ifdef _OPENMP
+        omp_set_lock(&_cacheLock);
+#endif // _OPENMP
+        const auto& subproblemPoints = _index.getPattern(fixedVariable, _cache);
+        for (auto evalPoint : subproblemPoints)
+        {
+            checkPoint(*evalPoint);
+        }
+#ifdef _OPENMP
+        omp_unset_lock(&_cacheLock);
+#endif // _OPENMP
+        // Give the points in the same order as going through the cache.
+        std::sort(evalPointList.begin(), evalPointList.end(), NOMAD::EvalPointCompare());
+    }
+    else
+    {
+        for (auto it = _cache.begin(); it != _cache.end(); ++it)
+        {
+            checkPoint(*it);
         }
     }
 
@@ -387,7 +484,25 @@ size_t NOMAD::CacheSet::findBestFeas(std::vector<NOMAD::EvalPoint> &evalPointLis
                                      const NOMAD::Point& fixedVariable,
                                      const EvalType& evalType) const
 {
-    findBest(NOMAD::Eval::compEvalFindBest, evalPointList, true, 0, fixedVariable, evalType);
+    bool found = false;
+    if (NOMAD::CacheBestPoints::canBeUsed(evalType))
+    {
+#ifdef _OPENMP
+        omp_set_lock(&_cacheLock);
+#endif // _OPENMP
+        if (!_bestPoints.isValid())
+        {
+            _bestPoints.rebuild(_cache);
+        }
+        found = _bestPoints.findBestFeas(fixedVariable, evalPointList);
+#ifdef _OPENMP
+        omp_unset_lock(&_cacheLock);
+#endif // _OPENMP
+    }
+    if (!found)
+    {
+        findBest(NOMAD::Eval::compEvalFindBest, evalPointList, true, 0, fixedVariable, evalType);
+    }
     return evalPointList.size();
 }
 
@@ -396,6 +511,26 @@ bool NOMAD::CacheSet::hasFeas(const EvalType& evalType) const
 {
     bool ret = false;
 
+    if (NOMAD::EvalType::BB == evalType)
+    {
+#ifdef _OPENMP
+        omp_set_lock(&_cacheLock);
+#endif // _OPENMP
+        if (!_bestPoints.isValid())
+        {
+            _bestPoints.rebuild(_cache);
+        }
+        const bool valid = _bestPoints.isValid();
+        ret = valid && _bestPoints.hasFeas();
+#ifdef _OPENMP
+        omp_unset_lock(&_cacheLock);
+#endif // _OPENMP
+        if (valid)
+        {
+            return ret;
+        }
+    }
+
     for (auto it = _cache.begin(); it != _cache.end(); ++it)
     {
         const NOMAD::Eval* eval = (*it).getEval(evalType);
@@ -419,7 +554,25 @@ size_t NOMAD::CacheSet::findBestInf(std::vector<NOMAD::EvalPoint> &evalPointList
                                     const NOMAD::Point& fixedVariable,
                                     const EvalType& evalType) const
 {
-    findBest(NOMAD::Eval::compEvalFindBest, evalPointList, false, hMax, fixedVariable, evalType);
+    bool found = false;
+    if (NOMAD::CacheBestPoints::canBeUsed(evalType))
+    {
+#ifdef _OPENMP
+        omp_set_lock(&_cacheLock);
+#endif // _OPENMP
+        if (!_bestPoints.isValid())
+        {
+            _bestPoints.rebuild(_cache);
+        }
+        found = _bestPoints.findBestInf(hMax, fixedVariable, evalPointList);
+#ifdef _OPENMP
+        omp_unset_lock(&_cacheLock);
+#endif // _OPENMP
+    }
+    if (!found)
+    {
+        findBest(NOMAD::Eval::compEvalFindBest, evalPointList, false, hMax, fixedVariable, evalType);
+    }
 
     return evalPointList.size();
 }
@@ -436,8 +589,36 @@ size_t NOMAD::CacheSet::find(NOMAD::Point X,
     evalPointList.clear();
 
     bool stopWhenMaxFound = (maxEvalPoints > 0);
+
+    if (_useIndex)
+    {
+        std::vector<const NOMAD::EvalPoint*> evalPoints;
+#ifdef _OPENMP
+        omp_set_lock(&_cacheLock);
+#endif // _OPENMP
+        _index.findInRadius(X, distance, evalPoints);
+        // Select the same points as going through the cache.
+        NOMAD::EvalPointCompare evalPointCompare;
+        std::sort(evalPoints.begin(), evalPoints.end(),
+                  [&evalPointCompare](const NOMAD::EvalPoint* p1, const NOMAD::EvalPoint* p2)
+                  { return evalPointCompare(*p1, *p2); });
+        if (stopWhenMaxFound && evalPoints.size() > (size_t)maxEvalPoints)
+        {
+            evalPoints.resize(maxEvalPoints);
+        }
+        for (auto evalPoint : evalPoints)
+        {
+            evalPointList.push_back(*evalPoint);
+        }
+#ifdef _OPENMP
+        omp_unset_lock(&_cacheLock);
+#endif // _OPENMP
+
+        return evalPointList.size();
+    }
+
     bool errSizeDisplayed = false;  // Error about size to be displayed only once.
-    EvalPointSet::const_iterator it;
+    CacheEvalPointSet::const_iterator it;
     for (it = _cache.begin(); it != _cache.end(); ++it)
     {
         if (X.size() != it->size())
@@ -456,8 +637,7 @@ size_t NOMAD::CacheSet::find(NOMAD::Point X,
 
         if (NOMAD::Point::dist(X, *it) <= distance)
         {
-            NOMAD::EvalPoint evalPoint(*it);
-            evalPointList.push_back(evalPoint);
+            evalPointList.push_back(*it);
             if (stopWhenMaxFound && evalPointList.size() >= (uint)maxEvalPoints)
             {
                 break;
@@ -468,17 +648,71 @@ size_t NOMAD::CacheSet::find(NOMAD::Point X,
 }
 
 
+size_t NOMAD::CacheSet::findNearest(const NOMAD::Point& X,
+                                    const size_t k,
+                                    std::vector<NOMAD::EvalPoint> &evalPointList) const
+{
+    verifyPointComplete(X);
+    verifyPointSize(X);
+    evalPointList.clear();
+
+    std::vector<const NOMAD::EvalPoint*> evalPoints;
+#ifdef _OPENMP
+    omp_set_lock(&_cacheLock);
+#endif // _OPENMP
+    if (_useIndex)
+    {
+        _index.findNearest(X, k, evalPoints);
+    }
+    else
+    {
+        // Go through all the cache, and keep the k nearest.
+        typedef std::pair<NOMAD::Double, const NOMAD::EvalPoint*> Candidate;
+        std::vector<Candidate> candidates;
+        candidates.reserve(_cache.size());
+        for (auto it = _cache.begin(); it != _cache.end(); ++it)
+        {
+            if (X.size() == it->size())
+            {
+                candidates.push_back(Candidate(NOMAD::Point::dist(X, *it), &*it));
+            }
+        }
+        NOMAD::EvalPointCompare evalPointCompare;
+        auto candidateLess = [&evalPointCompare](const Candidate& c1, const Candidate& c2)
+        {
+            return (c1.first.todouble() < c2.first.todouble())
+                   || (c1.first.todouble() == c2.first.todouble() && evalPointCompare(*c1.second, *c2.second));
+        };
+        const size_t nbNearest = std::min(k, candidates.size());
+        std::partial_sort(candidates.begin(), candidates.begin() + nbNearest, candidates.end(), candidateLess);
+        for (size_t i = 0; i < nbNearest; i++)
+        {
+            evalPoints.push_back(candidates[i].second);
+        }
+    }
+    for (auto evalPoint : evalPoints)
+    {
+        evalPointList.push_back(*evalPoint);
+    }
+#ifdef _OPENMP
+    omp_unset_lock(&_cacheLock);
+#endif // _OPENMP
+
+    return evalPointList.size();
+}
+
+
 size_t NOMAD::CacheSet::find(bool (*crit)(const NOMAD::EvalPoint&),
                      std::vector<NOMAD::EvalPoint> &evalPointList) const
 {
     evalPointList.clear();
-    EvalPointSet::const_iterator it;
+    CacheEvalPointSet::const_iterator it;
     for (it = _cache.begin(); it != _cache.end(); ++it)
     {
-        NOMAD::EvalPoint evalPoint(*it);
-        if (crit(evalPoint))
+        // Only copy the points that are kept.
+        if (crit(*it))
         {
-            evalPointList.push_back(evalPoint);
+            evalPointList.push_back(*it);
         }
     }
 
@@ -504,9 +738,28 @@ bool NOMAD::CacheSet::update(const NOMAD::EvalPoint& evalPoint, const EvalType&
         return false;
     }
 
-    EvalPointSet::const_iterator it;
+    CacheEvalPointSet::const_iterator it;
+#ifdef _OPENMP
+    omp_set_lock(&_cacheLock);
+#endif // _OPENMP
     it = _cache.find(evalPoint);
-    if (it == _cache.end())
+    if (it == _cache.end() && _useEviction)
+    {
+        // The point was evicted while waiting to be evaluated. Insert it again.
+        auto ret = _cache.insert(evalPoint);
+        _bestPoints.insert(&*ret.first);
+        if (_useIndex)
+        {
+            _index.insert(&*ret.first);
+        }
+        _eviction.insert(&*ret.first);
+        if (NOMAD::INF_SIZE_T != _maxSize && _cache.size() > _maxSize)
+        {
+            evictPoints(_eviction, _cache.size() - _maxSize);
+        }
+        updateOk = true;
+    }
+    else if (it == _cache.end())
     {
         std::string err = "Warning: CacheSet: Update: Did not find EvalPoint to update in cache: " + evalPoint.displayAll();
         NOMAD::OutputQueue::Add(err, NOMAD::OutputLevel::LEVEL_WARNING);
@@ -516,11 +769,34 @@ bool NOMAD::CacheSet::update(const NOMAD::EvalPoint& evalPoint, const EvalType&
         // Update EvalPoint in cache directly.
         // Since we are not changing the Point part, which is the only part
         // used for sorting, the cache should remain coherent.
+        // The blackbox Eval is used to order _bestPoints.
         auto cacheEvalPoint = const_cast<NOMAD::EvalPoint*>(&*it);
-        cacheEvalPoint->setEval(*evalPoint.getEval(evalType), evalType);
+        if (NOMAD::EvalType::BB == evalType && _bestPoints.isValid())
+        {
+            _bestPoints.erase(cacheEvalPoint);
+        }
+        cacheEvalPoint->shareEval(evalPoint, evalType);
         cacheEvalPoint->setNumberEval(evalPoint.getNumberEval());
+        if (NOMAD::EvalType::BB == evalType && _bestPoints.isValid())
+        {
+            _bestPoints.insert(cacheEvalPoint);
+        }
+        if (NOMAD::EvalType::BB == evalType && _useEviction)
+        {
+            // The point may now be evicted.
+            _eviction.update(cacheEvalPoint);
+        }
         updateOk = true;
     }
+#ifdef _OPENMP
+    omp_unset_lock(&_cacheLock);
+#endif // _OPENMP
+
+    if (updateOk)
+    {
+        appendToJournal(evalPoint, evalType);
+        addToEvaluatedPoints(evalPoint, evalType);
+    }
 
     return updateOk;
 }
@@ -533,10 +809,15 @@ bool NOMAD::CacheSet::clear()
     omp_set_lock(&_cacheLock);
 #endif // _OPENMP
     _cache.clear();
+    _index.clear();
+    _bestPoints.clear();
+    _eviction.clear();
 #ifdef _OPENMP
     omp_unset_lock(&_cacheLock);
 #endif // _OPENMP
 
+    clearEvaluatedPoints();
+
     // Note: We might not want to reset - in that case, remove this line.
     resetNbCacheHits();
 
@@ -547,102 +828,114 @@ bool NOMAD::CacheSet::clear()
 // Clear all sgte evaluations from the cache
 void NOMAD::CacheSet::clearSgte()
 {
-    processOnAllPoints(NOMAD::EvalPoint::clearEvalSgte);
+    // Do not use processOnAllPoints(): the blackbox evals, and so
+    // _bestPoints, are not modified.
+    for (auto it = _cache.begin(); it != _cache.end(); ++it)
+    {
+        auto evalPoint = const_cast<NOMAD::EvalPoint*>(&*it);
+        NOMAD::EvalPoint::clearEvalSgte(*evalPoint);
+    }
 }
 
 
 // Purge the cache for space.
 //
-// Current implementation:
-// For now, we only keep EvalPoints which have an f under the mean f.
-// We should also keep points that are cache hits, or that were recent cache hits.
-// TODO: There should be a concept of time / oldness of points.
-// It could be related to the iteration where the point was added,
-// or to the number of purges it survived, etc.
-// We might need a CachePoint class to keep that information.
-// Etc.
-//
-// General idea: We want to keep points that might be hit again, to
-// avoid having to recompute them.
-// We also want to keep points that are good enough to be interesting to the
-// user.
-//
+// The points are chosen by the eviction queue: the points that are the
+// least likely to be hit again, or the least interesting to the user,
+// are removed first, following CACHE_EVICTION.
+// If CACHE_EVICTION is NONE, a temporary queue following policy F is
+// used: points without f, then the worst infeasible points, then the
+// worst feasible points are removed.
+// Points being evaluated and the best points are never removed. The
+// cache may then stay over MAX_CACHE_SIZE.
 void NOMAD::CacheSet::purge()
 {
-    std::cerr << "Warning: Calling Cache purge. Size is " << _cache.size() << " max is " << _maxSize << ". Some points will be removed from the cache." << std::endl;
-    if ( _maxSize== NOMAD::INF_SIZE_T || _cache.size() < _maxSize)
+    if (NOMAD::INF_SIZE_T == _maxSize || _cache.size() < _maxSize)
     {
         // Do nothing
         return;
     }
-    size_t nbRemovedLast = 1;
+    std::cerr << "Warning: Calling Cache purge. Size is " << _cache.size() << " max is " << _maxSize << ". Some points will be removed from the cache." << std::endl;
 
 #ifdef _OPENMP
     omp_set_lock(&_cacheLock);
 #endif // _OPENMP
-
-    while (_cache.size() >= _maxSize)
+    const size_t nbToEvict = _cache.size() - _maxSize + 1;
+    if (_useEviction)
     {
-        EvalPointSet tmpCache;
-        NOMAD::Double meanF;
-        size_t nbElemWithF = computeMeanF(meanF);
-        //std::cout << "Debug: purge: meanF = " << meanF << " nb elem = " << nbElemWithF << std::endl;
-
-        if (nbElemWithF > 0 && nbRemovedLast > 0)
+        evictPoints(_eviction, nbToEvict);
+    }
+    else
+    {
+        NOMAD::CacheEviction eviction(NOMAD::CacheEvictionType::F, 0);
+        for (auto it = _cache.begin(); it != _cache.end(); ++it)
         {
-            // Remove all EvalPoints for which f is over or equal to the mean.
-            // For this, use a temporary set/cache, because we
-            // cannot iterate over a set and erase items at the same time.
-            EvalPointSet::const_iterator it;
-            for (it = _cache.begin(); it != _cache.end(); ++it)
-            {
-                if (!it->getF(NOMAD::EvalType::BB).isDefined())
-                {
-                    continue;
-                }
-                if (it->getF(NOMAD::EvalType::BB) < meanF)
-                {
-                    //std::cout << "Debug: purge: insert EvalPoint with f = " << it->getF(NOMAD::EvalType::BB) << " to tmpCache" << std::endl;
-                    tmpCache.insert(*it);
-                }
-                else
-                {
-                    //std::cout << "Debug: purge: Do not insert EvalPoint with f = " << it->getF(NOMAD::EvalType::BB) << " to tmpCache" << std::endl;
-                }
-            }
+            eviction.insert(&*it);
         }
-        else
+        evictPoints(eviction, nbToEvict);
+    }
+#ifdef _OPENMP
+    omp_unset_lock(&_cacheLock);
+#endif // _OPENMP
+}
+
+
+// Erase the points chosen by the eviction queue.
+// The best feasible and infeasible points are never erased: the
+// algorithms initialize their barrier from the cache.
+// The cache is locked by the caller.
+void NOMAD::CacheSet::evictPoints(NOMAD::CacheEviction& eviction, const size_t k)
+{
+    if (!_bestPoints.isValid())
+    {
+        _bestPoints.rebuild(_cache);
+    }
+    const NOMAD::Point fixedVariable(_n);
+    std::vector<NOMAD::EvalPoint> bestFeas, bestInf;
+    _bestPoints.findBestFeas(fixedVariable, bestFeas);
+    _bestPoints.findBestInf(NOMAD::INF, fixedVariable, bestInf);
+
+    std::vector<const NOMAD::EvalPoint*> kept;
+    for (auto bestPoints : { &bestFeas, &bestInf })
+    {
+        for (auto bestPoint : *bestPoints)
         {
-            // Remove arbitrarly half the elements of cache.
-            // Keep the first half.
-            // TODO Review how is the set ordered, could we use that
-            // order to better fill tmpCache (in both f and non-f cases) ?
-            size_t i = 0;
-            EvalPointSet::const_iterator it;
-            for (it = _cache.begin(); i < _cache.size() / 2; ++it, i++)
+            auto it = _cache.find(bestPoint);
+            if (it != _cache.end())
             {
-                tmpCache.insert(*it);
+                kept.push_back(&*it);
             }
         }
+    }
+
+    // Policy DISTANCE: keep the points near the best feasible point, or
+    // near the best infeasible point if there is no feasible point.
+    NOMAD::Point reference;
+    if (!bestFeas.empty())
+    {
+        reference = *bestFeas[0].getX();
+    }
+    else if (!bestInf.empty())
+    {
+        reference = *bestInf[0].getX();
+    }
 
-        // If tmpCache is empty, set nbRemovedLast to 0 and the next loop
-        // will go to the "else" case.
-        if (0 == tmpCache.size())
+    std::vector<const NOMAD::EvalPoint*> evicted;
+    eviction.evict(k, reference, kept, evicted);
+
+    for (auto evalPoint : evicted)
+    {
+        if (_bestPoints.isValid())
         {
-            nbRemovedLast = 0;
+            _bestPoints.erase(evalPoint);
         }
-        else
+        if (_useIndex)
         {
-            //std::cout << "Debug: Cache has     " << _cache.size() << " elements." << std::endl;
-            //std::cout << "Debug: Tmp cache has " << tmpCache.size() << " elements." << std::endl;
-            nbRemovedLast = _cache.size() - tmpCache.size();
-            _cache.clear();
-            _cache = std::move(tmpCache);
+            _index.erase(evalPoint);
         }
+        // Erase last: evalPoint is not valid anymore.
+        _cache.erase(_cache.find(*evalPoint));
     }
-#ifdef _OPENMP
-    omp_unset_lock(&_cacheLock);
-#endif // _OPENMP
 }
 
 
@@ -652,7 +945,7 @@ size_t NOMAD::CacheSet::computeMeanF(NOMAD::Double &mean) const
     size_t nbElem = 0;
     NOMAD::Double total = 0;
     mean.reset();
-    EvalPointSet::const_iterator it;
+    CacheEvalPointSet::const_iterator it;
     for (it = _cache.begin(); it != _cache.end(); ++it)
     {
         NOMAD::Double f = it->getF(NOMAD::EvalType::BB);
@@ -674,36 +967,53 @@ size_t NOMAD::CacheSet::computeMeanF(NOMAD::Double &mean) const
 // Call function func on all points in cache.
 void NOMAD::CacheSet::processOnAllPoints(void (*func)(NOMAD::EvalPoint&))
 {
+    // func() may modify the evals: _bestPoints will be rebuilt when needed.
+#ifdef _OPENMP
+    omp_set_lock(&_cacheLock);
+#endif // _OPENMP
+    _bestPoints.invalidate();
+#ifdef _OPENMP
+    omp_unset_lock(&_cacheLock);
+#endif // _OPENMP
+
     for (auto it = _cache.begin(); it != _cache.end(); ++it)
     {
         auto evalPoint = const_cast<NOMAD::EvalPoint*>(&*it);
         func(*evalPoint);
     }
+
+    if (_useEviction)
+    {
+        // The keys of the eviction queue may depend on the evals.
+#ifdef _OPENMP
+        omp_set_lock(&_cacheLock);
+#endif // _OPENMP
+        for (auto it = _cache.begin(); it != _cache.end(); ++it)
+        {
+            _eviction.update(&*it);
+        }
+#ifdef _OPENMP
+        omp_unset_lock(&_cacheLock);
+#endif // _OPENMP
+    }
 }
 
 
-// Write cache to file _filename
-// This function will use operator<< defined below
+// Write cache to file _filename.
+// The format and the journal are handled by CacheBase::writeFile().
 bool NOMAD::CacheSet::write() const
 {
     std::string s = "Write cache file " + _filename;
     NOMAD::OutputQueue::Add(s);
-    return NOMAD::write(*this, _filename);
+    return writeFile();
 }
 
 
 // Read _filename as written by write(), and add the points to the cache.
-// This function will use operator>> defined below.
+// The format and the journal are handled by CacheBase::readFile().
 bool NOMAD::CacheSet::read()
 {
-    bool fileRead = false;
-    if (NOMAD::checkReadFile(_filename))
-    {
-        std::string s = "Read cache file " + _filename;
-        NOMAD::OutputQueue::Add(s, NOMAD::OutputLevel::LEVEL_NORMAL);
-        fileRead = NOMAD::read(*this, _filename);
-    }
-    return fileRead;
+    return readFile();
 }
 
 
@@ -711,7 +1021,7 @@ bool NOMAD::CacheSet::read()
 // Useful mostly for debugging purposes
 std::ostream& NOMAD::CacheSet::displayAll(std::ostream& os) const
 {
-    EvalPointSet::const_iterator it;
+    CacheEvalPointSet::const_iterator it;
     for (it = _cache.begin(); it != _cache.end(); ++it)
     {
         os << *it;
@@ -726,7 +1036,7 @@ std::ostream& NOMAD::CacheSet::displayAll(std::ostream& os) const
 // This method is used to write points to cache.
 std::ostream& NOMAD::CacheSet::displayPointsWithEval(std::ostream& os) const
 {
-    EvalPointSet::const_iterator it;
+    CacheEvalPointSet::const_iterator it;
     for (it = _cache.begin(); it != _cache.end(); ++it)
     {
         NOMAD::EvalPoint evalPoint = *it;
@@ -738,81 +1048,3 @@ std::ostream& NOMAD::CacheSet::displayPointsWithEval(std::ostream& os) const
 
     return os;
 }
-
-
-// Display only EvalPoints that have an eval.
-std::ostream& NOMAD::operator<<(std::ostream& os, const NOMAD::CacheSet& cache)
-{
-    os << "CACHE_HITS " << cache.getNbCacheHits() << std::endl;
-    os << "BB_OUTPUT_TYPE " << cache.getBbOutputType() << std::endl;
-    cache.displayPointsWithEval(os);
-
-    return os;
-}
-
-
-// Get these EvalPoints from stream
-std::istream& NOMAD::operator>>(std::istream& is, NOMAD::CacheSet& cache)
-{
-    std::string s;
-
-    is >> s;
-    if ("CACHE_HITS" == s)
-    {
-        size_t cacheHits;
-        is >> cacheHits;
-        cache.setNbCacheHits(cacheHits);
-    }
-    else
-    {
-        // Put back s to istream.
-        for (unsigned i = 0; i < s.size(); i++)
-        {
-            is.unget();
-        }
-    }
-
-    is >> s;
-    if ("BB_OUTPUT_TYPE" == s)
-    {
-        NOMAD::BBOutputTypeList bbOutputTypes;
-
-        while (is >> s && is.good() && !is.eof())
-        {
-            if (NOMAD::ArrayOfDouble::pStart == s)
-            {
-                is.unget();
-                break;
-            }
-            else
-            {
-                bbOutputTypes.push_back(NOMAD::stringToBBOutputType(s));
-            }
-        }
-
-        cache.setBBOutputType(bbOutputTypes);
-    }
-
-
-    NOMAD::EvalPoint evalPoint;
-    while (is >> evalPoint && is.good() && !is.eof())
-    {
-        cache.insert(evalPoint);
-    }
-
-    // Need to recompute F and H on all cache points
-    NOMAD::CacheBase::getInstance()->processOnAllPoints(NOMAD::CacheSet::recomputeFH);
-
-    return is;
-}
-
-
-// Recompute f and h, using BB eval.
-void NOMAD::CacheSet::recomputeFH(NOMAD::EvalPoint& evalPoint)
-{
-    auto eval = evalPoint.getEval(NOMAD::EvalType::BB);
-    if (eval)
-    {
-        eval->setBBOutputAndRecompute(eval->getBBOutput(), _bbOutputType);
-    }
-}
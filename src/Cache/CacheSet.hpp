@@ -56,6 +56,9 @@
 #define __NOMAD400_CACHESET__
 
 #include "../Cache/CacheBase.hpp"
+#include "../Cache/CacheBestPoints.hpp"
+#include "../Cache/CacheEviction.hpp"
+#include "../Cache/CacheIndex.hpp"
 #include "../Eval/Eval.hpp"
 #include "../Eval/EvalPoint.hpp"
 #include "../Math/Point.hpp"
@@ -66,6 +69,14 @@
 /// Class implementating the abstract class \b CacheBase
 /**
 * Uses a set or unordered set of EvalPoint for the cache.
+* If CACHE_SPATIAL_INDEX is true, a CacheIndex is maintained on the side, to
+  avoid going through all the cache for distance and subproblem queries.
+* The points with a blackbox evaluation are also kept ordered in a
+  CacheBestPoints, so that findBestFeas, findBestInf and hasFeas do not go
+  through all the cache.
+* If CACHE_EVICTION is set and MAX_CACHE_SIZE is finite, evaluated points are
+  evicted on insertion, following a CacheEviction queue, to keep the cache
+  under MAX_CACHE_SIZE.
 */
 class CacheSet : public CacheBase {
 
@@ -76,9 +87,16 @@ private:
     static omp_lock_t _cacheLock;
 #endif // _OPENMP
 
-    static BBOutputTypeList _bbOutputType; ///< Corresponds to parameter BB_OUTPUT_TYPE used for this cach
 
-    EvalPointSet _cache;  ///< The set of points that constitutes the cache.
+    CacheEvalPointSet _cache;   ///< The set of points that constitutes the cache.
+
+    bool _useIndex;             ///< Parameter CACHE_SPATIAL_INDEX
+    mutable CacheIndex _index;  ///< Spatial and subproblem indexes, when _useIndex is true. Patterns are registered by const queries.
+
+    mutable CacheBestPoints _bestPoints; ///< Points ordered for findBestFeas and findBestInf. Rebuilt by const queries when invalid.
+
+    bool _useEviction;                  ///< True if CACHE_EVICTION is not NONE
+    mutable CacheEviction _eviction;    ///< Eviction queue, when _useEviction is true. Hits are registered by const queries.
 
 
     /// Constructor
@@ -87,7 +105,12 @@ private:
      */
     explicit CacheSet(const std::shared_ptr<CacheParameters>& cacheParams)
       : CacheBase(cacheParams),
-        _cache()
+        _cache(),
+        _useIndex(false),
+        _index(),
+        _bestPoints(),
+        _useEviction(false),
+        _eviction()
     {
         init();
     }
@@ -112,15 +135,6 @@ public:
     static void setInstance(const std::shared_ptr<CacheParameters>& cacheParams,
                             const BBOutputTypeList& bbOutputType);
 
-    /// Get the list of blackbox output types
-    static BBOutputTypeList getBbOutputType() { return _bbOutputType; }
-    
-    /// Set the list of blackbox output type
-    /**
-     \param bbOutputType    The list to use in cache -- \b IN.
-     */
-    static void setBBOutputType(const BBOutputTypeList& bbOutputType) { _bbOutputType = bbOutputType; }
-
     /// Add a new EvalPoint to the cache
     /**
      \param evalPoint   The eval point to insert in the cache     -- \b IN.
@@ -240,6 +254,17 @@ public:
                 std::vector<EvalPoint> &evalPointList,
                 int maxEvalPoints = 0) const override;
 
+    /// Get the k eval points nearest to point X.
+    /**
+     \param X                The point of reference                  -- \b IN.
+     \param k                The number of points to select          -- \b IN.
+     \param evalPointList    The nearest eval points, nearest first  -- \b OUT.
+     \return                 The number of eval points found.
+     */
+    size_t findNearest(const Point& X,
+                       const size_t k,
+                       std::vector<EvalPoint> &evalPointList) const override;
+
     /// \brief Find using criteria.
     /**
      All the points for which crit() return true are put in evalPointList.
@@ -274,10 +299,17 @@ public:
     void clearSgte() override;
 
     /** Purge the cache to get under MAX_CACHE_SIZE.
-     * \todo The current implementation is naïve. It could be more sophisticated.
+     * The points are chosen by the CACHE_EVICTION policy, or by policy F if
+       CACHE_EVICTION is NONE.
      */
     void purge() override;
 
+    /// Number of points evicted from the cache.
+    size_t getNbEvicted() const override { return _eviction.getNbEvicted(); }
+
+    /// Number of evicted points that were inserted again in the cache.
+    size_t getNbEvictedReinserted() const override { return _eviction.getNbReinserted(); }
+
     /// Write cache to file _filename.
     bool write() const override;
 
@@ -292,7 +324,7 @@ public:
      * \todo Write to a binary file.
      * \note the EvalPoint's Eval must satisfy method Eval::goodForCacheFile().
      */
-    std::ostream& displayPointsWithEval(std::ostream& os) const;
+    std::ostream& displayPointsWithEval(std::ostream& os) const override;
 
     /// Compute the mean f.
     /**
@@ -304,13 +336,6 @@ public:
     /// Call function func() on all EvalPoint in cache.
     void processOnAllPoints(void (*func)(EvalPoint&)) override;
 
-    /// Recompute F and H on a cache point.
-    /**
-      Helper for read - where only BBO is set.
-     \param evalPoint       The eval point to update in cache -- \b IN.
-     */
-    static void recomputeFH(EvalPoint& evalPoint);
-
 private:
     /// Private initialization function for internal use by constructor.
     void init();
@@ -318,6 +343,15 @@ private:
     /// Private function for internal use by destructor.
     void destroy();
 
+    /// Evict k points from the cache.
+    /**
+     * Erase the points chosen by the eviction queue from the cache and its
+       indexes. The cache must be locked.
+     \param eviction    The eviction queue    -- \b IN/OUT.
+     \param k           Number of points      -- \b IN.
+     */
+    void evictPoints(CacheEviction& eviction, const size_t k);
+
     /// Helper function for find and insertion.
     /**
      Throw exception if error. Do nothing otherwise.
@@ -351,12 +385,6 @@ private:
     void verifyPointSize(const EvalPoint& evalPoint) const;
 };
 
-/// Display only EvalPoints that have an eval.
-std::ostream& operator<<(std::ostream& os, const CacheSet& cache);
-
-/// Get these EvalPoints from stream
-std::istream& operator>>(std::istream& is, CacheSet& cache);
-
 #include "../nomad_nsend.hpp"
 
 #endif // __NOMAD400_CACHESET__
@@ -0,0 +1,774 @@
+/*---------------------------------------------------------------------------------*/
+/*  NOMAD - Nonlinear Optimization by Mesh Adaptive Direct Search -                */
+/*                                                                                 */
+/*  NOMAD - Version 4.0.0 has been created by                                      */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  The copyright of NOMAD - version 4.0.0 is owned by                             */
+/*                 Sebastien Le Digabel        - Polytechnique Montreal            */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  NOMAD v4 has been funded by Rio Tinto, Hydro-Québec, NSERC (Natural Science    */
+/*  and Engineering Research Council of Canada), INOVEE (Innovation en Energie     */
+/*  Electrique and IVADO (The Institute for Data Valorization)                     */
+/*                                                                                 */
+/*  NOMAD v3 was created and developed by Charles Audet, Sebastien Le Digabel,     */
+/*  Christophe Tribes and Viviane Rochon Montplaisir and was funded by AFOSR       */
+/*  and Exxon Mobil.                                                               */
+/*                                                                                 */
+/*  NOMAD v1 and v2 were created and developed by Mark Abramson, Charles Audet,    */
+/*  Gilles Couture, and John E. Dennis Jr., and were funded by AFOSR and           */
+/*  Exxon Mobil.                                                                   */
+/*                                                                                 */
+/*  Contact information:                                                           */
+/*    Polytechnique Montreal - GERAD                                               */
+/*    C.P. 6079, Succ. Centre-ville, Montreal (Quebec) H3C 3A7 Canada              */
+/*    e-mail: nomad@gerad.ca                                                       */
+/*    phone : 1-514-340-6053 #6928                                                 */
+/*    fax   : 1-514-340-5665                                                       */
+/*                                                                                 */
+/*  This program is free software: you can redistribute it and/or modify it        */
+/*  under the terms of the GNU Lesser General Public License as published by       */
+/*  the Free Software Foundation, either version 3 of the License, or (at your     */
+/*  option) any later version.                                                     */
+/*                                                                                 */
+/*  This program is distributed in the hope that it will be useful, but WITHOUT    */
+/*  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or          */
+/*  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License    */
+/*  for more details.                                                              */
+/*                                                                                 */
+/*  You should have received a copy of the GNU Lesser General Public License       */
+/*  along with this program. If not, see <http://www.gnu.org/licenses/>.           */
+/*                                                                                 */
+/*  You can find information on the NOMAD software at www.gerad.ca/nomad           */
+/*---------------------------------------------------------------------------------*/
+/**
+ \file   CacheShardedSet.cpp
+ \brief  Implementation of Cache derived from CacheBase, using a set split in independently locked shards (implementation)
+ \see    CacheShardedSet.hpp
+ */
+#include "../Cache/CacheShardedSet.hpp"
+#include "../Math/Point.hpp"
+#include "../Output/OutputQueue.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <functional>   // For hash
+#include <iostream>
+
+
+// Initialize CacheShardedSet class.
+// To be called by the Constructor.
+void NOMAD::CacheShardedSet::init()
+{
+    if (_cacheParams->toBeChecked())
+    {
+        throw NOMAD::Exception(__FILE__, __LINE__, "CacheParameters::checkAndComply() needs to be called before constructing a CacheShardedSet.");
+    }
+
+    size_t nbShards = _cacheParams->getAttributeValue<size_t>("CACHE_NB_SHARDS");
+    for (size_t i = 0; i < nbShards; i++)
+    {
+        std::unique_ptr<Shard> shard(new Shard());
+#ifdef _OPENMP
+        omp_init_lock(&shard->_lock);
+#endif // _OPENMP
+        _shards.push_back(std::move(shard));
+    }
+}
+
+
+// Terminate CacheShardedSet class.
+// To be called by the Destructor.
+void NOMAD::CacheShardedSet::destroy()
+{
+    // No need to set locks, assuming there is only one cache and
+    // that now it is the end of the run and we are calling its destructor.
+    for (auto& shard : _shards)
+    {
+        shard->_set.clear();
+#ifdef _OPENMP
+        omp_destroy_lock(&shard->_lock);
+#endif // _OPENMP
+    }
+    _shards.clear();
+    _size = 0;
+}
+
+
+void NOMAD::CacheShardedSet::setInstance(const std::shared_ptr<NOMAD::CacheParameters>& cacheParams,
+                                         const BBOutputTypeList& bbOutputType)
+{
+    // The singleton is created by the master thread, before any
+    // evaluation starts.
+#ifdef _OPENMP
+    #pragma omp critical(CacheShardedSetInstance)
+#endif // _OPENMP
+    {
+        if ( _single == nullptr )
+        {
+            _single = std::unique_ptr<NOMAD::CacheShardedSet>(new CacheShardedSet(cacheParams)) ;
+        }
+        else
+        {
+            std::string err = "Cannot get instance. NOMAD::CacheShardedSet::setInstance must be called only ONCE before calling NOMAD::CacheBase::getInstance()" ;
+            throw NOMAD::Exception(__FILE__, __LINE__, err);
+        }
+    }
+
+    _bbOutputType = bbOutputType;
+
+    // As long as the cache file exists, it is read.
+    getInstance()->read();
+}
+
+
+// Points that are equal following EvalPointCompare (Point::weakLess)
+// have the same hash, so they are in the same shard.
+NOMAD::CacheShardedSet::Shard& NOMAD::CacheShardedSet::getShard(const NOMAD::Point& x) const
+{
+    // Use the high bits: the low bits select the buckets of unordered sets.
+    const uint64_t hashKey = x.hash();
+
+    return *_shards[(hashKey >> 32) % _shards.size()];
+}
+
+
+void NOMAD::CacheShardedSet::lockShard(const Shard& shard __attribute__((unused)))
+{
+#ifdef _OPENMP
+    omp_set_lock(&shard._lock);
+#endif // _OPENMP
+}
+
+
+void NOMAD::CacheShardedSet::unlockShard(const Shard& shard __attribute__((unused)))
+{
+#ifdef _OPENMP
+    omp_unset_lock(&shard._lock);
+#endif // _OPENMP
+}
+
+
+void NOMAD::CacheShardedSet::verifyPoint(const NOMAD::Point& point) const
+{
+    if (!point.isComplete())
+    {
+        std::string err = "Error: Cache does not support incomplete points.";
+        err += " Got point: " + point.display();
+        throw NOMAD::Exception(__FILE__, __LINE__, err);
+    }
+    if (_size > 0 && _n != point.size())
+    {
+        std::string err = "Error: Cache method called with a point of size ";
+        err += std::to_string(point.size());
+        err += ": " + point.display();
+        err += ". Cache needs points of size " + std::to_string(_n);
+        throw NOMAD::Exception(__FILE__, __LINE__, err);
+    }
+}
+
+
+// Add a new eval point to the cache.
+// Return true if insertion worked, false if not (EvalPoint was already there).
+bool NOMAD::CacheShardedSet::insert(const NOMAD::EvalPoint &evalPoint)
+{
+    verifyPoint(*evalPoint.getX());
+    // First insert sets n (even if insert fails)
+    if (0 == _size)
+    {
+        _n = evalPoint.size();
+    }
+
+    Shard& shard = getShard(evalPoint);
+    lockShard(shard);
+    bool inserted = shard._set.insert(evalPoint).second;
+    unlockShard(shard);
+
+    if (inserted)
+    {
+        _size++;
+    }
+    else
+    {
+        _nbCacheHits++;
+    }
+
+    return inserted;
+}
+
+
+// Get EvalPoint evalPoint at Point x from the cache
+// Returns the number of EvalPoints found
+size_t NOMAD::CacheShardedSet::find(const NOMAD::Point& x, NOMAD::EvalPoint &evalPoint) const
+{
+    size_t nbFound = 0;
+    const Shard& shard = getShard(x);
+    lockShard(shard);
+    auto it = shard._set.find(NOMAD::EvalPoint(x));
+    if (it != shard._set.end())
+    {
+        evalPoint = *it;
+        nbFound = 1;
+    }
+    unlockShard(shard);
+
+    return nbFound;
+}
+
+
+// Insert evalPoint in cache.
+// Return a boolean indicating if we should eval this point.
+// See CacheSet::smartInsert().
+bool NOMAD::CacheShardedSet::smartInsert(const NOMAD::EvalPoint &evalPoint,
+                                         const short maxNumberEval,
+                                         const EvalType& evalType)
+{
+    verifyPoint(*evalPoint.getX());
+
+    // First insert sets n (even if insert fails)
+    if (0 == _size)
+    {
+        _n = evalPoint.size();
+    }
+
+    bool doEval = true;
+    bool hasEval = true;
+    std::string s;
+
+    // The point found in cache is only used while the shard is locked.
+    Shard& shard = getShard(evalPoint);
+    lockShard(shard);
+    auto ret = shard._set.insert(evalPoint);
+    bool inserted = ret.second;
+    bool canEval = ret.first->toEval(maxNumberEval, evalType);
+    hasEval = (nullptr != ret.first->getEval(evalType));
+    // The display is only used for the info messages and the warning below.
+    if (!(inserted && canEval) && NOMAD::EvalType::BB == evalType
+        && (canEval || NOMAD::OutputQueue::GoodLevel(NOMAD::OutputLevel::LEVEL_INFO)))
+    {
+        s = ret.first->display();
+    }
+    unlockShard(shard);
+
+    if (inserted)
+    {
+        _size++;
+    }
+
+    if (inserted && canEval)
+    {
+        doEval = true;
+    }
+    else if (!hasEval)
+    {
+        // Point already inserted, but not evaluated.
+        // Only warn outside of sgte context.
+        if (NOMAD::EvalType::BB == evalType)
+        {
+            NOMAD::OutputQueue::Add("Point already inserted in cache, but not evaluated: " + s, NOMAD::OutputLevel::LEVEL_INFO);
+        }
+
+        doEval = true;
+    }
+    else
+    {
+        // Cache hit.
+        doEval = canEval;
+
+        // Only count as cache hit when using Blackbox Eval.
+        if (NOMAD::EvalType::BB == evalType)
+        {
+            _nbCacheHits++;
+            NOMAD::OutputQueue::Add("Cache hit: " + s, NOMAD::OutputLevel::LEVEL_INFO);
+        }
+        if (doEval)
+        {
+            std::cerr << "Warning: CacheShardedSet: smartInsert: New evaluation of point found in cache " << s << std::endl;
+        }
+    }
+
+    return doEval;
+}
+
+
+size_t NOMAD::CacheShardedSet::find(const NOMAD::Point x, std::vector<NOMAD::EvalPoint> &evalPointList) const
+{
+    verifyPoint(x);
+    evalPointList.clear();
+
+    NOMAD::EvalPoint evalPoint;
+    size_t found = find(x, evalPoint);
+    if (found > 0)
+    {
+        evalPointList.push_back(evalPoint);
+    }
+    return found;
+}
+
+
+size_t NOMAD::CacheShardedSet::find(const NOMAD::Eval &refeval,
+                                    bool (*comp)(const NOMAD::Eval&, const NOMAD::Eval&),
+                                    std::vector<NOMAD::EvalPoint> &evalPointList,
+                                    const EvalType& evalType) const
+{
+    evalPointList.clear();
+    for (const auto& shard : _shards)
+    {
+        lockShard(*shard);
+        for (auto it = shard->_set.begin(); it != shard->_set.end(); ++it)
+        {
+            const NOMAD::Eval* eval = it->getEval(evalType);
+            if (nullptr != eval && comp(*eval, refeval))
+            {
+                evalPointList.push_back(*it);
+            }
+        }
+        unlockShard(*shard);
+    }
+
+    return evalPointList.size();
+}
+
+
+// Get best eval points, using comp()
+size_t NOMAD::CacheShardedSet::findBest(bool (*comp)(const NOMAD::Eval&, const NOMAD::Eval&),
+                                        std::vector<NOMAD::EvalPoint> &evalPointList,
+                                        const bool findFeas,
+                                        const NOMAD::Double& hMax,
+                                        const NOMAD::Point& fixedVariable,
+                                        const EvalType& evalType) const
+{
+    evalPointList.clear();
+    // The Eval of the best points found so far. It is shared by the
+    // points of evalPointList, so it stays valid when the shards are
+    // unlocked, and it is not copied.
+    const NOMAD::Eval* refeval = nullptr;
+
+    for (const auto& shard : _shards)
+    {
+        lockShard(*shard);
+        for (auto it = shard->_set.begin(); it != shard->_set.end(); ++it)
+        {
+            const NOMAD::Eval* eval = it->getEval(evalType);
+            if (nullptr == eval || NOMAD::EvalStatusType::EVAL_OK != eval->getEvalStatus())
+            {
+                continue;
+            }
+            if (findFeas != eval->isFeasible())
+            {
+                continue;
+            }
+            if (eval->getH() > hMax)
+            {
+                continue;
+            }
+            // Must be in the sub-space defined by fixedVariable
+            if (!it->hasFixed(fixedVariable))
+            {
+                continue;
+            }
+
+            if (nullptr == refeval)
+            {
+                // Found first point
+                evalPointList.push_back(*it);
+                refeval = evalPointList[0].getEval(evalType);
+            }
+            else if (*eval == *refeval)
+            {
+                // Found another point with eval == refeval
+                evalPointList.push_back(*it);
+            }
+            else if (comp(*eval, *refeval))
+            {
+                // Found a better point
+                // Reset list with new best
+                evalPointList.clear();
+                evalPointList.push_back(*it);
+                refeval = evalPointList[0].getEval(evalType);
+            }
+        }
+        unlockShard(*shard);
+    }
+
+    return evalPointList.size();
+}
+
+
+size_t NOMAD::CacheShardedSet::findBestFeas(std::vector<NOMAD::EvalPoint> &evalPointList,
+                                            const NOMAD::Point& fixedVariable,
+                                            const EvalType& evalType) const
+{
+    findBest(NOMAD::Eval::compEvalFindBest, evalPointList, true, 0, fixedVariable, evalType);
+    return evalPointList.size();
+}
+
+
+bool NOMAD::CacheShardedSet::hasFeas(const EvalType& evalType) const
+{
+    bool ret = false;
+
+    for (auto itShard = _shards.begin(); !ret && itShard != _shards.end(); ++itShard)
+    {
+        const Shard& shard = *(*itShard);
+        lockShard(shard);
+        for (auto it = shard._set.begin(); it != shard._set.end(); ++it)
+        {
+            const NOMAD::Eval* eval = it->getEval(evalType);
+            if (nullptr != eval
+                && NOMAD::EvalStatusType::EVAL_OK == eval->getEvalStatus()
+                && eval->isFeasible())
+            {
+                ret = true;
+                break;
+            }
+        }
+        unlockShard(shard);
+    }
+
+    return ret;
+}
+
+
+size_t NOMAD::CacheShardedSet::findBestInf(std::vector<NOMAD::EvalPoint> &evalPointList,
+                                           const NOMAD::Double& hMax,
+                                           const NOMAD::Point& fixedVariable,
+                                           const EvalType& evalType) const
+{
+    findBest(NOMAD::Eval::compEvalFindBest, evalPointList, false, hMax, fixedVariable, evalType);
+    return evalPointList.size();
+}
+
+
+size_t NOMAD::CacheShardedSet::find(NOMAD::Point X,
+                                    NOMAD::Double distance,
+                                    std::vector<NOMAD::EvalPoint> &evalPointList,
+                                    int maxEvalPoints) const
+{
+    verifyPoint(X);
+    evalPointList.clear();
+
+    bool stopWhenMaxFound = (maxEvalPoints > 0);
+    bool maxFound = false;
+    for (auto itShard = _shards.begin(); !maxFound && itShard != _shards.end(); ++itShard)
+    {
+        const Shard& shard = *(*itShard);
+        lockShard(shard);
+        for (auto it = shard._set.begin(); it != shard._set.end(); ++it)
+        {
+            if (X.size() != it->size())
+            {
+                continue; // Points are in different dimensions -skip.
+            }
+
+            if (NOMAD::Point::dist(X, *it) <= distance)
+            {
+                evalPointList.push_back(*it);
+                if (stopWhenMaxFound && evalPointList.size() >= (size_t)maxEvalPoints)
+                {
+                    maxFound = true;
+                    break;
+                }
+            }
+        }
+        unlockShard(shard);
+    }
+
+    return evalPointList.size();
+}
+
+
+// No spatial index on the shards: go through each shard, and keep the
+// k nearest points of each one. Then keep the k nearest of these.
+size_t NOMAD::CacheShardedSet::findNearest(const NOMAD::Point& X,
+                                           const size_t k,
+                                           std::vector<NOMAD::EvalPoint> &evalPointList) const
+{
+    verifyPoint(X);
+    evalPointList.clear();
+
+    typedef std::pair<NOMAD::Double, NOMAD::EvalPoint> Candidate;
+    NOMAD::EvalPointCompare evalPointCompare;
+    auto candidateLess = [&evalPointCompare](const Candidate& c1, const Candidate& c2)
+    {
+        return (c1.first.todouble() < c2.first.todouble())
+               || (c1.first.todouble() == c2.first.todouble() && evalPointCompare(c1.second, c2.second));
+    };
+
+    std::vector<Candidate> candidates;
+    for (const auto& shard : _shards)
+    {
+        typedef std::pair<NOMAD::Double, const NOMAD::EvalPoint*> ShardCandidate;
+        std::vector<ShardCandidate> shardCandidates;
+        lockShard(*shard);
+        shardCandidates.reserve(shard->_set.size());
+        for (auto it = shard->_set.begin(); it != shard->_set.end(); ++it)
+        {
+            if (X.size() == it->size())
+            {
+                shardCandidates.push_back(ShardCandidate(NOMAD::Point::dist(X, *it), &*it));
+            }
+        }
+        const size_t nbNearest = std::min(k, shardCandidates.size());
+        std::partial_sort(shardCandidates.begin(), shardCandidates.begin() + nbNearest, shardCandidates.end(),
+                          [&evalPointCompare](const ShardCandidate& c1, const ShardCandidate& c2)
+                          {
+                              return (c1.first.todouble() < c2.first.todouble())
+                                     || (c1.first.todouble() == c2.first.todouble() && evalPointCompare(*c1.second, *c2.second));
+                          });
+        for (size_t i = 0; i < nbNearest; i++)
+        {
+            candidates.push_back(Candidate(shardCandidates[i].first, *shardCandidates[i].second));
+        }
+        unlockShard(*shard);
+    }
+
+    const size_t nbNearest = std::min(k, candidates.size());
+    std::partial_sort(candidates.begin(), candidates.begin() + nbNearest, candidates.end(), candidateLess);
+    for (size_t i = 0; i < nbNearest; i++)
+    {
+        evalPointList.push_back(candidates[i].second);
+    }
+
+    return evalPointList.size();
+}
+
+
+size_t NOMAD::CacheShardedSet::find(bool (*crit)(const NOMAD::EvalPoint&),
+                                    std::vector<NOMAD::EvalPoint> &evalPointList) const
+{
+    evalPointList.clear();
+    for (const auto& shard : _shards)
+    {
+        lockShard(*shard);
+        for (auto it = shard->_set.begin(); it != shard->_set.end(); ++it)
+        {
+            if (crit(*it))
+            {
+                evalPointList.push_back(*it);
+            }
+        }
+        unlockShard(*shard);
+    }
+
+    return evalPointList.size();
+}
+
+
+// Update EvalPoint in cache.
+// See CacheSet::update().
+bool NOMAD::CacheShardedSet::update(const NOMAD::EvalPoint& evalPoint, const EvalType& evalType)
+{
+    bool updateOk = false;
+
+    if (nullptr == evalPoint.getEval(evalType))
+    {
+        // Cannot update to a null Eval. Warn the user.
+        std::string err = "Warning: CacheShardedSet: Update: Cannot update to a NULL Eval for Point ";
+        err += evalPoint.displayAll();
+        std::cerr << err << std::endl;
+        return false;
+    }
+
+    Shard& shard = getShard(evalPoint);
+    lockShard(shard);
+    auto it = shard._set.find(evalPoint);
+    if (it != shard._set.end())
+    {
+        // Update EvalPoint in cache directly.
+        // Since we are not changing the Point part, which is the only part
+        // used for sorting and hashing, the cache remains coherent.
+        auto cacheEvalPoint = const_cast<NOMAD::EvalPoint*>(&*it);
+        cacheEvalPoint->shareEval(evalPoint, evalType);
+        cacheEvalPoint->setNumberEval(evalPoint.getNumberEval());
+        updateOk = true;
+    }
+    unlockShard(shard);
+
+    if (updateOk)
+    {
+        appendToJournal(evalPoint, evalType);
+        addToEvaluatedPoints(evalPoint, evalType);
+    }
+    else
+    {
+        std::string err = "Warning: CacheShardedSet: Update: Did not find EvalPoint to update in cache: " + evalPoint.displayAll();
+        NOMAD::OutputQueue::Add(err, NOMAD::OutputLevel::LEVEL_WARNING);
+    }
+
+    return updateOk;
+}
+
+
+// Empty the cache and reset number of cache hits
+bool NOMAD::CacheShardedSet::clear()
+{
+    for (auto& shard : _shards)
+    {
+        lockShard(*shard);
+        _size -= shard->_set.size();
+        shard->_set.clear();
+        unlockShard(*shard);
+    }
+
+    clearEvaluatedPoints();
+
+    // Note: We might not want to reset - in that case, remove this line.
+    resetNbCacheHits();
+
+    return true;
+}
+
+
+// Clear all sgte evaluations from the cache
+void NOMAD::CacheShardedSet::clearSgte()
+{
+    processOnAllPoints(NOMAD::EvalPoint::clearEvalSgte);
+}
+
+
+// Purge the cache for space.
+// Same idea as CacheSet::purge(): keep EvalPoints which have an f under the
+// mean f. If it is not enough, remove half the points of each shard.
+// Points are erased in place, one shard at a time.
+void NOMAD::CacheShardedSet::purge()
+{
+    if ( _maxSize== NOMAD::INF_SIZE_T || _size < _maxSize)
+    {
+        // Do nothing
+        return;
+    }
+    std::cerr << "Warning: Calling Cache purge. Size is " << _size << " max is " << _maxSize << ". Some points will be removed from the cache." << std::endl;
+
+    size_t nbRemovedLast = 1;
+    while (_size >= _maxSize)
+    {
+        NOMAD::Double meanF;
+        size_t nbElemWithF = computeMeanF(meanF);
+        bool useMeanF = (nbElemWithF > 0 && nbRemovedLast > 0);
+        nbRemovedLast = 0;
+
+        for (auto& shard : _shards)
+        {
+            lockShard(*shard);
+            size_t nbToKeep = shard->_set.size() / 2;
+            size_t i = 0;
+            for (auto it = shard->_set.begin(); it != shard->_set.end(); i++)
+            {
+                bool doErase = false;
+                if (useMeanF)
+                {
+                    // Remove all EvalPoints for which f is over or equal to the mean,
+                    // or undefined.
+                    NOMAD::Double f = it->getF(NOMAD::EvalType::BB);
+                    doErase = (!f.isDefined() || f >= meanF);
+                }
+                else
+                {
+                    // Remove arbitrarily half the elements of the shard.
+                    doErase = (i >= nbToKeep);
+                }
+
+                if (doErase)
+                {
+                    it = shard->_set.erase(it);
+                    nbRemovedLast++;
+                }
+                else
+                {
+                    ++it;
+                }
+            }
+            unlockShard(*shard);
+        }
+        _size -= nbRemovedLast;
+    }
+}
+
+
+// Naive way to compute the mean f for all points in the cache.
+size_t NOMAD::CacheShardedSet::computeMeanF(NOMAD::Double &mean) const
+{
+    size_t nbElem = 0;
+    NOMAD::Double total = 0;
+    mean.reset();
+    for (const auto& shard : _shards)
+    {
+        lockShard(*shard);
+        for (auto it = shard->_set.begin(); it != shard->_set.end(); ++it)
+        {
+            NOMAD::Double f = it->getF(NOMAD::EvalType::BB);
+            if (f.isDefined())
+            {
+                total += f;
+                nbElem++;
+            }
+        }
+        unlockShard(*shard);
+    }
+    if (nbElem > 0)
+    {
+        mean = total / nbElem;
+    }
+
+    return nbElem;
+}
+
+
+// Call function func on all points in cache.
+void NOMAD::CacheShardedSet::processOnAllPoints(void (*func)(NOMAD::EvalPoint&))
+{
+    for (auto& shard : _shards)
+    {
+        lockShard(*shard);
+        for (auto it = shard->_set.begin(); it != shard->_set.end(); ++it)
+        {
+            auto evalPoint = const_cast<NOMAD::EvalPoint*>(&*it);
+            func(*evalPoint);
+        }
+        unlockShard(*shard);
+    }
+}
+
+
+// Write cache to file _filename.
+// The format and the journal are handled by CacheBase::writeFile().
+bool NOMAD::CacheShardedSet::write() const
+{
+    std::string s = "Write cache file " + _filename;
+    NOMAD::OutputQueue::Add(s);
+    return writeFile();
+}
+
+
+// Read _filename as written by write(), and add the points to the cache.
+// The format and the journal are handled by CacheBase::readFile().
+bool NOMAD::CacheShardedSet::read()
+{
+    return readFile();
+}
+
+
+// Display only EvalPoints that have a BB eval that is good.
+// This method is used to write points to cache.
+std::ostream& NOMAD::CacheShardedSet::displayPointsWithEval(std::ostream& os) const
+{
+    for (const auto& shard : _shards)
+    {
+        lockShard(*shard);
+        for (auto it = shard->_set.begin(); it != shard->_set.end(); ++it)
+        {
+            const NOMAD::Eval* eval = it->getEval(NOMAD::EvalType::BB);
+            if (nullptr != eval && eval->goodForCacheFile())
+            {
+                os << *it << std::endl;
+            }
+        }
+        unlockShard(*shard);
+    }
+
+    return os;
+}
@@ -0,0 +1,319 @@
+/*---------------------------------------------------------------------------------*/
+/*  NOMAD - Nonlinear Optimization by Mesh Adaptive Direct Search -                */
+/*                                                                                 */
+/*  NOMAD - Version 4.0.0 has been created by                                      */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  The copyright of NOMAD - version 4.0.0 is owned by                             */
+/*                 Sebastien Le Digabel        - Polytechnique Montreal            */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  NOMAD v4 has been funded by Rio Tinto, Hydro-Québec, NSERC (Natural Science    */
+/*  and Engineering Research Council of Canada), INOVEE (Innovation en Energie     */
+/*  Electrique and IVADO (The Institute for Data Valorization)                     */
+/*                                                                                 */
+/*  NOMAD v3 was created and developed by Charles Audet, Sebastien Le Digabel,     */
+/*  Christophe Tribes and Viviane Rochon Montplaisir and was funded by AFOSR       */
+/*  and Exxon Mobil.                                                               */
+/*                                                                                 */
+/*  NOMAD v1 and v2 were created and developed by Mark Abramson, Charles Audet,    */
+/*  Gilles Couture, and John E. Dennis Jr., and were funded by AFOSR and           */
+/*  Exxon Mobil.                                                                   */
+/*                                                                                 */
+/*  Contact information:                                                           */
+/*    Polytechnique Montreal - GERAD                                               */
+/*    C.P. 6079, Succ. Centre-ville, Montreal (Quebec) H3C 3A7 Canada              */
+/*    e-mail: nomad@gerad.ca                                                       */
+/*    phone : 1-514-340-6053 #6928                                                 */
+/*    fax   : 1-514-340-5665                                                       */
+/*                                                                                 */
+/*  This program is free software: you can redistribute it and/or modify it        */
+/*  under the terms of the GNU Lesser General Public License as published by       */
+/*  the Free Software Foundation, either version 3 of the License, or (at your     */
+/*  option) any later version.                                                     */
+/*                                                                                 */
+/*  This program is distributed in the hope that it will be useful, but WITHOUT    */
+/*  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or          */
+/*  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License    */
+/*  for more details.                                                              */
+/*                                                                                 */
+/*  You should have received a copy of the GNU Lesser General Public License       */
+/*  along with this program. If not, see <http://www.gnu.org/licenses/>.           */
+/*                                                                                 */
+/*  You can find information on the NOMAD software at www.gerad.ca/nomad           */
+/*---------------------------------------------------------------------------------*/
+/**
+ * \file   CacheShardedSet.hpp
+ * \brief  Implementation of Cache derived from CacheBase, using a set split in independently locked shards.
+ * \see    CacheShardedSet.cpp
+ */
+
+#ifndef __NOMAD400_CACHESHARDEDSET__
+#define __NOMAD400_CACHESHARDEDSET__
+
+#include "../Cache/CacheBase.hpp"
+#include "../Eval/Eval.hpp"
+#include "../Eval/EvalPoint.hpp"
+#include "../Math/Point.hpp"
+
+#include "../nomad_nsbegin.hpp"
+
+
+/// Class implementating the abstract class \b CacheBase, using shards.
+/**
+ * The EvalPoints are distributed in CACHE_NB_SHARDS sets of EvalPoints
+   (CacheEvalPointSet), following a hash of their coordinates. Each set has
+   its own lock.
+ * Finding or inserting a point only locks the shard that holds the point,
+   so threads working on different shards never wait for each other. This
+   is the main difference with CacheSet, where a single lock is used.
+ * Methods that go through all the cache (findBest, find with a criterion,
+   purge, etc.) lock the shards one at a time.
+ * The hash is consistent with the comparison used by the sets (EvalPointCompare):
+   two points that are equal for the sets are always in the same shard.
+ */
+class CacheShardedSet : public CacheBase {
+
+private:
+
+    /// A part of the cache, with its own lock.
+    struct Shard
+    {
+        CacheEvalPointSet _set;     ///< The points of this shard
+#ifdef _OPENMP
+        mutable omp_lock_t _lock;   ///< Lock for multithreading
+#endif // _OPENMP
+    };
+
+    std::vector<std::unique_ptr<Shard>> _shards; ///< The shards that constitute the cache
+
+    std::atomic<size_t> _size;      ///< Total number of points in the cache
+
+    /// Constructor
+    /**
+     \param cacheParams     The parameters for cache -- \b IN.
+     */
+    explicit CacheShardedSet(const std::shared_ptr<CacheParameters>& cacheParams)
+      : CacheBase(cacheParams),
+        _shards(),
+        _size(0)
+    {
+        init();
+    }
+
+
+public:
+    /*---------------*/
+    /* Class Methods */
+    /*---------------*/
+
+    /// Destructor
+    virtual ~CacheShardedSet()
+    {
+        destroy();
+    }
+
+    /// Set the singleton (done once)
+    /**
+     \param cacheParams     The cache parameters -- \b IN.
+     \param bbOutputType    List of the blackbox output type -- \b IN.
+     */
+    static void setInstance(const std::shared_ptr<CacheParameters>& cacheParams,
+                            const BBOutputTypeList& bbOutputType);
+
+    /// Get the number of shards
+    size_t getNbShards() const { return _shards.size(); }
+
+    /// Add a new EvalPoint to the cache
+    /**
+     \param evalPoint   The eval point to insert in the cache     -- \b IN.
+     \return            \c true if the insertion succeeded and \c false if the EvalPoint was already in the cache.
+     */
+    bool insert(const EvalPoint &evalPoint) override;
+
+    /// Get eval point at point x from the cache (there can be only one).
+    /**
+     \param x           The point to find               -- \b IN.
+     \param evalPoint   The copy of the data in cache   -- \b OUT.
+     \return            An integer: 1 if found, 0 otherwise
+     */
+    size_t find(const Point & x,
+                EvalPoint &evalPoint) const override;
+
+    /// Insert evalPoint in cache.
+    /**
+     * Same behavior as CacheSet::smartInsert().
+     
+     \param evalPoint       The point to insert                         -- \b IN.
+     \param maxNumberEval   The max number of evaluations of the point  -- \b IN.
+     \param evalType        Which eval (Blackbox or Surrogate) of the EvalPoint to look at  -- \b IN.
+     \return                A boolean indicating if we should eval this point.
+     */
+    bool smartInsert(const EvalPoint &evalPoint,
+                     const short maxNumberEval,
+                     const EvalType& evalType) override;
+
+    /// Get eval point at point x from the cache and return it in a list.
+    /**
+     \param x                The point to find                              -- \b IN.
+     \param evalPointList    The eval point corresponding to x in a list    -- \b OUT.
+     \return                 1 if found, 0 otherwise
+     */
+    size_t find(const Point x,
+                std::vector<EvalPoint> &evalPointList) const override;
+
+    /// Get all eval points for which comp(refeval) returns true.
+    /**
+     \param refeval         The point to find                                              -- \b IN.
+     \param comp            The comparison function                                        -- \b IN.
+     \param evalPointList   The eval points that verify comp()==true returned in a list    -- \b OUT.
+     \param evalType        Which eval (Blackbox or Surrogate) of the EvalPoint to look at  -- \b IN.
+     \return                The number of eval points found.
+     */
+    size_t find(const Eval &refeval,
+             bool (*comp)(const Eval&, const Eval&),
+             std::vector<EvalPoint> &evalPointList,
+             const EvalType& evalType = EvalType::BB) const override;
+
+    /// Get best eval points, using comp().
+    /**
+     * Only the points with eval status EVAL_OK are considered.
+     \param comp             The comparison function                                    -- \b IN.
+     \param evalPointList    The best eval points that verify comp()==true in a list    -- \b OUT.
+     \param findFeas         Flag to find feasible points                               -- \b IN.
+     \param hMax             Maximum acceptable value for h, when findFeas is false     -- \b IN.
+     \param fixedVariable    Searching for a subproblem defined by this point -- \b IN.
+     \param evalType         Which Eval (Blackbox or Surrogate) of the EvalPoint to look at  -- \b IN.
+     \return                 The number of eval points found.
+     */
+    size_t findBest(bool (*comp)(const Eval&, const Eval&),
+                    std::vector<EvalPoint> &evalPointList,
+                    const bool findFeas,
+                    const Double& hMax,
+                    const Point& fixedVariable,
+                    const EvalType& evalType) const override;
+
+    /// Find best feasible points, using operator<.
+    size_t findBestFeas(std::vector<EvalPoint> &evalPointList,
+                        const Point& fixedVariable,
+                        const EvalType& evalType) const override;
+
+    /// Test if cache contains a feasible point.
+    bool hasFeas(const EvalType& evalType) const override;
+
+    /// Find best infeasible points, with h <= hMax, using operator<.
+    size_t findBestInf(std::vector<EvalPoint> &evalPointList,
+                       const Double& hMax,
+                       const Point& fixedVariable,
+                       const EvalType& evalType) const override;
+
+    /// Get all eval points within a distance of point X.
+    /**
+     \param X                The point of reference                              -- \b IN.
+     \param distance         The distance to the point of reference              -- \b IN.
+     \param evalPointList    The eval points within the prescribed distance of X -- \b OUT.
+     \param maxEvalPoints    The maximum number of points to select              -- \b IN.
+     \return                 The number of eval points found.
+     */
+    size_t find(Point X,
+                Double distance,
+                std::vector<EvalPoint> &evalPointList,
+                int maxEvalPoints = 0) const override;
+
+    /// Get the k eval points nearest to point X.
+    /**
+     \param X                The point of reference                  -- \b IN.
+     \param k                The number of points to select          -- \b IN.
+     \param evalPointList    The nearest eval points, nearest first  -- \b OUT.
+     \return                 The number of eval points found.
+     */
+    size_t findNearest(const Point& X,
+                       const size_t k,
+                       std::vector<EvalPoint> &evalPointList) const override;
+
+    /// Find using criteria.
+    /**
+     All the points for which crit() return true are put in evalPointList.
+
+     \param crit             The criteria function                               -- \b IN.
+     \param evalPointList    The eval points that verify crit()                  -- \b OUT.
+     \return                 The number of eval points found.
+     */
+    size_t find(bool (*crit)(const EvalPoint&),
+                std::vector<EvalPoint> &evalPointList) const override;
+
+    /// Update EvalPoint in cache.
+    /**
+     * Look for Point and update the Eval part. Only the shard holding the point is locked.
+     
+     \param evalPoint       The eval point to update  -- \b IN.
+     \param evalType        Which eval (Blackbox or Surrogate) of the EvalPoint to look at  -- \b IN.
+     \return                A boolean indicating if update succeeded (\c true), \c false if there was an error.
+     */
+    bool update(const EvalPoint& evalPoint, const EvalType& evalType) override;
+
+    /// Return number of eval points in the cache.
+    size_t size() const override { return _size; }
+
+    /// Empty the cache.
+    bool clear() override;
+
+    /// Clear all sgte evaluations from the cache
+    void clearSgte() override;
+
+    /// Purge the cache to get under MAX_CACHE_SIZE.
+    /**
+     Same strategy as CacheSet::purge(), except that points are removed in place, shard by shard.
+     */
+    void purge() override;
+
+    /// Write cache to file _filename.
+    bool write() const override;
+
+    /// Read file given by _filename.
+    bool read() override;
+
+    /// Display only EvalPoints that have an eval.
+    std::ostream& displayPointsWithEval(std::ostream& os) const override;
+
+    /// Compute the mean f.
+    /**
+     \param mean       The mean f -- \b OUT.
+     \return           The number of EvalPoints for which f is defined.
+     */
+    size_t computeMeanF(Double &mean) const override;
+
+    /// Call function func() on all EvalPoint in cache.
+    void processOnAllPoints(void (*func)(EvalPoint&)) override;
+
+private:
+    /// Private initialization function for internal use by constructor.
+    void init();
+
+    /// Private function for internal use by destructor.
+    void destroy();
+
+    /// Get the shard which holds, or would hold, point x.
+    Shard& getShard(const Point& x) const;
+
+    /// Lock a shard.
+    static void lockShard(const Shard& shard);
+
+    /// Unlock a shard.
+    static void unlockShard(const Shard& shard);
+
+    /// Helper function for find and insertion.
+    /**
+     Throw exception if error. Do nothing otherwise.
+
+     \param point       The point to verify  -- \b IN.
+     */
+    void verifyPoint(const Point& point) const;
+};
+
+
+#include "../nomad_nsend.hpp"
+
+#endif // __NOMAD400_CACHESHARDEDSET__
@@ -64,8 +64,36 @@ const std::string NOMAD::BBOutput::bboEnd = ")";
 // Reading BBOutput from string
 NOMAD::BBOutput::BBOutput(const std::string &rawBBO, const bool evalOk)
   : _rawBBO(rawBBO),
-    _evalOk(evalOk)
+    _evalOk(evalOk),
+    _bbo(),
+    _bboBool()
 {
+    parseBBO();
+}
+
+
+NOMAD::BBOutput::BBOutput(const NOMAD::ArrayOfDouble &bbo, const bool evalOk)
+  : _rawBBO(bbo.display()),
+    _evalOk(evalOk),
+    _bbo(bbo),
+    _bboBool(bbo.size(), -1)
+{
+    // Same values as parseBBO() would find in the raw output.
+    for (size_t i = 0; i < bbo.size(); i++)
+    {
+        if (!bbo[i].isDefined())
+        {
+            continue;
+        }
+        if (1.0 == bbo[i])
+        {
+            _bboBool[i] = 1;
+        }
+        else if (0.0 == bbo[i])
+        {
+            _bboBool[i] = 0;
+        }
+    }
 }
 
 
@@ -73,19 +101,56 @@ void NOMAD::BBOutput::setBBO(const std::string &bbOutputString, const bool evalO
 {
     _rawBBO = bbOutputString;
     _evalOk = evalOk;
+    parseBBO();
+}
+
+
+// Parse the raw output once. The getters use the parsed values, so that
+// recomputing f and h does not tokenize the raw output again.
+void NOMAD::BBOutput::parseBBO()
+{
+    NOMAD::ArrayOfString array(_rawBBO);
+    const size_t n = array.size();
+
+    _bbo.reset(n);
+    _bboBool.assign(n, -1);
+
+    for (size_t i = 0; i < n; i++)
+    {
+        // Double remains undefined if the field is not a number.
+        NOMAD::Double d;
+        d.atof(array[i]);
+        _bbo[i] = d;
+
+        // Same conversion as NOMAD::stringToBool, without exception.
+        std::string s = array[i];
+        NOMAD::toupper(s);
+        if ( s == "Y" || s == "YES" || s == "1" || s == "TRUE" )
+        {
+            _bboBool[i] = 1;
+        }
+        else if ( s == "N" || s == "NO" || s == "0" || s == "FALSE" )
+        {
+            _bboBool[i] = 0;
+        }
+    }
 }
 
 
 bool NOMAD::BBOutput::getCountEval(const BBOutputTypeList &bbOutputType) const
 {
     bool countEval = true;
-    NOMAD::ArrayOfString array(_rawBBO);
 
-    for (size_t i = 0; i < array.size(); i++)
+    for (size_t i = 0; i < _bbo.size(); i++)
     {
         if (NOMAD::BBOutputType::CNT_EVAL == bbOutputType[i])
         {
-            countEval = NOMAD::stringToBool(array[i]);
+            if (-1 == _bboBool[i])
+            {
+                // Not a bool: let NOMAD::stringToBool throw its exception.
+                NOMAD::stringToBool(NOMAD::ArrayOfString(_rawBBO)[i]);
+            }
+            countEval = (1 == _bboBool[i]);
         }
     }
 
@@ -95,16 +160,15 @@ bool NOMAD::BBOutput::getCountEval(const BBOutputTypeList &bbOutputType) const
 
 NOMAD::Double NOMAD::BBOutput::getObjective(const NOMAD::BBOutputTypeList &bbOutputType) const
 {
-    NOMAD::ArrayOfString array(_rawBBO);
     NOMAD::Double obj;
 
-    checkSizeMatch(bbOutputType, array);
+    checkSizeMatch(bbOutputType);
 
-    for (size_t i = 0; i < array.size(); i++)
+    for (size_t i = 0; i < _bbo.size(); i++)
     {
         if (NOMAD::BBOutputType::OBJ == bbOutputType[i])
         {
-            obj.atof(array[i]);
+            obj = _bbo[i];
             break;
         }
     }
@@ -113,49 +177,38 @@ NOMAD::Double NOMAD::BBOutput::getObjective(const NOMAD::BBOutputTypeList &bbOut
 
 NOMAD::ArrayOfDouble NOMAD::BBOutput::getConstraints(const NOMAD::BBOutputTypeList &bbOutputType) const
 {
-    NOMAD::ArrayOfString array(_rawBBO);
-    NOMAD::ArrayOfDouble constraints;
-    
-    checkSizeMatch(bbOutputType, array);
-    
-    for (size_t i = 0; i < array.size(); i++)
+    checkSizeMatch(bbOutputType);
+
+    size_t nbConstraints = 0;
+    for (size_t i = 0; i < _bbo.size(); i++)
     {
         if ( NOMAD::BBOutputTypeIsConstraint(bbOutputType[i]) )
         {
-            NOMAD::Double d;
-            d.atof(array[i]);
-            size_t constrSize = constraints.size();
-            constraints.resize(constrSize + 1);
-            constraints[constrSize] = d;
+            nbConstraints++;
         }
     }
-    
-    return constraints;
-}
-
 
-NOMAD::ArrayOfDouble NOMAD::BBOutput::getBBOAsArrayOfDouble() const
-{
-    NOMAD::ArrayOfString array(_rawBBO);
-    NOMAD::ArrayOfDouble bbo ( array.size() );
-    
-    for (size_t i = 0; i < array.size(); i++)
+    NOMAD::ArrayOfDouble constraints(nbConstraints);
+    size_t constrIndex = 0;
+    for (size_t i = 0; i < _bbo.size(); i++)
     {
-        NOMAD::Double d;
-        d.atof(array[i]);
-        bbo[i] = d;
+        if ( NOMAD::BBOutputTypeIsConstraint(bbOutputType[i]) )
+        {
+            constraints[constrIndex] = _bbo[i];
+            constrIndex++;
+        }
     }
-    return bbo;
+    
+    return constraints;
 }
 
 
 // Helper function.
 // Verify that the given output type list has the same size as the raw output.
 // Throw an exception if this is not the case.
-void NOMAD::BBOutput::checkSizeMatch(const NOMAD::BBOutputTypeList &bbOutputType,
-                                     const NOMAD::ArrayOfString &array) const
+void NOMAD::BBOutput::checkSizeMatch(const NOMAD::BBOutputTypeList &bbOutputType) const
 {
-    if (bbOutputType.size() != array.size())
+    if (bbOutputType.size() != _bbo.size())
     {
         std::string err = "Error: Parameter BB_OUTPUT_TYPE has " + NOMAD::itos(bbOutputType.size());
         err += " type";
@@ -163,9 +216,9 @@ void NOMAD::BBOutput::checkSizeMatch(const NOMAD::BBOutputTypeList &bbOutputType
         {
             err += "s";
         }
-        err += ", but raw output has " + NOMAD::itos(array.size());
+        err += ", but raw output has " + NOMAD::itos(_bbo.size());
         err += " field";
-        if (array.size() > 1)
+        if (_bbo.size() > 1)
         {
             err += "s";
         }
@@ -72,6 +72,9 @@
  *  - Raw output (string)
  *  - Is eval ok. This is a boolean indicating that there were no problem during evaluation.
  *  - Scaling (future work)
+ *
+ * The raw output is parsed once, when it is set. The getters use the parsed
+ * values. The raw output is kept for display and for the cache file.
  */
 class BBOutput {
 public:
@@ -82,6 +85,8 @@ public:
 private:
     std::string             _rawBBO;    ///< Actual output string
     bool                    _evalOk;    ///< Flag for evaluation
+    ArrayOfDouble           _bbo;       ///< Each field of _rawBBO, as a Double. Undefined if not a number.
+    std::vector<int>        _bboBool;   ///< Each field of _rawBBO, as a bool: 1 if true, 0 if false, -1 if not a bool.
 
 public:
 
@@ -97,6 +102,15 @@ public:
      */
     explicit BBOutput(const std::string &rawBBO, const bool evalOk = true);
 
+    /// Constructor from numeric outputs
+    /**
+     Used by evaluators that compute the outputs as numbers, like the models.
+     The outputs are not parsed back from the raw string.
+     \param bbo     The outputs of the blackbox as numbers -- \b IN.
+     \param evalOk  The eval ok flag -- \b IN.
+     */
+    explicit BBOutput(const ArrayOfDouble &bbo, const bool evalOk = true);
+
     /*---------*/
     /* Get/Set */
     /*---------*/
@@ -145,22 +159,22 @@ public:
     /**
      \return    An array of double of the blackbox outputs.
      */
-    ArrayOfDouble getBBOAsArrayOfDouble() const;
+    const ArrayOfDouble& getBBOAsArrayOfDouble() const { return _bbo; }
 
     /// Display
     void display (std::ostream & out) const;
 
 private:
+    /// Parse _rawBBO into _bbo and _bboBool.
+    void parseBBO();
+
     /// Helper functions that can trigger exception.
     /**
      Exception is triggered if the BBOutputList and
-     the ArrayOfString have inconsistent size.
+     the raw output have inconsistent size.
      \param bbOutputType    The list of blackbox output type -- \b IN.
-     \param array           The array of string -- \b IN.
-     
      */
-    void checkSizeMatch(const BBOutputTypeList &bbOutputType,
-                        const ArrayOfString &array) const;
+    void checkSizeMatch(const BBOutputTypeList &bbOutputType) const;
 
 };
 
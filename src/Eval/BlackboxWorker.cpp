@@ -0,0 +1,321 @@
+/*---------------------------------------------------------------------------------*/
+/*  NOMAD - Nonlinear Optimization by Mesh Adaptive Direct Search -                */
+/*                                                                                 */
+/*  NOMAD - Version 4.0.0 has been created by                                      */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  The copyright of NOMAD - version 4.0.0 is owned by                             */
+/*                 Sebastien Le Digabel        - Polytechnique Montreal            */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  NOMAD v4 has been funded by Rio Tinto, Hydro-Québec, NSERC (Natural Science    */
+/*  and Engineering Research Council of Canada), INOVEE (Innovation en Energie     */
+/*  Electrique and IVADO (The Institute for Data Valorization)                     */
+/*                                                                                 */
+/*  NOMAD v3 was created and developed by Charles Audet, Sebastien Le Digabel,     */
+/*  Christophe Tribes and Viviane Rochon Montplaisir and was funded by AFOSR       */
+/*  and Exxon Mobil.                                                               */
+/*                                                                                 */
+/*  NOMAD v1 and v2 were created and developed by Mark Abramson, Charles Audet,    */
+/*  Gilles Couture, and John E. Dennis Jr., and were funded by AFOSR and           */
+/*  Exxon Mobil.                                                                   */
+/*                                                                                 */
+/*  Contact information:                                                           */
+/*    Polytechnique Montreal - GERAD                                               */
+/*    C.P. 6079, Succ. Centre-ville, Montreal (Quebec) H3C 3A7 Canada              */
+/*    e-mail: nomad@gerad.ca                                                       */
+/*    phone : 1-514-340-6053 #6928                                                 */
+/*    fax   : 1-514-340-5665                                                       */
+/*                                                                                 */
+/*  This program is free software: you can redistribute it and/or modify it        */
+/*  under the terms of the GNU Lesser General Public License as published by       */
+/*  the Free Software Foundation, either version 3 of the License, or (at your     */
+/*  option) any later version.                                                     */
+/*                                                                                 */
+/*  This program is distributed in the hope that it will be useful, but WITHOUT    */
+/*  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or          */
+/*  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License    */
+/*  for more details.                                                              */
+/*                                                                                 */
+/*  You should have received a copy of the GNU Lesser General Public License       */
+/*  along with this program. If not, see <http://www.gnu.org/licenses/>.           */
+/*                                                                                 */
+/*  You can find information on the NOMAD software at www.gerad.ca/nomad           */
+/*---------------------------------------------------------------------------------*/
+/**
+ \file   BlackboxWorker.cpp
+ \brief  Persistent blackbox process (implementation)
+ \see    BlackboxWorker.hpp
+ */
+#include "../Eval/BlackboxWorker.hpp"
+#include "../Output/OutputQueue.hpp"
+#include "../Util/defines.hpp"
+
+#ifndef WINDOWS
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/socket.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#ifndef MSG_NOSIGNAL
+#define MSG_NOSIGNAL 0  // SO_NOSIGPIPE is used instead
+#endif
+#endif
+
+
+NOMAD::BlackboxWorker::~BlackboxWorker()
+{
+    stop();
+}
+
+
+bool NOMAD::BlackboxWorker::evalBlock(const std::vector<std::string>& inputLines,
+                                      std::vector<std::string>& outputLines)
+{
+    outputLines.clear();
+
+    if (!isRunning() && !start())
+    {
+        return false;
+    }
+
+    // Frame: number of points, then one line per point.
+    std::string frame = std::to_string(inputLines.size()) + "\n";
+    for (const auto& line : inputLines)
+    {
+        frame += line + "\n";
+    }
+
+    if (!writeAll(frame))
+    {
+        stop();
+        return false;
+    }
+
+    std::string line;
+    while (outputLines.size() < inputLines.size())
+    {
+        if (!readLine(line))
+        {
+            // The process died, or closed its output.
+            stop();
+            return false;
+        }
+        outputLines.push_back(line);
+    }
+
+    return true;
+}
+
+
+#ifdef WINDOWS
+
+bool NOMAD::BlackboxWorker::start()
+{
+    NOMAD::OutputQueue::Add("Error: persistent blackbox is not available on this platform.",
+                            NOMAD::OutputLevel::LEVEL_ERROR);
+    return false;
+}
+
+
+bool NOMAD::BlackboxWorker::isRunning()
+{
+    return false;
+}
+
+
+void NOMAD::BlackboxWorker::stop()
+{
+}
+
+
+bool NOMAD::BlackboxWorker::writeAll(const std::string& data)
+{
+    return false;
+}
+
+
+bool NOMAD::BlackboxWorker::readLine(std::string& line)
+{
+    return false;
+}
+
+#else
+
+bool NOMAD::BlackboxWorker::start()
+{
+    int fds[2];
+#ifdef SOCK_CLOEXEC
+    // Other workers must not inherit this socket: they would keep it open,
+    // and this process would never see the end of its input.
+    int ret = socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0, fds);
+#else
+    int ret = socketpair(AF_UNIX, SOCK_STREAM, 0, fds);
+    if (0 == ret)
+    {
+        fcntl(fds[0], F_SETFD, FD_CLOEXEC);
+        fcntl(fds[1], F_SETFD, FD_CLOEXEC);
+    }
+#endif
+    if (0 != ret)
+    {
+        NOMAD::OutputQueue::Add("Warning: Could not create socket for persistent blackbox " + _command,
+                                NOMAD::OutputLevel::LEVEL_WARNING);
+        return false;
+    }
+#ifdef SO_NOSIGPIPE
+    int noSigPipe = 1;
+    setsockopt(fds[0], SOL_SOCKET, SO_NOSIGPIPE, &noSigPipe, sizeof(noSigPipe));
+#endif
+
+    // Like popen(), run the command with the shell. Use exec so that the
+    // blackbox replaces the shell.
+    const std::string shellCommand = "exec " + _command;
+
+    pid_t pid = fork();
+    if (pid < 0)
+    {
+        close(fds[0]);
+        close(fds[1]);
+        NOMAD::OutputQueue::Add("Warning: Could not start persistent blackbox " + _command,
+                                NOMAD::OutputLevel::LEVEL_WARNING);
+        return false;
+    }
+
+    if (0 == pid)
+    {
+        // Child: the socket is the standard input and output.
+        // dup2() clears FD_CLOEXEC on the new descriptors.
+        dup2(fds[1], STDIN_FILENO);
+        dup2(fds[1], STDOUT_FILENO);
+        execl("/bin/sh", "sh", "-c", shellCommand.c_str(), (char*)nullptr);
+        _exit(127);
+    }
+
+    close(fds[1]);
+    _fd = fds[0];
+    _pid = pid;
+    _buffer.clear();
+    _nbStarts++;
+
+    std::string s = "Persistent blackbox started (pid " + std::to_string(_pid) + "): " + _command;
+    NOMAD::OutputQueue::Add(s, NOMAD::OutputLevel::LEVEL_DEBUG);
+
+    return true;
+}
+
+
+bool NOMAD::BlackboxWorker::isRunning()
+{
+    if (_pid < 0)
+    {
+        return false;
+    }
+
+    int status = 0;
+    if (0 == waitpid(_pid, &status, WNOHANG))
+    {
+        return true;
+    }
+
+    // The process exited.
+    std::string s = "Warning: Persistent blackbox (pid " + std::to_string(_pid) + ") exited. It will be started again.";
+    NOMAD::OutputQueue::Add(s, NOMAD::OutputLevel::LEVEL_WARNING);
+    _pid = -1;
+    stop();
+
+    return false;
+}
+
+
+void NOMAD::BlackboxWorker::stop()
+{
+    if (_fd >= 0)
+    {
+        // End of input: the blackbox is expected to exit.
+        close(_fd);
+        _fd = -1;
+    }
+    _buffer.clear();
+
+    if (_pid > 0)
+    {
+        // Give the process one second to exit, then kill it.
+        int status = 0;
+        pid_t ret = 0;
+        for (int i = 0; i < 100 && 0 == ret; i++)
+        {
+            ret = waitpid(_pid, &status, WNOHANG);
+            if (0 == ret)
+            {
+                usleep(10000);
+            }
+        }
+        if (0 == ret)
+        {
+            kill(_pid, SIGKILL);
+            waitpid(_pid, &status, 0);
+        }
+        _pid = -1;
+    }
+}
+
+
+bool NOMAD::BlackboxWorker::writeAll(const std::string& data)
+{
+    size_t nbWritten = 0;
+    while (nbWritten < data.size())
+    {
+        // MSG_NOSIGNAL: get EPIPE instead of SIGPIPE if the process died.
+        ssize_t n = ::send(_fd, data.data() + nbWritten, data.size() - nbWritten, MSG_NOSIGNAL);
+        if (n < 0)
+        {
+            if (EINTR == errno)
+            {
+                continue;
+            }
+            return false;
+        }
+        nbWritten += static_cast<size_t>(n);
+    }
+
+    return true;
+}
+
+
+bool NOMAD::BlackboxWorker::readLine(std::string& line)
+{
+    size_t pos = _buffer.find('\n');
+    while (std::string::npos == pos)
+    {
+        char chunk[4096];
+        ssize_t n = ::read(_fd, chunk, sizeof(chunk));
+        if (n < 0 && EINTR == errno)
+        {
+            continue;
+        }
+        if (n <= 0)
+        {
+            return false;
+        }
+        const size_t searchFrom = _buffer.size();
+        _buffer.append(chunk, static_cast<size_t>(n));
+        pos = _buffer.find('\n', searchFrom);
+    }
+
+    line = _buffer.substr(0, pos);
+    _buffer.erase(0, pos + 1);
+    if (!line.empty() && '\r' == line.back())
+    {
+        line.pop_back();
+    }
+
+    return true;
+}
+
+#endif // WINDOWS
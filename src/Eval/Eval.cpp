@@ -140,7 +140,7 @@ NOMAD::Double NOMAD::Eval::computeF(const NOMAD::BBOutputTypeList &bbOutputTypeL
 NOMAD::Double NOMAD::Eval::defaultComputeH(const NOMAD::Eval& eval, const NOMAD::BBOutputTypeList &bbOutputTypeList)
 {
     NOMAD::Double h = 0.0;
-    const NOMAD::ArrayOfDouble bbo = eval.getBBOutput().getBBOAsArrayOfDouble();
+    const NOMAD::ArrayOfDouble& bbo = eval.getBBOutput().getBBOAsArrayOfDouble();
     bool hPos = false;
 
     if (eval.getBBOutput().getEvalOk())
@@ -349,6 +349,13 @@ void NOMAD::Eval::setBBOutputAndRecompute(const NOMAD::BBOutput& bbOutput,
                                           const NOMAD::BBOutputTypeList& bbOutputType)
 {
     setBBOutput(bbOutput);
+    recomputeFH(bbOutputType);
+}
+
+
+void NOMAD::Eval::recomputeFH(const NOMAD::BBOutputTypeList& bbOutputType)
+{
+    // The blackbox output is already parsed: no string is processed here.
     setF(computeF(bbOutputType));
     setH(_computeH(*this, bbOutputType));
     toRecompute(false);
@@ -460,6 +467,17 @@ bool NOMAD::Eval::compEvalFindBest(const NOMAD::Eval &eval1, const NOMAD::Eval &
 }
 
 
+bool NOMAD::Eval::isDefaultComputeSuccessType()
+{
+    typedef NOMAD::SuccessType (*ComputeSuccessTypeFunction)(const NOMAD::Eval*,
+                                                              const NOMAD::Eval*,
+                                                              const NOMAD::Double&);
+    auto func = _computeSuccessType.target<ComputeSuccessTypeFunction>();
+
+    return (nullptr != func && *func == NOMAD::Eval::defaultComputeSuccessType);
+}
+
+
 NOMAD::SuccessType NOMAD::Eval::defaultComputeSuccessType(const Eval* eval1,
                                                           const Eval* eval2,
                                                           const Double& hMax)
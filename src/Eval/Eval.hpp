@@ -174,13 +174,16 @@ public:
     EvalStatusType getEvalStatus() const { return _evalStatus; }
     void setEvalStatus(const EvalStatusType &evalStatus) { _evalStatus = evalStatus; }
 
-    BBOutput getBBOutput() const { return _bbOutput; }
+    const BBOutput& getBBOutput() const { return _bbOutput; }
     void setBBOutput(const BBOutput &bbOutput);
     
     /// Set blackbox output and recompute objective and infeasibility
     void setBBOutputAndRecompute(const BBOutput &bbOutput,
                                  const BBOutputTypeList &bbOutputType);
 
+    /// Recompute objective and infeasibility from the current blackbox output
+    void recomputeFH(const BBOutputTypeList &bbOutputType);
+
     std::string getBBO() const { return _bbOutput.getBBO(); }
     
     /// Set blackbox output and recompute objective and infeasibility
@@ -339,6 +342,12 @@ public:
     {
         _computeSuccessType = comp;
     }
+
+    /// Test if the default function is used to compute success type
+    /**
+     \return \c true if Eval::_computeSuccessType is Eval::defaultComputeSuccessType, \c false otherwise.
+     */
+    static bool isDefaultComputeSuccessType();
     
     /// Set which function to use for infeasibility (h) computation.
     /**
@@ -376,6 +385,9 @@ public:
 /// Definition for evaluation unique pointer
 typedef std::unique_ptr<Eval> EvalUPtr;
 
+/// Definition for evaluation shared pointer
+typedef std::shared_ptr<Eval> EvalSPtr;
+
 /**
  * \brief Output raw eval status
  *
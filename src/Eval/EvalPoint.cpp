@@ -116,18 +116,9 @@ void NOMAD::EvalPoint::copyMembers(const NOMAD::EvalPoint &evalPoint)
 {
     _numberEval = evalPoint._numberEval;
 
-    _eval = nullptr;
-    _evalSgte = nullptr;
-    if (nullptr != evalPoint._eval)
-    {
-        // deep copy.
-        _eval = NOMAD::EvalUPtr(new NOMAD::Eval(*evalPoint.getEval(NOMAD::EvalType::BB)));
-    }
-    if (nullptr != evalPoint._evalSgte)
-    {
-        // deep copy.
-        _evalSgte = NOMAD::EvalUPtr(new NOMAD::Eval(*evalPoint.getEval(NOMAD::EvalType::SGTE)));
-    }
+    // shallow copy: the Evals are copied on write, see getEvalToModify().
+    _eval = evalPoint._eval;
+    _evalSgte = evalPoint._evalSgte;
 
     // shallow copy
     _pointFrom = evalPoint.getPointFrom();
@@ -153,25 +144,9 @@ NOMAD::EvalPoint & NOMAD::EvalPoint::operator=(const NOMAD::EvalPoint &evalPoint
     // Do NOT delete _eval. Since it is a smart ptr, it will take care
     // of itself. Releasing the smart ptr here causes a memory leak.
 
-    if (nullptr == evalPoint._eval)
-    {
-        _eval = nullptr;
-    }
-    else
-    {
-        // deep copy.
-        _eval = NOMAD::EvalUPtr(new NOMAD::Eval(*evalPoint._eval));
-    }
-
-    if (nullptr == evalPoint._evalSgte)
-    {
-        _evalSgte = nullptr;
-    }
-    else
-    {
-        // deep copy.
-        _evalSgte = NOMAD::EvalUPtr(new NOMAD::Eval(*evalPoint._evalSgte));
-    }
+    // shallow copy: the Evals are copied on write, see getEvalToModify().
+    _eval = evalPoint._eval;
+    _evalSgte = evalPoint._evalSgte;
 
     return *this;
 }
@@ -385,9 +360,9 @@ bool NOMAD::EvalPoint::isEvalOk(const NOMAD::EvalType& evalType) const
 /*---------*/
 /* Get/Set */
 /*---------*/
-NOMAD::Eval* NOMAD::EvalPoint::getEval(const NOMAD::EvalType& evalType) const
+const NOMAD::Eval* NOMAD::EvalPoint::getEval(const NOMAD::EvalType& evalType) const
 {
-    NOMAD::Eval* eval = nullptr;
+    const NOMAD::Eval* eval = nullptr;
 
     switch (evalType)
     {
@@ -406,6 +381,57 @@ NOMAD::Eval* NOMAD::EvalPoint::getEval(const NOMAD::EvalType& evalType) const
 }
 
 
+NOMAD::Eval* NOMAD::EvalPoint::getEvalToModify(const NOMAD::EvalType& evalType)
+{
+    NOMAD::EvalSPtr* evalPtr = nullptr;
+
+    switch (evalType)
+    {
+        case NOMAD::EvalType::SGTE:
+            evalPtr = &_evalSgte;
+            break;
+        case NOMAD::EvalType::BB:
+            evalPtr = &_eval;
+            break;
+        case NOMAD::EvalType::UNDEFINED:
+        default:
+            return nullptr;
+    }
+
+    // Copy on write: the other copies of this EvalPoint keep the
+    // current Eval.
+    if (nullptr != *evalPtr && evalPtr->use_count() > 1)
+    {
+        *evalPtr = std::make_shared<NOMAD::Eval>(**evalPtr);
+    }
+
+    return evalPtr->get();
+}
+
+
+NOMAD::Eval* NOMAD::EvalPoint::getOrCreateEvalToModify(const NOMAD::EvalType& evalType)
+{
+    auto eval = getEvalToModify(evalType);
+
+    if (nullptr == eval)
+    {
+        switch (evalType)
+        {
+            case NOMAD::EvalType::SGTE:
+                _evalSgte = std::make_shared<NOMAD::Eval>();
+                break;
+            case NOMAD::EvalType::BB:
+            default:
+                _eval = std::make_shared<NOMAD::Eval>();
+                break;
+        }
+        eval = getEvalToModify(evalType);
+    }
+
+    return eval;
+}
+
+
 void NOMAD::EvalPoint::setEval(const NOMAD::Eval& eval,
                                const NOMAD::EvalType& evalType)
 {
@@ -415,17 +441,33 @@ void NOMAD::EvalPoint::setEval(const NOMAD::Eval& eval,
     switch (evalType)
     {
         case NOMAD::EvalType::SGTE:
-            _evalSgte = NOMAD::EvalUPtr(new NOMAD::Eval(eval));
+            _evalSgte = std::make_shared<NOMAD::Eval>(eval);
             break;
         case NOMAD::EvalType::BB:
         default:
-            _eval = NOMAD::EvalUPtr(new NOMAD::Eval(eval));
+            _eval = std::make_shared<NOMAD::Eval>(eval);
             break;
     }
 
 }
 
 
+void NOMAD::EvalPoint::shareEval(const NOMAD::EvalPoint& evalPoint,
+                                 const NOMAD::EvalType& evalType)
+{
+    switch (evalType)
+    {
+        case NOMAD::EvalType::SGTE:
+            _evalSgte = evalPoint._evalSgte;
+            break;
+        case NOMAD::EvalType::BB:
+        default:
+            _eval = evalPoint._eval;
+            break;
+    }
+}
+
+
 NOMAD::Double NOMAD::EvalPoint::getF(const NOMAD::EvalType& evalType) const
 {
     NOMAD::Double f;
@@ -442,7 +484,7 @@ NOMAD::Double NOMAD::EvalPoint::getF(const NOMAD::EvalType& evalType) const
 
 void NOMAD::EvalPoint::setF(const NOMAD::Double f, const NOMAD::EvalType& evalType)
 {
-    auto eval = getEval(evalType);
+    auto eval = getEvalToModify(evalType);
 
     if (nullptr == eval)
     {
@@ -470,7 +512,7 @@ NOMAD::Double NOMAD::EvalPoint::getH(const NOMAD::EvalType& evalType) const
 
 void NOMAD::EvalPoint::setH(const NOMAD::Double &h, const NOMAD::EvalType& evalType)
 {
-    auto eval = getEval(evalType);
+    auto eval = getEvalToModify(evalType);
     if (nullptr == eval)
     {
         throw NOMAD::Exception(__FILE__, __LINE__, "Error: setting h on an EvalPoint that has no f.");
@@ -499,22 +541,7 @@ void NOMAD::EvalPoint::setBBO(const std::string &bbo,
                               const NOMAD::EvalType& evalType,
                               const bool evalOk)
 {
-    auto eval = getEval(evalType);
-
-    if (nullptr == eval)
-    {
-        switch (evalType)
-        {
-            case NOMAD::EvalType::SGTE:
-                _evalSgte = NOMAD::EvalUPtr(new NOMAD::Eval());
-                break;
-            case NOMAD::EvalType::BB:
-            default:
-                _eval = NOMAD::EvalUPtr(new NOMAD::Eval());
-                break;
-        }
-        eval = getEval(evalType);
-    }
+    auto eval = getOrCreateEvalToModify(evalType);
 
     eval->setBBO(bbo, bboutputtypes, evalOk);
 
@@ -535,26 +562,21 @@ void NOMAD::EvalPoint::setBBO(const NOMAD::BBOutput& bbo,
                               const NOMAD::EvalType& evalType,
                               const bool evalOk)
 {
-    auto eval = getEval(evalType);
-
-    if (nullptr == eval)
-    {
-        switch (evalType)
-        {
-            case NOMAD::EvalType::SGTE:
-                _evalSgte = NOMAD::EvalUPtr(new NOMAD::Eval());
-                break;
-            case NOMAD::EvalType::BB:
-            default:
-                _eval = NOMAD::EvalUPtr(new NOMAD::Eval());
-                break;
-        }
-        eval = getEval(evalType);
-    }
+    auto eval = getOrCreateEvalToModify(evalType);
     eval->setBBOutput(bbo);
 }
 
 
+void NOMAD::EvalPoint::setBBO(const NOMAD::BBOutput& bbo,
+                              const NOMAD::BBOutputTypeList &bboutputtypes,
+                              const NOMAD::EvalType& evalType)
+{
+    // Create the Eval if needed.
+    setBBO(bbo, evalType);
+    getEvalToModify(evalType)->recomputeFH(bboutputtypes);
+}
+
+
 NOMAD::EvalStatusType NOMAD::EvalPoint::getEvalStatus(const NOMAD::EvalType& evalType) const
 {
     NOMAD::EvalStatusType evalStatus = NOMAD::EvalStatusType::EVAL_STATUS_UNDEFINED;
@@ -572,22 +594,7 @@ NOMAD::EvalStatusType NOMAD::EvalPoint::getEvalStatus(const NOMAD::EvalType& eva
 void NOMAD::EvalPoint::setEvalStatus(const NOMAD::EvalStatusType &evalStatus,
                                      const NOMAD::EvalType& evalType)
 {
-    auto eval = getEval(evalType);
-
-    if (nullptr == eval)
-    {
-        switch (evalType)
-        {
-            case NOMAD::EvalType::SGTE:
-                _evalSgte = NOMAD::EvalUPtr(new NOMAD::Eval());
-                break;
-            case NOMAD::EvalType::BB:
-            default:
-                _eval = NOMAD::EvalUPtr(new NOMAD::Eval());
-                break;
-        }
-        eval = getEval(evalType);
-    }
+    auto eval = getOrCreateEvalToModify(evalType);
 
     eval->setEvalStatus(evalStatus);
 }
@@ -646,19 +653,17 @@ void NOMAD::EvalPoint::recomputeFH(const NOMAD::BBOutputTypeList &bbOutputType)
     // Recompute evals for all EvalTypes.
 
     // Recompute for blackbox
-    auto eval = getEval(NOMAD::EvalType::BB);
+    auto eval = getEvalToModify(NOMAD::EvalType::BB);
     if (nullptr != eval)
     {
-        auto bbo = eval->getBBOutput();
-        eval->setBBOutputAndRecompute(bbo, bbOutputType);
+        eval->recomputeFH(bbOutputType);
     }
 
     // Recompute for SGTE
-    eval = getEval(NOMAD::EvalType::SGTE);
+    eval = getEvalToModify(NOMAD::EvalType::SGTE);
     if (nullptr != eval)
     {
-        auto bbo = eval->getBBOutput();
-        eval->setBBOutputAndRecompute(bbo, bbOutputType);
+        eval->recomputeFH(bbOutputType);
     }
 }
 
@@ -872,7 +877,7 @@ std::istream& NOMAD::operator>>(std::istream& is, NOMAD::EvalPoint &evalPoint)
             is >> bbo;
 
             evalPoint.setBBO(bbo, NOMAD::EvalType::BB);
-            evalPoint.getEval(NOMAD::EvalType::BB)->toRecompute(true);
+            evalPoint.getEvalToModify(NOMAD::EvalType::BB)->toRecompute(true);
 
             // For now, set numEval to 1 if Eval exists. Currently,
             // only 1 Eval is correctly supported.
@@ -891,47 +896,6 @@ std::istream& NOMAD::operator>>(std::istream& is, NOMAD::EvalPoint &evalPoint)
 }
 
 
-
-#ifdef USE_UNORDEREDSET
-/// Used for unordered set.
-/// Template specialization of std::hash<class T> to std::hash<NOMAD@::EvalPoint>
-size_t std::hash<NOMAD::EvalPoint>::operator()(const NOMAD::EvalPoint& evalPoint) const
-{
-    double eps = NOMAD::Double::getEpsilon();
-    double sizeMax = SIZE_MAX;
-    size_t hashKey = 0;
-    double hashKeyDouble = hashKey; // Compute hashKey in double.
-
-    for (size_t i = 0; i < evalPoint.size(); i++)
-    {
-        hashKeyDouble *= 10.0;
-        double t = std::trunc(std::fabs(evalPoint[i].todouble() / eps));
-        hashKeyDouble += t;
-
-        // avoid size_t overflow, which would set hashKey to 0.
-        while (hashKeyDouble > sizeMax)
-        {
-            hashKeyDouble -= sizeMax;
-        }
-    }
-
-    // convert to size_t
-    hashKey = size_t(hashKeyDouble);
-
-    return hashKey;
-}
-
-
-/// Used for unordered set.
-/// Template specialization of std::equal_to<class T> to equal_to<NOMAD::EvalPoint>
-bool std::equal_to<NOMAD::EvalPoint>::operator()(const NOMAD::EvalPoint& lhs, const NOMAD::EvalPoint& rhs) const
-{
-
-    return (lhs == rhs);
-}
-#endif // USE_UNORDERED_SET
-
-
 bool NOMAD::EvalPoint::dominates(const NOMAD::EvalPoint &ep,
                                  const NOMAD::EvalType& evalType) const
 {
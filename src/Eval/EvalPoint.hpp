@@ -55,10 +55,9 @@
 #ifndef __NOMAD400_EVALPOINT__
 #define __NOMAD400_EVALPOINT__
 
+#include <set>
 #ifdef USE_UNORDEREDSET
 #include <unordered_set>
-#else
-#include <set>
 #endif
 
 #include "../Eval/Eval.hpp"
@@ -80,10 +79,14 @@ public:
 
 private:
 
-    EvalUPtr _eval; ///< Value of the evaluation (truth / blackbox)
-
+    /// Value of the evaluation (truth / blackbox)
+    /**
+     The Evals are shared between the copies of an EvalPoint, and copied
+     on write: use getEvalToModify() to modify them.
+     */
+    EvalSPtr _eval;
 
-    EvalUPtr _evalSgte; ///< Value of the surrogate evaluation
+    EvalSPtr _evalSgte; ///< Value of the surrogate evaluation, shared like _eval
 
 
     short _numberEval; ///< Number of times \c *this point has been evaluated (blackbox only)
@@ -140,11 +143,34 @@ public:
     const Point* getX() const { return dynamic_cast<const Point*>(this); }
 
     /// Get the Eval part of this EvalPoint, using the right EvalType (BB or SGTE)
-    Eval* getEval(const EvalType& evalType = NOMAD::EvalType::BB) const;
+    const Eval* getEval(const EvalType& evalType = NOMAD::EvalType::BB) const;
+
+    /// Get the Eval part of this EvalPoint, to modify it.
+    /**
+     If the Eval is shared with other copies of this EvalPoint, it is copied
+     first, so that the other copies are not modified.
+     \param evalType    Blackbox or surrogate evaluation  -- \b IN.
+     \return            The Eval, or \c nullptr if there is none.
+     */
+    Eval* getEvalToModify(const EvalType& evalType = NOMAD::EvalType::BB);
+
+private:
+    /// Get the Eval part of this EvalPoint, to modify it. Create it if needed.
+    Eval* getOrCreateEvalToModify(const EvalType& evalType);
+
+public:
 
     /// Set the Eval part of this EvalPoint, using the right EvalType (BB or SGTE)
     void setEval(const Eval& eval, const EvalType& evalType);
 
+    /// Set the Eval part of this EvalPoint to the one of evalPoint, without copying it.
+    /**
+     The Eval is shared, and copied on write, like between copies of an EvalPoint.
+     \param evalPoint   The EvalPoint holding the Eval  -- \b IN.
+     \param evalType    Blackbox or surrogate evaluation  -- \b IN.
+     */
+    void shareEval(const EvalPoint& evalPoint, const EvalType& evalType);
+
     /// Clear the surrogate evaluation of \c *this
     void clearEvalSgte() { _evalSgte = nullptr; }
 
@@ -200,6 +226,17 @@ public:
                 const EvalType& evalType = NOMAD::EvalType::BB,
                 const bool evalOk = true);
 
+    /// Set the true or surrogate blackbox output, and compute f and h.
+    /**
+     No string is parsed: use this when the outputs are computed as numbers.
+     \param bbo             A blackbox evaluation output -- \b IN.
+     \param bboutputtypes   The list of blackbox output types -- \b IN.
+     \param evalType        Blackbox or surrogate evaluation  -- \b IN.
+     */
+    void setBBO(const BBOutput &bbo,
+                const BBOutputTypeList &bboutputtypes,
+                const EvalType& evalType);
+
     /// Get evaluation status of the Eval of this EvalType
     EvalStatusType getEvalStatus(const EvalType& evalType) const;
 
@@ -350,43 +387,51 @@ public:
     }
 };
 
+/// Class for eval point hash, consistent with EvalPointEqual.
+/**
+ * Hash the Point part only.
+ */
+class EvalPointHash
+{
+public:
+    size_t operator() (const EvalPoint& evalPoint) const
+    {
+        return evalPoint.getX()->hash();
+    }
+};
+
+/// Class for eval point equality, consistent with EvalPointCompare.
+/**
+ * Compare the Point parts only: the equality is exact on the coordinates
+ * truncated with respect to epsilon.
+ */
+class EvalPointEqual
+{
+public:
+    bool operator() (const EvalPoint& lhs, const EvalPoint& rhs) const
+    {
+        return Point::weakEqual(*(lhs.getX()),*(rhs.getX()));
+    }
+};
+
 /// Definition for EvalPointSet
+typedef std::set<EvalPoint, EvalPointCompare> EvalPointSet;
+
+/// Definition for the set of EvalPoints of the cache
+/**
+ * With precompiler option USE_UNORDEREDSET, the cache is a hash set:
+ * finding a point costs a hash and an exact comparison, instead of going
+ * down a tree. The iteration order is not the order of EvalPointCompare.
+ */
 #ifdef USE_UNORDEREDSET
-    typedef std::unordered_set<EvalPoint,
-                               std::hash<EvalPoint>,
-                               std::equal_to<EvalPoint>> EvalPointSet;
+    typedef std::unordered_set<EvalPoint, EvalPointHash, EvalPointEqual> CacheEvalPointSet;
 #else
-    typedef std::set<EvalPoint, EvalPointCompare> EvalPointSet;
+    typedef EvalPointSet CacheEvalPointSet;
 #endif
 
 
 #include "../nomad_nsend.hpp"
 
-#ifdef USE_UNORDEREDSET
-/**
- * \warning If we use unordered_set, then we must define hash.
- * Template specialization for std::hash<class T> to T=EvalPoint
- */
-namespace std {
-    template <>
-    struct hash<EvalPoint>
-    {
-        public:
-        size_t operator()(const EvalPoint& evalPoint) const;
-    };
-
-/**
- * If we use unordered_set, then we must define function call operator to test equality.
- * Template specialization of std::equal_to<class T> to T=EvalPoint
- */
-    template <>
-    class equal_to<EvalPoint>
-    {
-        public:
-        bool operator()(const EvalPoint& lhs, const EvalPoint& rhs) const;
-    };
-}
-#endif // USE_UNORDEREDSET
 
 
 #include "../nomad_nsbegin.hpp"
@@ -50,6 +50,28 @@
 #include <stdio.h>  // For popen
 
 
+// Read a line of any length from a stream opened with popen.
+// The trailing newline is removed.
+// Return false if nothing could be read.
+static bool readOutputLine(FILE *stream, std::string &line)
+{
+    line.clear();
+    char buffer[1024];
+    while (nullptr != fgets(buffer, sizeof(buffer), stream))
+    {
+        line += buffer;
+        if (!line.empty() && '\n' == line.back())
+        {
+            line.pop_back();
+            return true;
+        }
+    }
+
+    // End of stream: the last line may have no newline.
+    return !line.empty();
+}
+
+
 //
 // Constructor
 //
@@ -60,7 +82,11 @@ NOMAD::Evaluator::Evaluator(
                     int nbThreads,
                     const NOMAD::EvalXDefined evalXDefined)
   : _evalParams(evalParams),
+    _bbOutputTypeHandle(evalParams->getAttributeHandle<NOMAD::BBOutputTypeList>("BB_OUTPUT_TYPE")),
+    _bbExeHandle(evalParams->getAttributeHandle<std::string>("BB_EXE")),
+    _bbExePersistentHandle(evalParams->getAttributeHandle<bool>("BB_EXE_PERSISTENT")),
     _tmpFiles(0),
+    _workers(0),
     _evalXDefined(evalXDefined),
     _evalType(evalType)
 {
@@ -88,6 +114,9 @@ NOMAD::Evaluator::Evaluator(
         _tmpFiles.push_back(tmpfilestr);
     }
 
+    // Persistent blackboxes are started on first use, by their thread.
+    _workers.resize(nbThreads);
+
     // Set default function to compute success according to evalType.
     NOMAD::ComputeSuccessType::setDefaultComputeSuccessTypeFunction(evalType);
 }
@@ -102,6 +131,9 @@ NOMAD::Evaluator::~Evaluator()
         remove(_tmpFiles[i].c_str());
     }
     _tmpFiles.clear();
+
+    // Close the input of the persistent blackboxes, so that they exit.
+    _workers.clear();
 }
 
 
@@ -202,12 +234,17 @@ std::vector<bool> NOMAD::Evaluator::evalXBBExe(NOMAD::Block &block,
 
     // At this point, we are for sure in batch mode.
     // Verify blackbox executable defined by BB_EXE is available and executable.
-    auto bbExe = _evalParams->getAttributeValue<std::string>("BB_EXE");
+    const auto& bbExe = _evalParams->getAttributeValue(_bbExeHandle);
     if (bbExe.empty())
     {
         throw NOMAD::Exception(__FILE__, __LINE__, "Evaluator: No blackbox executable defined.");
     }
 
+    if (_evalParams->getAttributeValue(_bbExePersistentHandle))
+    {
+        return evalXBBExePersistent(block, hMax, countEval);
+    }
+
     // Write a temp file for x0 and give that file as argument to bbExe.
     int threadNum = 0;
 #ifdef _OPENMP
@@ -243,8 +280,11 @@ std::vector<bool> NOMAD::Evaluator::evalXBBExe(NOMAD::Block &block,
     }
 
     std::string cmd = bbExe + " " + tmpfile;
-    std::string s = "System command: " + cmd;
+    std::string s;
+    OUTPUT_DEBUGDEBUG_START
+    s = "System command: " + cmd;
     NOMAD::OutputQueue::Add(s, NOMAD::OutputLevel::LEVEL_DEBUGDEBUG);
+    OUTPUT_DEBUGDEBUG_END
 
     FILE *fresult = popen(cmd.c_str(), "r");
     if (!fresult)
@@ -269,9 +309,8 @@ std::vector<bool> NOMAD::Evaluator::evalXBBExe(NOMAD::Block &block,
         {
             std::shared_ptr<NOMAD::EvalPoint> x = block[index];
 
-            char buffer[1024];
-            char *outputLine = fgets(buffer, sizeof(buffer), fresult);
-            if (NULL == outputLine)
+            std::string bbo;
+            if (!readOutputLine(fresult, bbo))
             {
                 // Something went wrong with the evaluation.
                 // Point could be re-submitted.
@@ -286,17 +325,9 @@ std::vector<bool> NOMAD::Evaluator::evalXBBExe(NOMAD::Block &block,
             else
             {
                 // Evaluation succeeded. Get and process blackbox output.
-                std::string bbo(outputLine);
-                // delete trailing '\n'
-                bbo.erase(bbo.size() - 1);
-
-                // Process blackbox output
-                NOMAD::BBOutput bbOutput(bbo);
-
-                auto bbOutputType = _evalParams->getAttributeValue<NOMAD::BBOutputTypeList>("BB_OUTPUT_TYPE");
-                x->getEval(_evalType)->setBBOutputAndRecompute(bbOutput, bbOutputType);
-                evalOk[index] = bbOutput.getEvalOk();
-                countEval[index] = bbOutput.getCountEval(bbOutputType);
+                bool countEval1 = false;
+                evalOk[index] = processBBOutput(*x, bbo, countEval1);
+                countEval[index] = countEval1;
             }
         }
 
@@ -347,3 +378,88 @@ std::vector<bool> NOMAD::Evaluator::evalXBBExe(NOMAD::Block &block,
 
     return evalOk;
 }
+
+
+// Evaluate the block with the persistent blackbox of this thread.
+std::vector<bool> NOMAD::Evaluator::evalXBBExePersistent(NOMAD::Block &block,
+                                                         const NOMAD::Double &hMax,
+                                                         std::vector<bool> &countEval) const
+{
+    std::vector<bool> evalOk(block.size(), false);
+
+    int threadNum = 0;
+#ifdef _OPENMP
+    threadNum = omp_get_thread_num();
+#endif
+    auto& worker = _workers[threadNum];
+    if (nullptr == worker)
+    {
+        worker.reset(new NOMAD::BlackboxWorker(_evalParams->getAttributeValue(_bbExeHandle)));
+    }
+
+    std::vector<std::string> inputLines;
+    for (auto it = block.begin(); it != block.end(); it++)
+    {
+        std::shared_ptr<NOMAD::EvalPoint> x = (*it);
+        std::string line;
+        for (size_t i = 0; i < x->size(); i++)
+        {
+            if (i != 0)
+            {
+                line += " ";
+            }
+            line += (*x)[i].tostring();
+        }
+        inputLines.push_back(line);
+    }
+
+    std::vector<std::string> outputLines;
+    worker->evalBlock(inputLines, outputLines);
+
+    for (size_t index = 0; index < block.size(); index++)
+    {
+        std::shared_ptr<NOMAD::EvalPoint> x = block[index];
+        if (index >= outputLines.size())
+        {
+            // The blackbox died before answering.
+            // Point could be re-submitted.
+            x->setEvalStatus(NOMAD::EvalStatusType::EVAL_ERROR, _evalType);
+            std::string s = "Warning: Evaluation error with point " + x->display() + ": no output from persistent blackbox";
+            NOMAD::OutputQueue::Add(s, NOMAD::OutputLevel::LEVEL_WARNING);
+            continue;
+        }
+
+        bool countEval1 = false;
+        evalOk[index] = processBBOutput(*x, outputLines[index], countEval1);
+        countEval[index] = countEval1;
+
+        if (x->getH(_evalType) > hMax)
+        {
+            x->setEvalStatus(NOMAD::EvalStatusType::EVAL_CONS_H_OVER, _evalType);
+        }
+        else if (!evalOk[index])
+        {
+            x->setEvalStatus(NOMAD::EvalStatusType::EVAL_FAILED, _evalType);
+        }
+        else
+        {
+            x->setEvalStatus(NOMAD::EvalStatusType::EVAL_OK, _evalType);
+        }
+    }
+
+    return evalOk;
+}
+
+
+bool NOMAD::Evaluator::processBBOutput(NOMAD::EvalPoint &x,
+                                       const std::string &bbo,
+                                       bool &countEval) const
+{
+    NOMAD::BBOutput bbOutput(bbo);
+
+    const auto& bbOutputType = _evalParams->getAttributeValue(_bbOutputTypeHandle);
+    x.getEvalToModify(_evalType)->setBBOutputAndRecompute(bbOutput, bbOutputType);
+    countEval = bbOutput.getCountEval(bbOutputType);
+
+    return bbOutput.getEvalOk();
+}
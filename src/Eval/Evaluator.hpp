@@ -56,6 +56,7 @@
 #define __NOMAD400_EVALUATOR__
 
 #include "../Eval/BBOutput.hpp"
+#include "../Eval/BlackboxWorker.hpp"
 #include "../Eval/EvalPoint.hpp"
 #include "../Math/Double.hpp"
 #include "../Param/EvalParameters.hpp"
@@ -80,6 +81,8 @@ class Barrier;
  * (provided in BB_EXE parameter) or by redifining the evaluation function
  * Evaluator::eval_x(). /n
  * To evaluate a block of points, the user must redifine Evaluator::eval_block() or make sure the external executable can evaluate all the provided points. /n
+ * If BB_EXE_PERSISTENT is true, the external executable is launched once
+ * per thread, and is sent the blocks of points through a BlackboxWorker. /n
  *
  */
 class Evaluator
@@ -87,9 +90,18 @@ class Evaluator
 protected:
     std::shared_ptr<EvalParameters> _evalParams; ///< The parameters controlling the behavior of the evaluator
 
+    /// Handle on BB_OUTPUT_TYPE, read for each point evaluated.
+    const AttributeHandle<BBOutputTypeList> _bbOutputTypeHandle;
+
 private:
+    const AttributeHandle<std::string> _bbExeHandle;     ///< Handle on BB_EXE, read for each block evaluated.
+    const AttributeHandle<bool> _bbExePersistentHandle;  ///< Handle on BB_EXE_PERSISTENT, read for each block evaluated.
+
     std::vector<std::string> _tmpFiles; ///< One file per thread.
 
+    /// One persistent blackbox per thread, started on first use, when BB_EXE_PERSISTENT is true.
+    mutable std::vector<std::unique_ptr<BlackboxWorker>> _workers;
+
     /// Did the user redefine eval_x() for single point, or should we use BB_EXE ?
     mutable EvalXDefined _evalXDefined;
 
@@ -165,6 +177,22 @@ private:
     virtual std::vector<bool> evalXBBExe(Block &block,
                                          const Double &hMax,
                                          std::vector<bool> &countEval) const;
+
+    /// Helper for evalXBBExe(), when BB_EXE_PERSISTENT is true
+    std::vector<bool> evalXBBExePersistent(Block &block,
+                                           const Double &hMax,
+                                           std::vector<bool> &countEval) const;
+
+    /// Set the Eval of a point from a line of blackbox output.
+    /**
+     \param x          The evaluated point              -- \b IN/OUT.
+     \param bbo        The blackbox output for x        -- \b IN.
+     \param countEval  Indicates if the evaluation has to be counted or not -- \b OUT.
+     \return           \c true if the evaluation succeeded, \c false otherwise.
+     */
+    bool processBBOutput(EvalPoint &x,
+                         const std::string &bbo,
+                         bool &countEval) const;
 };
 
 #include "../nomad_nsend.hpp"
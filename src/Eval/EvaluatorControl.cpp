@@ -47,7 +47,6 @@
 #include "../Eval/EvaluatorControl.hpp"
 #include "../Output/OutputQueue.hpp"
 #include "../Util/Clock.hpp"
-#include <unistd.h> // For usleep
 
 // Initialization of static stop reasons used in the libNomadEval library
 NOMAD::StopReason<NOMAD::BaseStopType> NOMAD::AllStopReasons::_baseStopReason = NOMAD::StopReason<NOMAD::BaseStopType>();
@@ -64,9 +63,29 @@ void NOMAD::EvaluatorControl::init()
     omp_init_lock(&_evalQueueLock);
 #endif // _OPENMP
 
+#ifndef USE_PRIORITY_QUEUE
+    // One deque per thread. The number of threads is already set
+    // when the EvaluatorControl is created.
+    size_t nbDeques = 1;
+#ifdef _OPENMP
+    nbDeques = std::max(1, omp_get_max_threads());
+#endif // _OPENMP
+    _evalPointDeques.resize(nbDeques);
+#ifdef _OPENMP
+    for (auto &evalPointDeque : _evalPointDeques)
+    {
+        omp_init_lock(&evalPointDeque._lock);
+    }
+#endif // _OPENMP
+#endif // USE_PRIORITY_QUEUE
+
     // Set opportunism.
     // The parameter will be re-read in run(), because it may change.
-    _opportunisticEval = _evalContParams->getAttributeValue<bool>("OPPORTUNISTIC_EVAL");
+    _opportunisticEval = _evalContParams->getAttributeValue(_opportunisticEvalHandle);
+
+    // Same for asynchronous evaluations.
+    _asyncEval = _evalContParams->getAttributeValue(_asyncEvalHandle);
+    _maxStaleness = _evalContParams->getAttributeValue(_maxStalenessHandle);
 }
 
 
@@ -74,7 +93,7 @@ void NOMAD::EvaluatorControl::init()
 // To be called by the Destructor.
 void NOMAD::EvaluatorControl::destroy()
 {
-    if (!_evalPointQueue.empty())
+    if (getQueueSize() > 0)
     {
         // Show warnings and debug info.
         // Do not scare the user if display degree is medium or low.
@@ -88,6 +107,12 @@ void NOMAD::EvaluatorControl::destroy()
     }
 
 #ifdef _OPENMP
+#ifndef USE_PRIORITY_QUEUE
+    for (auto &evalPointDeque : _evalPointDeques)
+    {
+        omp_destroy_lock(&evalPointDeque._lock);
+    }
+#endif // USE_PRIORITY_QUEUE
     omp_destroy_lock(&_evalQueueLock);
 #endif // _OPENMP
 }
@@ -115,6 +140,17 @@ void NOMAD::EvaluatorControl::setNbEval(const size_t nbEval)
 }
 
 
+size_t NOMAD::EvaluatorControl::getQueueSize() const
+{
+#ifdef USE_PRIORITY_QUEUE
+    return _evalPointQueue.size();
+#else
+    // Points staged by master thread are not yet in the deques.
+    return _evalPointQueue.size() + _nbPointsInDeques;
+#endif // USE_PRIORITY_QUEUE
+}
+
+
 std::shared_ptr<NOMAD::EvalParameters> NOMAD::EvaluatorControl::getEvalParams() const
 {
     std::shared_ptr<NOMAD::EvalParameters> evalParams = nullptr;
@@ -164,20 +200,23 @@ void NOMAD::EvaluatorControl::unlockQueue(bool doSort)
         omp_unset_lock(&_evalQueueLock);
         throw NOMAD::Exception(__FILE__, __LINE__, err);
     }
-
-    // Now, unlock the queue.
-    omp_unset_lock(&_evalQueueLock);
 #endif // _OPENMP
 
 #ifndef USE_PRIORITY_QUEUE
-    // When using a vector instead of priority, the EvalQueuePoints are added randomly.
+    // When using deques instead of priority, the EvalQueuePoints are added randomly.
     // Sort them, using default sort, if doSort is true (default).
     // In non-opportunistic context, it is useless to sort.
-    if (doSort && _opportunisticEval)
-    {
-        sort(_comp);
-    }
+    // The points are made available to the threads at this point.
+    dealPointsToDeques(doSort && _opportunisticEval, _comp);
 #endif // USE_PRIORITY_QUEUE
+
+#ifdef _OPENMP
+    // Now, unlock the queue.
+    omp_unset_lock(&_evalQueueLock);
+#endif // _OPENMP
+
+    // Points may have been added: wake up the threads waiting for points.
+    notifyEvent();
 }
 
 
@@ -205,13 +244,18 @@ void NOMAD::EvaluatorControl::addToQueue(const NOMAD::EvalQueuePointPtr &evalQue
     }
 #endif // _OPENMP
 
+    // Remember the most recent iteration, to find stale points.
+    if (evalQueuePoint->getMeshSize().isDefined() && evalQueuePoint->getK() > _currentK)
+    {
+        _currentK = evalQueuePoint->getK();
+    }
+
 #ifdef USE_PRIORITY_QUEUE
     _evalPointQueue.push(evalQueuePoint);
 #else
-
-    // CT Lexicographic order instead of inverse lexicographic order
-    _evalPointQueue.insert ( _evalPointQueue.begin() , evalQueuePoint );
-    //_evalPointQueue.push_back(evalQueuePoint);
+    // Staged until unlockQueue(). The points are evaluated in
+    // the order they are added, unless they are sorted.
+    _evalPointQueue.push_back(evalQueuePoint);
 #endif // USE_PRIORITY_QUEUE
 
 }
@@ -222,29 +266,130 @@ void NOMAD::EvaluatorControl::addToQueue(const NOMAD::EvalQueuePointPtr &evalQue
 bool NOMAD::EvaluatorControl::popEvalPoint(NOMAD::EvalQueuePointPtr &evalQueuePoint)
 {
     bool success = false;
+#ifdef USE_PRIORITY_QUEUE
 #ifdef _OPENMP
     omp_set_lock(&_evalQueueLock);
 #endif // _OPENMP
     if (!_evalPointQueue.empty())
     {
-#ifdef USE_PRIORITY_QUEUE
         evalQueuePoint = std::move(_evalPointQueue.top());
         _evalPointQueue.pop();
+        success = true;
+    }
+#ifdef _OPENMP
+    omp_unset_lock(&_evalQueueLock);
+#endif // _OPENMP
 #else
-        // Remove last element, simulate a "pop".
-        evalQueuePoint = std::move(_evalPointQueue[_evalPointQueue.size()-1]);
-        _evalPointQueue.erase(_evalPointQueue.end()-1);
+    if (_nbPointsInDeques > 0)
+    {
+        const size_t nbDeques = _evalPointDeques.size();
+        size_t threadIndex = 0;
+#ifdef _OPENMP
+        threadIndex = static_cast<size_t>(omp_get_thread_num()) % nbDeques;
+#endif // _OPENMP
+        // Pop from this thread's deque first. If it is empty,
+        // steal from the other threads' deques.
+        for (size_t i = 0; i < nbDeques && !success; i++)
+        {
+            success = popFromDeque((threadIndex + i) % nbDeques, evalQueuePoint);
+        }
+    }
 #endif // USE_PRIORITY_QUEUE
+
+    return success;
+}
+
+
+#ifndef USE_PRIORITY_QUEUE
+bool NOMAD::EvaluatorControl::popFromDeque(const size_t dequeIndex,
+                                           NOMAD::EvalQueuePointPtr &evalQueuePoint)
+{
+    bool success = false;
+    auto &evalPointDeque = _evalPointDeques[dequeIndex];
+#ifdef _OPENMP
+    omp_set_lock(&evalPointDeque._lock);
+#endif // _OPENMP
+    if (!evalPointDeque._points.empty())
+    {
+        evalQueuePoint = std::move(evalPointDeque._points.front());
+        evalPointDeque._points.pop_front();
+        _nbPointsInDeques--;
         success = true;
     }
 #ifdef _OPENMP
-    omp_unset_lock(&_evalQueueLock);
+    omp_unset_lock(&evalPointDeque._lock);
 #endif // _OPENMP
 
     return success;
 }
 
 
+void NOMAD::EvaluatorControl::dealPointsToDeques(const bool doSort, NOMAD::ComparePriority comp)
+{
+    const size_t nbDeques = _evalPointDeques.size();
+#ifdef _OPENMP
+    // Always lock the deques in the same order.
+    for (auto &evalPointDeque : _evalPointDeques)
+    {
+        omp_set_lock(&evalPointDeque._lock);
+    }
+#endif // _OPENMP
+
+    if (doSort)
+    {
+        // Gather all points in a single vector, popped from the back:
+        // staged points, most recently added first, then remaining points,
+        // in the reverse order they would be popped.
+        std::vector<NOMAD::EvalQueuePointPtr> points(_evalPointQueue.rbegin(), _evalPointQueue.rend());
+        std::vector<NOMAD::EvalQueuePointPtr> remainingPoints;
+        remainingPoints.reserve(_nbPointsInDeques);
+        for (size_t rank = 0; remainingPoints.size() < _nbPointsInDeques; rank++)
+        {
+            for (auto &evalPointDeque : _evalPointDeques)
+            {
+                if (rank < evalPointDeque._points.size())
+                {
+                    remainingPoints.push_back(std::move(evalPointDeque._points[rank]));
+                }
+            }
+        }
+        points.insert(points.end(), remainingPoints.rbegin(), remainingPoints.rend());
+
+        // After sorting, the point with the highest priority is at the back.
+        std::sort(points.begin(), points.end(), comp);
+
+        for (auto &evalPointDeque : _evalPointDeques)
+        {
+            evalPointDeque._points.clear();
+        }
+        size_t i = 0;
+        for (auto it = points.rbegin(); it != points.rend(); ++it, ++i)
+        {
+            _evalPointDeques[i % nbDeques]._points.push_back(std::move(*it));
+        }
+        _nbPointsInDeques = points.size();
+    }
+    else
+    {
+        // Staged points go after the remaining points.
+        for (size_t i = 0; i < _evalPointQueue.size(); i++)
+        {
+            _evalPointDeques[i % nbDeques]._points.push_back(std::move(_evalPointQueue[i]));
+        }
+        _nbPointsInDeques += _evalPointQueue.size();
+    }
+    _evalPointQueue.clear();
+
+#ifdef _OPENMP
+    for (auto &evalPointDeque : _evalPointDeques)
+    {
+        omp_unset_lock(&evalPointDeque._lock);
+    }
+#endif // _OPENMP
+}
+#endif // USE_PRIORITY_QUEUE
+
+
 bool NOMAD::EvaluatorControl::popBlock(NOMAD::BlockForEval &block)
 {
     bool success = false;
@@ -259,7 +404,7 @@ bool NOMAD::EvaluatorControl::popBlock(NOMAD::BlockForEval &block)
     {
         try
         {
-            blockSize = _evalContParams->getAttributeValue<size_t>("BB_MAX_BLOCK_SIZE");
+            blockSize = _evalContParams->getAttributeValue(_bbMaxBlockSizeHandle);
             gotBlockSize = true;
         }
         catch (NOMAD::Exception &e)
@@ -272,7 +417,16 @@ bool NOMAD::EvaluatorControl::popBlock(NOMAD::BlockForEval &block)
     {
         NOMAD::EvalQueuePointPtr evalQueuePoint;
         popWorks = popEvalPoint(evalQueuePoint);
-        if (popWorks)
+        if (popWorks && isStale(evalQueuePoint))
+        {
+            // Discard the point and pop the next one.
+            OUTPUT_DEBUG_START
+            std::string s = "Discard stale point from queue: ";
+            s += evalQueuePoint->display();
+            NOMAD::OutputQueue::Add(s, NOMAD::OutputLevel::LEVEL_DEBUG);
+            OUTPUT_DEBUG_END
+        }
+        else if (popWorks)
         {
             block.push_back(std::move(evalQueuePoint));
             success = true;
@@ -284,13 +438,23 @@ bool NOMAD::EvaluatorControl::popBlock(NOMAD::BlockForEval &block)
 }
 
 
+bool NOMAD::EvaluatorControl::isStale(const NOMAD::EvalQueuePointPtr &evalQueuePoint) const
+{
+    // Points without a mesh were not generated by an iteration:
+    // their iteration number is meaningless.
+    return (_asyncEval
+            && evalQueuePoint->getMeshSize().isDefined()
+            && evalQueuePoint->getK() + _maxStaleness < _currentK);
+}
+
+
 #ifndef USE_PRIORITY_QUEUE
 void NOMAD::EvaluatorControl::sort(NOMAD::ComparePriority comp)
 {
 #ifdef _OPENMP
     omp_set_lock(&_evalQueueLock);
 #endif // _OPENMP
-    std::sort(_evalPointQueue.begin(), _evalPointQueue.end(), comp);
+    dealPointsToDeques(true /* doSort */, comp);
 #ifdef _OPENMP
     omp_unset_lock(&_evalQueueLock);
 #endif // _OPENMP
@@ -305,12 +469,17 @@ void NOMAD::EvaluatorControl::clearQueue(const bool waitRunning, const bool show
     // could pop up unexpectedtly.
     if (waitRunning)
     {
-        while (_currentlyRunning > 0)
+        while (true)
         {
+            const size_t nbEvents = getNbEvents();
+            if (0 == _currentlyRunning)
+            {
+                break;
+            }
             std::string s = "Waiting for " + NOMAD::itos(_currentlyRunning);
             s += " evaluations to complete.";
             NOMAD::OutputQueue::Add(s, NOMAD::OutputLevel::LEVEL_INFO);
-            usleep(10000);
+            waitForEvent(nbEvents);
         }
     }
 
@@ -331,7 +500,8 @@ void NOMAD::EvaluatorControl::clearQueue(const bool waitRunning, const bool show
         _evalPointQueue.pop();
     }
 #else
-    // Queue is a vector: Show all (if showDebug is true), then delete all.
+    // Queue is a vector of staged points and a deque per thread:
+    // Show all (if showDebug is true), then delete all.
     if (showDebug)
     {
         for (auto evalQueuePoint : _evalPointQueue)
@@ -342,6 +512,27 @@ void NOMAD::EvaluatorControl::clearQueue(const bool waitRunning, const bool show
         }
     }
     _evalPointQueue.clear();
+
+    for (auto &evalPointDeque : _evalPointDeques)
+    {
+#ifdef _OPENMP
+        omp_set_lock(&evalPointDeque._lock);
+#endif // _OPENMP
+        if (showDebug)
+        {
+            for (auto evalQueuePoint : evalPointDeque._points)
+            {
+                std::string s = "Delete point from queue: ";
+                s += evalQueuePoint->display();
+                NOMAD::OutputQueue::Add(s, NOMAD::OutputLevel::LEVEL_DEBUG);
+            }
+        }
+        _nbPointsInDeques -= evalPointDeque._points.size();
+        evalPointDeque._points.clear();
+#ifdef _OPENMP
+        omp_unset_lock(&evalPointDeque._lock);
+#endif // _OPENMP
+    }
 #endif // USE_PRIORITY_QUEUE
 
 #ifdef _OPENMP
@@ -355,7 +546,7 @@ void NOMAD::EvaluatorControl::clearQueue(const bool waitRunning, const bool show
 // as soon as a successful point is found, and flush the queue.
 //
 // Points must already be in the cache.
-NOMAD::SuccessType NOMAD::EvaluatorControl::run()
+NOMAD::SuccessType NOMAD::EvaluatorControl::run(const bool allowAsyncEval)
 {
     // Master thread only:
     //  - Reset success
@@ -372,7 +563,7 @@ NOMAD::SuccessType NOMAD::EvaluatorControl::run()
         _success = NOMAD::SuccessType::UNSUCCESSFUL;
 
         // An empty eval queue must be accounted for
-        if (_evalPointQueue.empty())
+        if (0 == getQueueSize())
         {
             NOMAD::AllStopReasons::set(NOMAD::EvalStopType::EMPTY_LIST_OF_POINTS);
         }
@@ -396,13 +587,23 @@ NOMAD::SuccessType NOMAD::EvaluatorControl::run()
             NOMAD::AllStopReasons::set(NOMAD::EvalStopType::STARTED);
         }
 
-        _opportunisticEval = _evalContParams->getAttributeValue<bool>("OPPORTUNISTIC_EVAL");
+        _opportunisticEval = _evalContParams->getAttributeValue(_opportunisticEvalHandle);
+        _asyncEval = _evalContParams->getAttributeValue(_asyncEvalHandle);
+        _maxStaleness = _evalContParams->getAttributeValue(_maxStalenessHandle);
+        _asyncRun = allowAsyncEval && _asyncEval;
 
+        OUTPUT_DEBUG_START
         std::string s = "Start evaluation. Opportunism = ";
         s += NOMAD::boolToString(_opportunisticEval);
+        if (_asyncRun)
+        {
+            s += ", Asynchronous, " + NOMAD::itos(_currentlyRunning) + " evaluations in progress";
+        }
         s += ", Barrier =";
-        s += ((nullptr == _barrier) ? " NULL" : "\n" + _barrier->display(4)); // Display a maximum of 4 xFeas and 4 xInf
+        auto barrier = getBarrier();
+        s += ((nullptr == barrier) ? " NULL" : "\n" + barrier->display(4)); // Display a maximum of 4 xFeas and 4 xInf
         NOMAD::OutputQueue::Add(s, NOMAD::OutputLevel::LEVEL_DEBUG);
+        OUTPUT_DEBUG_END
 
     }
 
@@ -417,6 +618,10 @@ NOMAD::SuccessType NOMAD::EvaluatorControl::run()
     // conditionForStop is true in any thread if reachedMaxEval() returns true; otherwise, it is always false.
     while (!conditionForStop && !_doneWithEval)
     {
+        // Get the number of events before looking at the queue, to
+        // know if points were added since then, when waiting.
+        const size_t nbEvents = getNbEvents();
+
         // Check for stop conditions
 #ifdef _OPENMP
         #pragma omp master
@@ -432,7 +637,6 @@ NOMAD::SuccessType NOMAD::EvaluatorControl::run()
         {
             _currentlyRunning += block.size();
             bool evalOk = evalBlock(block);
-            _currentlyRunning -= block.size();
             if (evalOk)
             {
                 // Update SuccessType
@@ -463,10 +667,16 @@ NOMAD::SuccessType NOMAD::EvaluatorControl::run()
 
                 AddStatsInfo(block);
             }
+
+            // The success is updated: master thread may stop waiting.
+            _currentlyRunning -= block.size();
+            notifyEvent();
         }
-        else if (!_doneWithEval)
+        else if (!_doneWithEval && !conditionForStop)
         {
             displayDebugWaitingInfo(lastDisplayed);
+            // Sleep until points are added to the queue, or until stop().
+            waitForEvent(nbEvents);
         }
         else // Queue is empty and we are doneWithEval
         {
@@ -495,14 +705,34 @@ NOMAD::SuccessType NOMAD::EvaluatorControl::run()
         // We must wait for all points to really be evaluated.
         // Note that when all points are evaluated, _success has the correct
         // value, even if it was modified by those last points being evaluated.
-        while (( NOMAD::AllStopReasons::testIf ( NOMAD::EvalStopType::ALL_POINTS_EVALUATED )
-                || _evalContParams->getAttributeValue<bool>("CLEAR_EVAL_QUEUE"))
-               && _currentlyRunning > 0)
+        // With asynchronous evaluations, do not wait: the evaluations in
+        // progress will be taken into account by a later iteration. Wait
+        // only if the evaluations are over for good.
+        while (true)
         {
+            const size_t nbEvents = getNbEvents();
+            bool doWait = false;
+            if (_asyncRun)
+            {
+                doWait = (   NOMAD::AllStopReasons::checkBaseTerminate()
+                          || NOMAD::AllStopReasons::testIf(NOMAD::EvalStopType::MAX_BB_EVAL_REACHED)
+                          || NOMAD::AllStopReasons::testIf(NOMAD::EvalStopType::MAX_EVAL_REACHED)
+                          || NOMAD::AllStopReasons::testIf(NOMAD::EvalStopType::MAX_BLOCK_EVAL_REACHED));
+            }
+            else
+            {
+                doWait = (   NOMAD::AllStopReasons::testIf(NOMAD::EvalStopType::ALL_POINTS_EVALUATED)
+                          || _evalContParams->getAttributeValue(_clearEvalQueueHandle));
+            }
+            if (!doWait || 0 == _currentlyRunning)
+            {
+                break;
+            }
             std::string s = "Waiting for " + NOMAD::itos(_currentlyRunning);
             s += " evaluations to complete.";
             NOMAD::OutputQueue::Add(s, NOMAD::OutputLevel::LEVEL_INFO);
-            usleep(10000);
+            // Sleep until an evaluation completes.
+            waitForEvent(nbEvents);
 
             // Update stopReason in case we found a success
             if (_opportunisticEval && _success >= NOMAD::SuccessType::PARTIAL_SUCCESS)
@@ -520,11 +750,13 @@ NOMAD::SuccessType NOMAD::EvaluatorControl::run()
     #pragma omp master
 #endif // _OPENMP
     {
-        if (_evalContParams->getAttributeValue<bool>("CLEAR_EVAL_QUEUE"))
+        // With asynchronous evaluations, the remaining points are kept
+        // in the queue, and discarded when they become stale.
+        if (!_asyncRun && _evalContParams->getAttributeValue(_clearEvalQueueHandle))
         {
             // Remove remaining points from queue, to start fresh next time.
             // Otherwise, we keep on evaluationg the points remaining in the queue.
-            NOMAD::OutputQueue::Add("Evaluation is done. Clear queue of " + NOMAD::itos(_evalPointQueue.size()) + " points.");
+            NOMAD::OutputQueue::Add("Evaluation is done. Clear queue of " + NOMAD::itos(getQueueSize()) + " points.");
             clearQueue(true /* waitRunning */, false /* showDebug */);
         }
 
@@ -542,6 +774,7 @@ NOMAD::SuccessType NOMAD::EvaluatorControl::run()
 void NOMAD::EvaluatorControl::stop()
 {
     _doneWithEval = true;
+    notifyEvent();
 }
 
 
@@ -558,7 +791,7 @@ bool NOMAD::EvaluatorControl::stopMainEval()
     doStopEval = doStopEval || ( NOMAD::AllStopReasons::testIf( NOMAD::EvalStopType::OPPORTUNISTIC_SUCCESS) );
 
     // Update stopReason if queue is empty
-    if (_evalPointQueue.empty() && (!doStopEval || NOMAD::AllStopReasons::testIf(NOMAD::EvalStopType::EMPTY_LIST_OF_POINTS)) )
+    if (0 == getQueueSize() && (!doStopEval || NOMAD::AllStopReasons::testIf(NOMAD::EvalStopType::EMPTY_LIST_OF_POINTS)) )
     {
         NOMAD::AllStopReasons::set(NOMAD::EvalStopType::ALL_POINTS_EVALUATED);
         doStopEval = true;
@@ -606,9 +839,9 @@ bool NOMAD::EvaluatorControl::reachedMaxEval() const
 
     try
     {
-        maxBbEval       = _evalContParams->getAttributeValue<size_t>("MAX_BB_EVAL");
-        maxEval         = _evalContParams->getAttributeValue<size_t>("MAX_EVAL");
-        maxBlockEval    = _evalContParams->getAttributeValue<size_t>("MAX_BLOCK_EVAL");
+        maxBbEval       = _evalContParams->getAttributeValue(_maxBbEvalHandle);
+        maxEval         = _evalContParams->getAttributeValue(_maxEvalHandle);
+        maxBlockEval    = _evalContParams->getAttributeValue(_maxBlockEvalHandle);
     }
     catch (NOMAD::Exception &e)
     {
@@ -666,7 +899,7 @@ bool NOMAD::EvaluatorControl::reachedMaxStepEval() const
         // TODO: Default for NOMAD 3 is 10000. Default for NOMAD 4 is 100.
         // Look if/how we can increment the number of evaluations without 
         // increasing the time too much.
-        maxSgteEval = _evalContParams->getAttributeValue<size_t>("SGTELIB_MODEL_EVAL_NB");
+        maxSgteEval = _evalContParams->getAttributeValue(_sgteEvalNbHandle);
     }
     catch (NOMAD::Exception &e)
     {
@@ -724,6 +957,39 @@ void NOMAD::EvaluatorControl::displayDebugWaitingInfo(time_t &lastDisplayed) con
 }
 
 
+void NOMAD::EvaluatorControl::notifyEvent()
+{
+#ifdef _OPENMP
+    {
+        std::lock_guard<std::mutex> lock(_eventMutex);
+        _nbEvents++;
+    }
+    _eventCond.notify_all();
+#endif // _OPENMP
+}
+
+
+size_t NOMAD::EvaluatorControl::getNbEvents()
+{
+    size_t nbEvents = 0;
+#ifdef _OPENMP
+    std::lock_guard<std::mutex> lock(_eventMutex);
+    nbEvents = _nbEvents;
+#endif // _OPENMP
+    return nbEvents;
+}
+
+
+void NOMAD::EvaluatorControl::waitForEvent(const size_t nbEvents)
+{
+#ifdef _OPENMP
+    std::unique_lock<std::mutex> lock(_eventMutex);
+    _eventCond.wait_for(lock, std::chrono::seconds(1),
+                        [&]{ return nbEvents != _nbEvents; });
+#endif // _OPENMP
+}
+
+
 void NOMAD::EvaluatorControl::AddStatsInfo(const NOMAD::BlockForEval& block) const
 {
     // SGTE optimizations generate a lot of stats output. Do not show them.
@@ -775,8 +1041,8 @@ void NOMAD::EvaluatorControl::AddStatsInfo(const NOMAD::BlockForEval& block) con
         stats->setComment(evalQueuePoint->getComment());
         stats->setGenStep(evalQueuePoint->getGenStep());
 
-        std::string s = "Evaluated point: " + evalQueuePoint->display();
-        NOMAD::OutputInfo outputInfo("EvaluatorControl", s, NOMAD::OutputLevel::LEVEL_STATS);
+        // The message of a LEVEL_STATS info is not displayed: only its stats are.
+        NOMAD::OutputInfo outputInfo("EvaluatorControl", "Evaluated point", NOMAD::OutputLevel::LEVEL_STATS);
         outputInfo.setStatsInfo(std::move(stats));
         NOMAD::OutputQueue::Add(std::move(outputInfo));
     }
@@ -816,12 +1082,13 @@ void NOMAD::EvaluatorControl::computeSuccess(NOMAD::EvalQueuePointPtr evalQueueP
     if (evalOk)
     {
         NOMAD::EvalPointPtr xFeas, xInf;
-        if (nullptr != _barrier)
+        auto barrier = getBarrier();
+        if (nullptr != barrier)
         {
             // Use first xFeas and xInf - their Eval must be equivalent, and it
             // is the only part that is used for comparison.
-            xFeas = _barrier->getFirstXFeas();
-            xInf  = _barrier->getFirstXInf();
+            xFeas = barrier->getFirstXFeas();
+            xInf  = barrier->getFirstXInf();
         }
 
         NOMAD::ComputeSuccessType computeSuccessType;
@@ -839,10 +1106,12 @@ void NOMAD::EvaluatorControl::computeSuccess(NOMAD::EvalQueuePointPtr evalQueueP
 
     evalQueuePoint->setSuccess(success);
 
+    OUTPUT_DEBUG_START
     std::string s = NOMAD::evalTypeToString(getEvalType()) + " Evaluation done for ";
     s += evalQueuePoint->displayAll();
     s += ". Success found: " + NOMAD::enumStr(evalQueuePoint->getSuccess());
     NOMAD::OutputQueue::Add(s, NOMAD::OutputLevel::LEVEL_DEBUG);
+    OUTPUT_DEBUG_END
 }
 
 
@@ -972,6 +1241,9 @@ std::vector<bool> NOMAD::EvaluatorControl::evalBlockOfPoints(
         NOMAD::CacheBase::getInstance()->update(evalPoint, getEvalType());
     }
 
+    // Merge the cache journal into the cache file, if it holds enough points.
+    NOMAD::CacheBase::getInstance()->compactJournalIfNeeded();
+
     // One more block evaluated.
     _blockEval++;
 
@@ -988,7 +1260,13 @@ void NOMAD::EvaluatorControl::updateEvalStatusBeforeEval(NOMAD::EvalPoint &evalP
     // Find the EvalPoint in the cache and set its eval status to IN_PROGRESS.
     NOMAD::EvalPoint foundEvalPoint;
     size_t nbFound = NOMAD::CacheBase::getInstance()->find(evalPoint, foundEvalPoint);
-    if (nbFound == 0)
+    if (nbFound == 0 && NOMAD::CacheBase::getInstance()->getNbEvicted() > 0)
+    {
+        // The point was evicted from the cache while waiting in the queue.
+        // The cache update inserts it again.
+        foundEvalPoint = evalPoint;
+    }
+    else if (nbFound == 0)
     {
         err = "NOMAD::EvaluatorControl: updateEvalStatusBeforeEval: EvalPoint not found: ";
         err += evalPoint.display();
@@ -64,10 +64,15 @@
 #include "../Algos/AllStopReasons.hpp"
 
 #include <atomic>       // For atomic
+#ifdef _OPENMP
+#include <condition_variable>
+#include <mutex>
+#endif // _OPENMP
 #include <time.h>
 #ifdef USE_PRIORITY_QUEUE
 #include <queue>        // For priority_queue
 #else
+#include <deque>
 #include <vector>
 #endif // USE_PRIORITY_QUEUE
 
@@ -84,6 +89,20 @@ private:
     std::unique_ptr<Evaluator> _evaluator;///< The Evaluator for evaluating points.
 
     std::shared_ptr<EvaluatorControlParameters> _evalContParams;  ///< The parameters controlling the behavior of the class
+
+    /**
+     * Handles on the parameters read for each point or in wait loops,
+       to get their values without lookup by name.
+     */
+    const AttributeHandle<bool>   _opportunisticEvalHandle;   ///< OPPORTUNISTIC_EVAL
+    const AttributeHandle<bool>   _clearEvalQueueHandle;      ///< CLEAR_EVAL_QUEUE
+    const AttributeHandle<bool>   _asyncEvalHandle;           ///< ASYNC_EVAL
+    const AttributeHandle<size_t> _maxStalenessHandle;        ///< ASYNC_EVAL_MAX_STALENESS
+    const AttributeHandle<size_t> _bbMaxBlockSizeHandle;      ///< BB_MAX_BLOCK_SIZE
+    const AttributeHandle<size_t> _maxBbEvalHandle;           ///< MAX_BB_EVAL
+    const AttributeHandle<size_t> _maxEvalHandle;             ///< MAX_EVAL
+    const AttributeHandle<size_t> _maxBlockEvalHandle;        ///< MAX_BLOCK_EVAL
+    const AttributeHandle<size_t> _sgteEvalNbHandle;          ///< SGTELIB_MODEL_EVAL_NB
     
     /// The queue of points to be evaluated.
       /**
@@ -99,27 +118,69 @@ private:
                         ComparePriority> _evalPointQueue;
 #else
     /**
-     * The queue is implemented as a vector. Points are added at the end of
-      the queue. Points are sorted using the _comp() which is called
-      in unlockQueue() when the user is done adding points to the queue. \n
+     * Points added by the master thread, between lockQueue() and unlockQueue(),
+      are staged in this vector. \n
+     * In unlockQueue(), they are sorted using _comp(), with the points
+      remaining from previous runs, and dealt in priority order to the
+      per-thread deques (_evalPointDeques). \n
      * Sorting the queue can also be done by providing another function.
      */
     std::vector<EvalQueuePointPtr> _evalPointQueue;
     ComparePriority _comp;
+
+    /**
+     * One deque of points to evaluate per thread, each with its own lock. \n
+     * A thread pops points from the front of its own deque. When it is empty,
+       the thread steals points from the front of the other deques.
+       This way, threads do not contend on a single lock to get points. \n
+     * Points are dealt round robin, in priority order, so the global
+       priority order is only approximately respected when there are
+       multiple threads. With a single thread, the order is the same as
+       with a single queue.
+     */
+    struct EvalPointDeque
+    {
+        std::deque<EvalQueuePointPtr> _points;
+#ifdef _OPENMP
+        omp_lock_t _lock;
+#endif // _OPENMP
+    };
+    std::vector<EvalPointDeque> _evalPointDeques;
+
+    /// Total number of points in _evalPointDeques.
+    std::atomic<size_t> _nbPointsInDeques;
 #endif // USE_PRIORITY_QUEUE
 
 #ifdef _OPENMP
     /// To lock the queue
     omp_lock_t _evalQueueLock;
+
+    /**
+     * Threads that have nothing to do wait on _eventCond instead of polling:
+     * threads waiting for points to evaluate, and master thread waiting for
+     * evaluations to complete. \n
+     * An event is counted in _nbEvents when points are added to the queue,
+     * when an evaluation completes, and when evaluation is stopped.
+     */
+    std::mutex              _eventMutex;
+    std::condition_variable _eventCond;
+    size_t                  _nbEvents;  ///< Number of events, protected by _eventMutex
 #endif // _OPENMP
 
     /**
      * Barrier used for the current runs. \n
      * Modified only by master thread. Used by all threads.
+     * With asynchronous evaluations, it may be replaced while other threads
+       are evaluating: access it atomically through setBarrier() and getBarrier().
      */
     std::shared_ptr<Barrier> _barrier;
     bool _opportunisticEval; ///< Is opportunistic ?
 
+    std::atomic<bool>   _asyncEval;     ///< Are evaluations asynchronous (ASYNC_EVAL) ?
+    bool                _asyncRun;      ///< Is the current run asynchronous? Used by master thread only.
+    std::atomic<size_t> _maxStaleness;  ///< ASYNC_EVAL_MAX_STALENESS
+    std::atomic<size_t> _currentK;      ///< Highest iteration number of the points added to the queue
+
     SuccessType _success; ///< Success type of the last run
 
     std::atomic<size_t> _currentlyRunning; ///< Count number of evaluations currently running
@@ -163,7 +224,7 @@ private:
      */
     std::atomic<size_t> _nbEvalSentToEvaluator;
     
-    bool _doneWithEval;     ///< All evaluations done. The queue can be destroyed.
+    std::atomic<bool> _doneWithEval;    ///< All evaluations done. The queue can be destroyed.
 
 public:
     
@@ -178,17 +239,35 @@ public:
                               ComparePriority comp = ComparePriority() )
       : _evaluator(std::move(evaluator)),
         _evalContParams(evalContParams),
+        _opportunisticEvalHandle(evalContParams->getAttributeHandle<bool>("OPPORTUNISTIC_EVAL")),
+        _clearEvalQueueHandle(evalContParams->getAttributeHandle<bool>("CLEAR_EVAL_QUEUE")),
+        _asyncEvalHandle(evalContParams->getAttributeHandle<bool>("ASYNC_EVAL")),
+        _maxStalenessHandle(evalContParams->getAttributeHandle<size_t>("ASYNC_EVAL_MAX_STALENESS")),
+        _bbMaxBlockSizeHandle(evalContParams->getAttributeHandle<size_t>("BB_MAX_BLOCK_SIZE")),
+        _maxBbEvalHandle(evalContParams->getAttributeHandle<size_t>("MAX_BB_EVAL")),
+        _maxEvalHandle(evalContParams->getAttributeHandle<size_t>("MAX_EVAL")),
+        _maxBlockEvalHandle(evalContParams->getAttributeHandle<size_t>("MAX_BLOCK_EVAL")),
+        _sgteEvalNbHandle(evalContParams->getAttributeHandle<size_t>("SGTELIB_MODEL_EVAL_NB")),
 #ifdef USE_PRIORITY_QUEUE
         _evalPointQueue(comp),
 #else
         _evalPointQueue(),
         _comp(comp),
+        _evalPointDeques(),
+        _nbPointsInDeques(0),
 #endif // USE_PRIORITY_QUEUE
 #ifdef _OPENMP
         _evalQueueLock(),
+        _eventMutex(),
+        _eventCond(),
+        _nbEvents(0),
 #endif // _OPENMP
         _barrier(),
         _opportunisticEval(false),
+        _asyncEval(false),
+        _asyncRun(false),
+        _maxStaleness(0),
+        _currentK(0),
         _success(SuccessType::UNSUCCESSFUL),
         _currentlyRunning(0),
         _bbEval(0),
@@ -255,17 +334,22 @@ public:
     void resetLapBbEval ( void ) { _lapBbEval = 0; }
     size_t getLapBbEval ( void ) { return _lapBbEval; }
 
-    size_t getQueueSize() const { return _evalPointQueue.size(); }
+    /// Number of points in the queue, including points not yet dealt to threads.
+    size_t getQueueSize() const;
 
-    void setBarrier(const std::shared_ptr<Barrier> barrier) { _barrier = barrier; }
-    const std::shared_ptr<Barrier> getBarrier() const { return _barrier; }
+    void setBarrier(const std::shared_ptr<Barrier> barrier) { std::atomic_store(&_barrier, barrier); }
+    const std::shared_ptr<Barrier> getBarrier() const { return std::atomic_load(&_barrier); }
     
     bool getOpportunisticEval() const { return _opportunisticEval; }
 
+    /// Are evaluations asynchronous? Some evaluations may complete after the end of run(true).
+    bool getAsyncEval() const { return _asyncEval; }
+
     /// Get the max infeasibility to keep a point in barrier
     Double getHMax() const
     {
-        return (nullptr == _barrier) ? INF : _barrier->getHMax();
+        auto barrier = getBarrier();
+        return (nullptr == barrier) ? INF : barrier->getHMax();
     }
 
     /// Get the parameters for \c *this
@@ -314,6 +398,10 @@ public:
 
 #ifndef USE_PRIORITY_QUEUE
     /// Sort the queue with respect to the comparison function comp.
+    /**
+     Points staged in _evalPointQueue and points remaining in the
+     per-thread deques are sorted together, then dealt again to the deques.
+     */
     void sort(ComparePriority comp);
   
     /// Use the default comparison function _comp.
@@ -335,11 +423,14 @@ public:
     /**
      * Stop reasons may be controled by parameters MAX_BB_EVAL, MAX_EVAL, OPPORTUNISTIC_EVAL. \n
      * If strategy is opportunistic, stop as soon as a successful point is found. \n
-     \return    The success type of the evaluations.
+     * If allowAsyncEval and ASYNC_EVAL are true, master thread does not wait for
+       the evaluations in progress, and the remaining points are kept in the queue. \n
+     \param allowAsyncEval  The caller can use late results from the cache. Only used by master thread -- \b IN.
+     \return                The success type of the evaluations.
      */
-    SuccessType run();
+    SuccessType run(const bool allowAsyncEval = false);
   
-    /// Stop evaluation
+    /// Stop evaluation. Wake up the threads waiting for points.
     void stop() ;
 
     /// Restart
@@ -426,9 +517,55 @@ private:
     /// Did we reach a stop condition (for main thread)?
     bool stopMainEval();
 
+    /// Is the point too old to be evaluated (asynchronous evaluations only)?
+    /**
+     \param evalQueuePoint  The point popped from the queue -- \b IN.
+     \return                \c true if the point was generated more than ASYNC_EVAL_MAX_STALENESS iterations ago.
+     */
+    bool isStale(const EvalQueuePointPtr &evalQueuePoint) const;
+
+#ifndef USE_PRIORITY_QUEUE
+    /// Deal the points staged in _evalPointQueue to the per-thread deques.
+    /**
+     * If doSort is \c true, the points remaining in the deques are sorted
+       along with the staged points using comp, and all points are dealt again.
+       Otherwise, the staged points are added at the end of the deques.
+     * The queue must be locked by the master thread.
+
+     \param doSort  Sort the points before dealing them -- \b IN.
+     \param comp    The priority comparison function -- \b IN.
+     */
+    void dealPointsToDeques(const bool doSort, ComparePriority comp);
+
+    /// Pop the front point of the deque of index dequeIndex.
+    /**
+     \param dequeIndex      Index in _evalPointDeques -- \b IN.
+     \param evalQueuePoint  The eval point popped from the deque -- \b OUT.
+     \return                \c true if a point was popped, \c false if the deque was empty.
+     */
+    bool popFromDeque(const size_t dequeIndex, EvalQueuePointPtr &evalQueuePoint);
+#endif // USE_PRIORITY_QUEUE
+
     /// Debug trace when a thread is waiting.
     void displayDebugWaitingInfo(time_t &lastDisplayed) const;
 
+    /// Count an event and wake up the waiting threads.
+    void notifyEvent();
+
+    /// Number of events so far.
+    /**
+     * To be called before testing the condition to wait for, so that an
+       event occurring after the test is not missed by waitForEvent().
+     */
+    size_t getNbEvents();
+
+    /// Wait until an event occurs after the first nbEvents events.
+    /**
+     * The wait also ends after one second, for debug display.
+     \param nbEvents    The value of getNbEvents() before testing the condition -- \b IN.
+     */
+    void waitForEvent(const size_t nbEvents);
+
     /// Stats Output
     void AddStatsInfo(const BlockForEval& block) const;
 
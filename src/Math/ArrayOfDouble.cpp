@@ -86,20 +86,13 @@ std::istream& NOMAD::operator>>(std::istream& in, NOMAD::ArrayOfDouble& coords)
 /*                         constructor                       */
 /*-----------------------------------------------------------*/
 NOMAD::ArrayOfDouble::ArrayOfDouble(size_t n, const NOMAD::Double& d)
-  : _n(n),
+  : _n(0),
     _array(nullptr)
 {
-    if (_n > 0)
+    setSize(n);
+    if (d.isDefined())
     {
-        _array = new NOMAD::Double [_n];
-        if (d.isDefined())
-        {
-            std::fill (_array, _array + _n, d);
-        }
-    }
-    else
-    {
-        _n = 0;
+        std::fill (_array, _array + _n, d);
     }
 }
 
@@ -108,12 +101,13 @@ NOMAD::ArrayOfDouble::ArrayOfDouble(size_t n, const NOMAD::Double& d)
 /*                        copy constructor                   */
 /*-----------------------------------------------------------*/
 NOMAD::ArrayOfDouble::ArrayOfDouble(const NOMAD::ArrayOfDouble &coord)
-  : _n(coord._n),
+  : _n(0),
     _array(nullptr)
 {
+    setSize(coord._n);
     if (_n > 0)
     {
-        NOMAD::Double       * array1 =  _array = new NOMAD::Double [_n];
+        NOMAD::Double       * array1 = _array;
         const NOMAD::Double * array2 = coord._array;
         for (size_t k = 0; k < _n; ++k, ++array1, ++array2)
         {
@@ -128,36 +122,57 @@ NOMAD::ArrayOfDouble::ArrayOfDouble(const NOMAD::ArrayOfDouble &coord)
 /*-----------------------------------------------*/
 NOMAD::ArrayOfDouble::~ArrayOfDouble ()
 {
-    delete [] _array;
+    if (_array != _smallArray)
+    {
+        delete [] _array;
+    }
 }
 
 
 /*-----------------------------------------------*/
-/*   This method changes the array's dimension   */
-/*   and sets all values to d                    */
+/*   This method changes the array's dimension.  */
+/*   The values are not kept.                    */
 /*-----------------------------------------------*/
-void NOMAD::ArrayOfDouble::reset (size_t n, const NOMAD::Double &d)
+void NOMAD::ArrayOfDouble::setSize(size_t n)
 {
-    if (n == 0)
+    if (n == _n)
+    {
+        return;
+    }
+
+    if (_array != _smallArray)
     {
-        _n = 0;
         delete [] _array;
+    }
+
+    _n = n;
+    if (0 == n)
+    {
         _array = nullptr;
     }
+    else if (n <= SMALL_SIZE)
+    {
+        _array = _smallArray;
+    }
     else
     {
-        _n = n;
-        delete [] _array;
-        _array = new NOMAD::Double [_n];
-
-        if (d.isDefined())
-        {
-            std::fill(_array, _array + _n, d);
-        }
+        _array = new NOMAD::Double [n];
     }
 }
 
 
+/*-----------------------------------------------*/
+/*   This method changes the array's dimension   */
+/*   and sets all values to d                    */
+/*-----------------------------------------------*/
+void NOMAD::ArrayOfDouble::reset (size_t n, const NOMAD::Double &d)
+{
+    // The storage may be reused: always set the values.
+    setSize(n);
+    std::fill(_array, _array + _n, d);
+}
+
+
 /*-----------------------------------------------*/
 /*  This method changes the array's dimension.   */
 /*  The values are kept.                         */
@@ -171,29 +186,31 @@ void NOMAD::ArrayOfDouble::resize(size_t n, const NOMAD::Double &d)
 
     if (n == 0)
     {
-        _n = 0;
-        delete [] _array;
-        _array = nullptr;
+        setSize(0);
         return;
     }
 
-    NOMAD::Double *newArray = new NOMAD::Double[n];
-    if (_array)
+    size_t min = ( n < _n ) ? n : _n;
+    if (_array == _smallArray && n <= SMALL_SIZE)
     {
-        size_t min = ( n < _n ) ? n : _n;
+        // The values stay in place.
+        std::fill(_array + min, _array + n, d);
+        _n = n;
+        return;
+    }
 
-        NOMAD::Double       * array1 = newArray;
-        const NOMAD::Double * array2 = _array;
+    NOMAD::Double *newArray = (n <= SMALL_SIZE) ? _smallArray : new NOMAD::Double[n];
 
-        for (size_t i = 0; i < min; ++i, ++array1, ++array2)
-        {
-            *array1 = *array2;
-        }
-        if (d.isDefined())
-        {
-            std::fill(newArray + min, newArray + n, d);
-        }
+    NOMAD::Double       * array1 = newArray;
+    const NOMAD::Double * array2 = _array;
+    for (size_t i = 0; i < min; ++i, ++array1, ++array2)
+    {
+        *array1 = *array2;
+    }
+    std::fill(newArray + min, newArray + n, d);
 
+    if (_array != _smallArray)
+    {
         delete [] _array;
     }
     _array  = newArray;
@@ -254,54 +271,65 @@ void NOMAD::ArrayOfDouble::snapToBounds(const NOMAD::ArrayOfDouble &lowerBound,
     {
         for (size_t i = 0; i < n; ++i)
         {
-            if (lowerBound[i].isDefined() && _array[i] < lowerBound[i])
-            {
-                if (deltaMeshSize.isDefined() && deltaMeshSize[i].isDefined() && deltaMeshSize[i] > 0)
-                {
-                    NOMAD::Double arrayPreviousValue = _array[i]; // for debug info
-                    _array[i] = frameCenter[i] + (lowerBound[i] - frameCenter[i]).nextMult(deltaMeshSize[i]);
-                    if (_array[i] < lowerBound[i])
-                    {
-                        //_array[i] += deltaMeshSize[i];
-                        std::cerr << "Warning: snapToBounds: Error snapping " << arrayPreviousValue << " to lower bound " << lowerBound[i] << " - frameCenter = " << frameCenter[i] << ", deltaMeshSize = " << deltaMeshSize[i] << std::endl;
-                    }
-                }
-                else
-                {
-                    _array[i] = lowerBound[i];
-                }
-                continue;
-            }
-            if (upperBound[i].isDefined() && _array[i] > upperBound[i])
-            {
-                if (deltaMeshSize.isDefined() && deltaMeshSize[i].isDefined() && deltaMeshSize[i] > 0)
-                {
-                    _array[i] = frameCenter[i] + (upperBound[i] - frameCenter[i]).nextMult(deltaMeshSize[i]);
-                    if (_array[i] > upperBound[i])
-                    {
-                        _array[i] -= deltaMeshSize[i];
-                    }
-                }
-                else
-                {
-                    _array[i] = upperBound[i];
-                }
-                continue;
-            }
-            // Sanity checks
-            if (lowerBound[i].isDefined() && _array[i] < lowerBound[i])
+            snapToBounds(_array[i], i, lowerBound, upperBound, frameCenter, deltaMeshSize);
+        }
+    }
+}
+
+
+void NOMAD::ArrayOfDouble::snapToBounds(NOMAD::Double &value,
+                                        size_t i,
+                                        const NOMAD::ArrayOfDouble &lowerBound,
+                                        const NOMAD::ArrayOfDouble &upperBound,
+                                        const NOMAD::ArrayOfDouble &frameCenter,
+                                        const NOMAD::ArrayOfDouble &deltaMeshSize)
+{
+    if (lowerBound[i].isDefined() && value < lowerBound[i])
+    {
+        if (deltaMeshSize.isDefined() && deltaMeshSize[i].isDefined() && deltaMeshSize[i] > 0)
+        {
+            NOMAD::Double arrayPreviousValue = value; // for debug info
+            value = frameCenter[i] + (lowerBound[i] - frameCenter[i]).nextMult(deltaMeshSize[i]);
+            if (value < lowerBound[i])
             {
-                std::string err = "Error: snapToBounds: Could not snap value " + _array[i].tostring();
-                err += " within lower bound " + lowerBound[i].tostring();
-                std::cerr << err << std::endl;
+                //value += deltaMeshSize[i];
+                std::cerr << "Warning: snapToBounds: Error snapping " << arrayPreviousValue << " to lower bound " << lowerBound[i] << " - frameCenter = " << frameCenter[i] << ", deltaMeshSize = " << deltaMeshSize[i] << std::endl;
             }
-            if (upperBound[i].isDefined() && _array[i] > upperBound[i])
+        }
+        else
+        {
+            value = lowerBound[i];
+        }
+        return;
+    }
+    if (upperBound[i].isDefined() && value > upperBound[i])
+    {
+        if (deltaMeshSize.isDefined() && deltaMeshSize[i].isDefined() && deltaMeshSize[i] > 0)
+        {
+            value = frameCenter[i] + (upperBound[i] - frameCenter[i]).nextMult(deltaMeshSize[i]);
+            if (value > upperBound[i])
             {
-                std::string err = "Error: snapToBounds: Could not snap value " + _array[i].tostring();
-                err += " within upper bound " + upperBound[i].tostring();
-                std::cerr << err << std::endl;
+                value -= deltaMeshSize[i];
             }
         }
+        else
+        {
+            value = upperBound[i];
+        }
+        return;
+    }
+    // Sanity checks
+    if (lowerBound[i].isDefined() && value < lowerBound[i])
+    {
+        std::string err = "Error: snapToBounds: Could not snap value " + value.tostring();
+        err += " within lower bound " + lowerBound[i].tostring();
+        std::cerr << err << std::endl;
+    }
+    if (upperBound[i].isDefined() && value > upperBound[i])
+    {
+        std::string err = "Error: snapToBounds: Could not snap value " + value.tostring();
+        err += " within upper bound " + upperBound[i].tostring();
+        std::cerr << err << std::endl;
     }
 }
 
@@ -626,19 +654,7 @@ NOMAD::ArrayOfDouble& NOMAD::ArrayOfDouble::operator= (const NOMAD::ArrayOfDoubl
         return *this;
     }
 
-    if (_n != arrayOfDouble._n)
-    {
-        delete [] _array;
-        _n = arrayOfDouble._n;
-        if (_n > 0)
-        {
-            _array = new NOMAD::Double [_n];
-        }
-        else
-        {
-            _array = nullptr;
-        }
-    }
+    setSize(arrayOfDouble._n);
 
     NOMAD::Double       * array1 = _array;
     const NOMAD::Double * array2 = arrayOfDouble._array;
@@ -697,12 +713,7 @@ void NOMAD::ArrayOfDouble::set(size_t n, const NOMAD::Double *a)
     if (n == 0 || !a)
         return;
 
-    if (_n != n)
-    {
-        delete [] _array;
-        _n      = n;
-        _array = new NOMAD::Double [_n];
-    }
+    setSize(n);
 
     NOMAD::Double* array = _array;
     for (size_t k = 0; k < _n; ++k, ++array, ++a)
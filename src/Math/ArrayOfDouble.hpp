@@ -72,13 +72,24 @@ public:
     static const std::string pStart; ///< Static variable used for array delimitation.
     static const std::string pEnd; ///< Static variable used for array delimitation.
 
+    /// Largest dimension for which the values are stored in the object itself.
+    /**
+     Arrays of a larger dimension are allocated on the heap. Small problems
+     then do not allocate anything for the many temporary points and
+     directions, at the cost of a larger object.
+     */
+    static const size_t SMALL_SIZE = 8;
+
 protected:
     /*---------*/
     /* Members */
     /*---------*/
 
     size_t _n;          ///< Dimension of the array.
-    Double* _array;     ///< Values of the array.
+    Double* _array;     ///< Values of the array. Points to \c _smallArray when \c _n <= \c SMALL_SIZE.
+
+private:
+    Double _smallArray[SMALL_SIZE]; ///< Storage of the values of a small array.
 
 public:
     /*-------------*/
@@ -205,6 +216,23 @@ public:
                       const ArrayOfDouble &frameCenter,
                       const ArrayOfDouble &meshSize);
 
+    /// Snap the value of index i of an array to the bounds. Remain on mesh centered on frameCenter.
+    /**
+     Helper for snapToBounds(), also used for the points of a PointBatch.
+     \param value       The value to snap -- \b IN/OUT.
+     \param i           The index of the value in the array -- \b IN.
+     \param lb          The lower bounds -- \b IN.
+     \param ub          The upper bounds -- \b IN.
+     \param frameCenter The frame center -- \b IN.
+     \param meshSize    The mesh size -- \b IN.
+     */
+    static void snapToBounds(Double &value,
+                             size_t i,
+                             const ArrayOfDouble &lb,
+                             const ArrayOfDouble &ub,
+                             const ArrayOfDouble &frameCenter,
+                             const ArrayOfDouble &meshSize);
+
     /// Verify if the array is inside the bounds. Ignores undefined bounds.
     bool inBounds(const ArrayOfDouble &lowerBound,
                   const ArrayOfDouble &upperBound) const;
@@ -292,6 +320,14 @@ public:
     /// Display with a given precision
     virtual std::string display(const ArrayOfDouble &prec = ArrayOfDouble()) const;
 
+private:
+    /// Change the dimension of the array. The values are not kept.
+    /**
+     The heap storage is reused if the dimension does not change.
+     \param n New dimension of the array -- \b IN.
+     */
+    void setSize(size_t n);
+
 protected:
     //
     
@@ -51,6 +51,7 @@
  \date   2010-04-02
  \see    Double.hpp
  */
+#include <cstring>  // For memcpy
 #include <iomanip>  // For std::setprecision
 #include "../Math/Double.hpp"
 
@@ -169,6 +170,18 @@ double NOMAD::Double::trunk() const
 
 }
 
+uint64_t NOMAD::Double::trunkKey() const
+{
+    // Adding 0.0 converts -0.0 to 0.0, so that equal truncated values
+    // have the same bits.
+    const double trunk = this->trunk() + 0.0;
+    uint64_t key;
+    std::memcpy(&key, &trunk, sizeof(key));
+
+    return key;
+}
+
+
 bool NOMAD::Double::weakLess(const NOMAD::Double &d1, const NOMAD::Double &d2)
 {
     return (d1.trunk() < d2.trunk());
@@ -56,6 +56,7 @@
 #define __NOMAD400_DOUBLE__
 
 #include <cmath>
+#include <cstdint>
 
 #include "../Util/defines.hpp"
 #include "../Util/Exception.hpp"
@@ -182,6 +183,13 @@
 
         /// Get the double value, truncated with respect to epsilon.
         double trunk() const;
+
+        /// Get a 64-bit key of the value truncated with respect to epsilon.
+        /**
+         Two Doubles have the same key if and only if neither is weakLess than
+         the other. The key is exact, it is used for hashing and comparing Points.
+         */
+        uint64_t trunkKey() const;
         
         /// Return the number of decimals of a double.
         std::size_t nbDecimals() const;
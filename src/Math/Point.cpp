@@ -128,6 +128,56 @@ bool NOMAD::Point::weakLess(const NOMAD::Point &lhs, const NOMAD::Point &rhs)
 }
 
 
+bool NOMAD::Point::weakEqual(const NOMAD::Point &lhs, const NOMAD::Point &rhs)
+{
+    if (&lhs == &rhs)
+    {
+        return true;
+    }
+
+    if (lhs._n != rhs._n)
+    {
+        return false;
+    }
+
+    const NOMAD::Double * array1 = lhs._array;
+    const NOMAD::Double * array2 = rhs._array;
+    for (size_t i = 0 ; i < lhs._n ; i++, ++array1, ++array2)
+    {
+        // Same value: same truncated value, no need to compute it.
+        if (array1->todouble() != array2->todouble()
+            && array1->trunkKey() != array2->trunkKey())
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+
+size_t NOMAD::Point::hash() const
+{
+    uint64_t hashKey = _n;
+    const NOMAD::Double * array = _array;
+    for (size_t i = 0; i < _n; i++, ++array)
+    {
+        // Mix each key, since the low bits of a truncated value are
+        // often zero, then combine.
+        uint64_t key = array->trunkKey();
+        key ^= (key >> 33);
+        key *= 0xff51afd7ed558ccd;
+        key ^= (key >> 33);
+        hashKey ^= key + 0x9e3779b97f4a7c15 + (hashKey << 6) + (hashKey >> 2);
+    }
+    hashKey ^= (hashKey >> 33);
+    hashKey *= 0xc4ceb9fe1a85ec53;
+    hashKey ^= (hashKey >> 33);
+
+    return size_t(hashKey);
+}
+
+
 /*----------------------------------------*/
 /* Vector going from Point X to Point Y.  */
 /*----------------------------------------*/
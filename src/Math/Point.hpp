@@ -153,6 +153,21 @@ public:
      */
     static bool weakLess(const Point &lhs, const Point &rhs);
 
+    /// Weak equality, consistent with weakLess.
+    /**
+     \param lhs  Left element of comparison
+     \param rhs  Right element of comparison
+     eturn     \c true if neither lhs nor rhs is weakLess than the other.
+     */
+    static bool weakEqual(const Point &lhs, const Point &rhs);
+
+    /// Hash of the point, consistent with weakEqual.
+    /**
+     * Computed from the exact keys of the truncated coordinates (Double::trunkKey()),
+     * so that points that are weakEqual have the same hash.
+     */
+    size_t hash() const;
+
     /// Addition point = point + direction
     /**
      The current object \c *this is not modified.
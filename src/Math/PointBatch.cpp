@@ -0,0 +1,303 @@
+/*---------------------------------------------------------------------------------*/
+/*  NOMAD - Nonlinear Optimization by Mesh Adaptive Direct Search -                */
+/*                                                                                 */
+/*  NOMAD - Version 4.0.0 has been created by                                      */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  The copyright of NOMAD - version 4.0.0 is owned by                             */
+/*                 Sebastien Le Digabel        - Polytechnique Montreal            */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  NOMAD v4 has been funded by Rio Tinto, Hydro-Québec, NSERC (Natural Science    */
+/*  and Engineering Research Council of Canada), INOVEE (Innovation en Energie     */
+/*  Electrique and IVADO (The Institute for Data Valorization)                     */
+/*                                                                                 */
+/*  NOMAD v3 was created and developed by Charles Audet, Sebastien Le Digabel,     */
+/*  Christophe Tribes and Viviane Rochon Montplaisir and was funded by AFOSR       */
+/*  and Exxon Mobil.                                                               */
+/*                                                                                 */
+/*  NOMAD v1 and v2 were created and developed by Mark Abramson, Charles Audet,    */
+/*  Gilles Couture, and John E. Dennis Jr., and were funded by AFOSR and           */
+/*  Exxon Mobil.                                                                   */
+/*                                                                                 */
+/*  Contact information:                                                           */
+/*    Polytechnique Montreal - GERAD                                               */
+/*    C.P. 6079, Succ. Centre-ville, Montreal (Quebec) H3C 3A7 Canada              */
+/*    e-mail: nomad@gerad.ca                                                       */
+/*    phone : 1-514-340-6053 #6928                                                 */
+/*    fax   : 1-514-340-5665                                                       */
+/*                                                                                 */
+/*  This program is free software: you can redistribute it and/or modify it        */
+/*  under the terms of the GNU Lesser General Public License as published by       */
+/*  the Free Software Foundation, either version 3 of the License, or (at your     */
+/*  option) any later version.                                                     */
+/*                                                                                 */
+/*  This program is distributed in the hope that it will be useful, but WITHOUT    */
+/*  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or          */
+/*  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License    */
+/*  for more details.                                                              */
+/*                                                                                 */
+/*  You should have received a copy of the GNU Lesser General Public License       */
+/*  along with this program. If not, see <http://www.gnu.org/licenses/>.           */
+/*                                                                                 */
+/*  You can find information on the NOMAD software at www.gerad.ca/nomad           */
+/*---------------------------------------------------------------------------------*/
+/**
+ \file   PointBatch.cpp
+ \brief  Contiguous batch of points of the same dimension (implementation)
+ \see    PointBatch.hpp
+ */
+#include <algorithm>
+#include <numeric>
+
+#include "../Math/PointBatch.hpp"
+
+/*-----------------------------------------------------------*/
+/*                         constructor                       */
+/*-----------------------------------------------------------*/
+NOMAD::PointBatch::PointBatch(const size_t nbPoints, const size_t n, const NOMAD::Double& val)
+  : _n(n),
+    _nbPoints(nbPoints),
+    _values(nbPoints * n, val)
+{
+}
+
+
+/*-----------------------------------------------------------*/
+/*                      get/set the points                   */
+/*-----------------------------------------------------------*/
+NOMAD::Double* NOMAD::PointBatch::getCoordinates(size_t k)
+{
+    if (k >= _nbPoints)
+    {
+        std::ostringstream oss;
+        oss << "PointBatch: k = " << k << " is out of bounds [0, " << _nbPoints << "[";
+        throw NOMAD::Exception(__FILE__, __LINE__, oss.str());
+    }
+
+    return _values.data() + k * _n;
+}
+
+
+const NOMAD::Double* NOMAD::PointBatch::getCoordinates(size_t k) const
+{
+    return const_cast<NOMAD::PointBatch*>(this)->getCoordinates(k);
+}
+
+
+NOMAD::Point NOMAD::PointBatch::getPoint(size_t k) const
+{
+    NOMAD::Point point;
+    point.set(_n, getCoordinates(k));
+
+    return point;
+}
+
+
+void NOMAD::PointBatch::setPoint(size_t k, const NOMAD::ArrayOfDouble& x)
+{
+    if (x.size() != _n)
+    {
+        std::string err = "PointBatch: setPoint: Expecting dimension " + std::to_string(_n);
+        err += " but dimension is " + std::to_string(x.size());
+        throw NOMAD::Exception(__FILE__, __LINE__, err);
+    }
+
+    NOMAD::Double* y = getCoordinates(k);
+    for (size_t i = 0; i < _n; ++i)
+    {
+        y[i] = x[i];
+    }
+}
+
+
+/*-----------------------------------------------------------*/
+/*              Add x to all the points of the batch         */
+/*-----------------------------------------------------------*/
+void NOMAD::PointBatch::add(const NOMAD::ArrayOfDouble& x)
+{
+    if (x.size() != _n)
+    {
+        std::string err = "PointBatch: add: Expecting dimension " + std::to_string(_n);
+        err += " but dimension is " + std::to_string(x.size());
+        throw NOMAD::Exception(__FILE__, __LINE__, err);
+    }
+
+    // Read x once, then a single pass over the batch.
+    std::vector<NOMAD::Double> xValues(_n);
+    for (size_t i = 0; i < _n; ++i)
+    {
+        xValues[i] = x[i];
+    }
+
+    NOMAD::Double* y = _values.data();
+    for (size_t k = 0; k < _nbPoints; ++k)
+    {
+        for (size_t i = 0; i < _n; ++i, ++y)
+        {
+            *y = *y + xValues[i];
+        }
+    }
+}
+
+
+/*-----------------------------------------------------------*/
+/*                        snap to bounds                     */
+/*-----------------------------------------------------------*/
+void NOMAD::PointBatch::snapToBounds(const NOMAD::ArrayOfDouble &lowerBound,
+                                     const NOMAD::ArrayOfDouble &upperBound,
+                                     const NOMAD::ArrayOfDouble &frameCenter,
+                                     const NOMAD::ArrayOfDouble &deltaMeshSize)
+{
+    if (lowerBound.size() != _n || upperBound.size() != _n)
+    {
+        std::string err = "snapToBounds: ";
+        err += "Inconsistent dimension for bounds. Expecting ";
+        err += std::to_string(_n);
+        err += " but sizes are " + std::to_string(lowerBound.size());
+        err += " and " + std::to_string(upperBound.size()) + ".";
+        throw NOMAD::Exception(__FILE__, __LINE__, err);
+    }
+
+    if (!lowerBound.isDefined() && !upperBound.isDefined())
+    {
+        return;
+    }
+
+    // Only the variables with a bound are visited.
+    std::vector<size_t> boundedIndexes;
+    for (size_t i = 0; i < _n; ++i)
+    {
+        if (lowerBound[i].isDefined() || upperBound[i].isDefined())
+        {
+            boundedIndexes.push_back(i);
+        }
+    }
+
+    for (size_t k = 0; k < _nbPoints; ++k)
+    {
+        NOMAD::Double* x = getCoordinates(k);
+        for (size_t i = 0; i < _n; ++i)
+        {
+            if (!x[i].isDefined())
+            {
+                std::string err("snapToBounds: ");
+                err += "ArrayOfDouble is not completely defined.";
+                throw NOMAD::Exception(__FILE__, __LINE__, err);
+            }
+        }
+        for (auto i : boundedIndexes)
+        {
+            NOMAD::ArrayOfDouble::snapToBounds(x[i], i, lowerBound, upperBound, frameCenter, deltaMeshSize);
+        }
+    }
+}
+
+
+/*-----------------------------------------------------------*/
+/*                  remove points equal to x                 */
+/*-----------------------------------------------------------*/
+size_t NOMAD::PointBatch::removePoint(const NOMAD::ArrayOfDouble& x)
+{
+    if (x.size() != _n)
+    {
+        return 0;
+    }
+
+    std::vector<bool> keep(_nbPoints, true);
+    size_t nbRemoved = 0;
+    for (size_t k = 0; k < _nbPoints; ++k)
+    {
+        const NOMAD::Double* y = getCoordinates(k);
+        bool isEqual = true;
+        for (size_t i = 0; i < _n && isEqual; ++i)
+        {
+            isEqual = (y[i].isDefined() && x[i].isDefined() && y[i] == x[i]);
+        }
+        if (isEqual)
+        {
+            keep[k] = false;
+            nbRemoved++;
+        }
+    }
+
+    if (nbRemoved > 0)
+    {
+        compact(keep);
+    }
+
+    return nbRemoved;
+}
+
+
+/*-----------------------------------------------------------*/
+/*                      remove duplicates                    */
+/*-----------------------------------------------------------*/
+size_t NOMAD::PointBatch::removeDuplicates()
+{
+    if (_nbPoints < 2)
+    {
+        return 0;
+    }
+
+    // Two points are weakEqual if and only if they have the same keys.
+    std::vector<uint64_t> keys(_values.size());
+    for (size_t j = 0; j < _values.size(); ++j)
+    {
+        keys[j] = _values[j].trunkKey();
+    }
+
+    // Sort the points by keys. The sort is stable, so that the first point
+    // of a group of equal points comes first.
+    std::vector<size_t> order(_nbPoints);
+    std::iota(order.begin(), order.end(), 0);
+    const size_t n = _n;
+    auto keysLess = [&keys, n](size_t k1, size_t k2)
+    {
+        return std::lexicographical_compare(keys.begin() + k1 * n, keys.begin() + (k1 + 1) * n,
+                                            keys.begin() + k2 * n, keys.begin() + (k2 + 1) * n);
+    };
+    std::stable_sort(order.begin(), order.end(), keysLess);
+
+    std::vector<bool> keep(_nbPoints, true);
+    size_t nbRemoved = 0;
+    for (size_t j = 1; j < _nbPoints; ++j)
+    {
+        if (!keysLess(order[j-1], order[j]))
+        {
+            // Same keys as the previous point in the order.
+            keep[order[j]] = false;
+            nbRemoved++;
+        }
+    }
+
+    if (nbRemoved > 0)
+    {
+        compact(keep);
+    }
+
+    return nbRemoved;
+}
+
+
+void NOMAD::PointBatch::compact(const std::vector<bool>& keep)
+{
+    size_t nbKept = 0;
+    for (size_t k = 0; k < _nbPoints; ++k)
+    {
+        if (keep[k])
+        {
+            if (nbKept != k)
+            {
+                std::copy(_values.begin() + k * _n, _values.begin() + (k + 1) * _n,
+                          _values.begin() + nbKept * _n);
+            }
+            nbKept++;
+        }
+    }
+
+    _nbPoints = nbKept;
+    _values.resize(_nbPoints * _n);
+}
@@ -121,6 +121,19 @@ int main (int argc, char ** argv)
                 }
                 TheMainStep->displayHelp ( helpSubject ,true );
             }
+            // Convert a cache file between text and binary formats if option '-c' has been specified
+            else if (option == "-C" || option == "-CONVERT" || option == "--CONVERT")
+            {
+                if (argc != 4)
+                {
+                    TheMainStep->AddOutputInfo("ERROR: Option -c needs an input and an output cache file", NOMAD::OutputLevel::LEVEL_ERROR);
+                    TheMainStep->displayUsage(argv[0]);
+                }
+                else if (!NOMAD::CacheFileBinary::convert(argv[2], argv[3]))
+                {
+                    TheMainStep->AddOutputInfo(std::string("ERROR: Could not convert cache file \"") + argv[2] + "\"", NOMAD::OutputLevel::LEVEL_ERROR);
+                }
+            }
             else
             {
                 TheMainStep->AddOutputInfo("ERROR: Unrecognized option: " +option, NOMAD::OutputLevel::LEVEL_ERROR);
@@ -55,7 +55,9 @@
 
 #include "../Algos/EvcInterface.hpp"
 #include "../Algos/MainStep.hpp"
+#include "../Cache/CacheFileBinary.hpp"
 #include "../Cache/CacheSet.hpp"
+#include "../Cache/CacheShardedSet.hpp"
 #include "../Util/fileutils.hpp"
 
 #endif // __NOMAD400_NOMAD__
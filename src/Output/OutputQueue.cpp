@@ -45,6 +45,7 @@
 /*  You can find information on the NOMAD software at www.gerad.ca/nomad           */
 /*---------------------------------------------------------------------------------*/
 
+#include <algorithm>
 #include <fstream>
 #include "../Output/OutputQueue.hpp"
 #include "../Util/Exception.hpp"
@@ -55,11 +56,13 @@ omp_lock_t NOMAD::OutputQueue::_s_queue_lock;
 #endif // _OPENMP
 
 std::unique_ptr<NOMAD::OutputQueue> NOMAD::OutputQueue::_single(nullptr);
+std::once_flag NOMAD::OutputQueue::_s_singleFlag;
 
 
 // Private constructor
 NOMAD::OutputQueue::OutputQueue()
-  : _queue(),
+  : _queues(),
+    _nbAdded(0),
     _params(),
     _statsFile(""),
     _statsFileFormat(),
@@ -72,8 +75,19 @@ NOMAD::OutputQueue::OutputQueue()
     _blockStart("{"),
     _blockEnd("}")
 {
+    // One queue per thread. The number of threads may not be set yet:
+    // the queues are shared between threads if there are more threads.
+    size_t nbQueues = 1;
 #ifdef _OPENMP
     omp_init_lock(&_s_queue_lock);
+    nbQueues = std::max(1, std::max(omp_get_max_threads(), omp_get_num_procs()));
+#endif // _OPENMP
+    _queues.resize(nbQueues);
+#ifdef _OPENMP
+    for (auto &threadQueue : _queues)
+    {
+        omp_init_lock(&threadQueue._lock);
+    }
 #endif // _OPENMP
 }
 
@@ -83,12 +97,12 @@ NOMAD::OutputQueue::~OutputQueue()
 {
     // Always flush on destruction. In fact, the queue should be
     // empty at this point.
-    if (! _queue.empty())
+    flush();
+#ifdef _OPENMP
+    for (auto &threadQueue : _queues)
     {
-        //std::cerr << "Calling destructor on a non-empty OutputQueue." << std::endl;
-        flush();
+        omp_destroy_lock(&threadQueue._lock);
     }
-#ifdef _OPENMP
     omp_destroy_lock(&_s_queue_lock);
 #endif // _OPENMP
     // Close stats file
@@ -102,18 +116,12 @@ NOMAD::OutputQueue::~OutputQueue()
 // Access to singleton
 std::unique_ptr<NOMAD::OutputQueue>& NOMAD::OutputQueue::getInstance()
 {
-#ifdef _OPENMP
-    // Lock queue before creating singleton
-    omp_set_lock(&_s_queue_lock);
-#endif
-    if (nullptr == _single)
+    // Create singleton once, without locking on each access.
+    std::call_once(_s_singleFlag, []()
     {
         _single = std::unique_ptr<OutputQueue> (new OutputQueue()) ;
-    }
+    });
 
-#ifdef _OPENMP
-    omp_unset_lock(&_s_queue_lock);
-#endif // _OPENMP
     return _single;
 }
 
@@ -188,7 +196,7 @@ int NOMAD::OutputQueue::getDisplayDegree() const
             displayDegree = 5;
             break;
         default:
-            std::cerr << "Unrecognized maximum display degree: " << (int)_maxOutputLevel << std::endl;
+            std::cerr << "Unrecognized maximum display degree: " << (int)_maxOutputLevel.load() << std::endl;
     }
 
     return displayDegree;
@@ -237,54 +245,104 @@ void NOMAD::OutputQueue::setDisplayDegree(const int displayDegree)
 }
 
 
+NOMAD::OutputQueue::ThreadQueue& NOMAD::OutputQueue::getThreadQueue()
+{
+    size_t threadNum = 0;
+#ifdef _OPENMP
+    threadNum = static_cast<size_t>(omp_get_thread_num());
+#endif // _OPENMP
+    return _queues[threadNum % _queues.size()];
+}
+
+
 // Add Output info
 void NOMAD::OutputQueue::add(NOMAD::OutputInfo outputInfo)
 {
+    // Early out: This info would not be displayed, and it has no stats
+    // for the stats file.
+    if (!goodLevel(outputInfo.getOutputLevel()) && nullptr == outputInfo.getStatsInfo())
+    {
+        return;
+    }
+
+    // Number the info so that Flush keeps the order between threads.
+    const size_t number = _nbAdded++;
+
+    // Only the lock of this thread's queue is acquired. It is shared
+    // with the thread calling Flush.
+    auto &threadQueue = getThreadQueue();
 #ifdef _OPENMP
-    // Acquire lock before adding a new element to the queue
-    omp_set_lock(&_s_queue_lock);
+    omp_set_lock(&threadQueue._lock);
 #endif // _OPENMP
-    _queue.push_back(std::move(outputInfo));
+    threadQueue._queue.push_back(NumberedOutputInfo(number, std::move(outputInfo)));
 #ifdef _OPENMP
-    omp_unset_lock(&_s_queue_lock);
+    omp_unset_lock(&threadQueue._lock);
 #endif // _OPENMP
 }
 
 void NOMAD::OutputQueue::add(const std::string & s, NOMAD::OutputLevel outputLevel)
 {
+    // Early out before building the OutputInfo.
+    if (!goodLevel(outputLevel))
+    {
+        return;
+    }
+
     // Warning: No originator in this case
     OutputInfo outputInfo("", s, outputLevel);
 
-    Add(std::move(outputInfo));
+    add(std::move(outputInfo));
 }
 
 
 // Print all in the queue and flush.
 void NOMAD::OutputQueue::flush()
 {
-    if (_queue.empty())
+#ifdef _OPENMP
+    // Lock queue before flush
+    omp_set_lock(&_s_queue_lock);
+#endif // _OPENMP
+
+    // Merge the queues of all threads.
+    std::vector<NumberedOutputInfo> queue;
+    for (auto &threadQueue : _queues)
+    {
+#ifdef _OPENMP
+        omp_set_lock(&threadQueue._lock);
+#endif // _OPENMP
+        std::move(threadQueue._queue.begin(), threadQueue._queue.end(), std::back_inserter(queue));
+        threadQueue._queue.clear();
+#ifdef _OPENMP
+        omp_unset_lock(&threadQueue._lock);
+#endif // _OPENMP
+    }
+
+    if (queue.empty())
     {
+#ifdef _OPENMP
+        omp_unset_lock(&_s_queue_lock);
+#endif // _OPENMP
         return;
     }
 
+    // Restore the order in which the info was added.
+    std::sort(queue.begin(), queue.end(),
+              [](const NumberedOutputInfo& info1, const NumberedOutputInfo& info2)
+              {
+                  return info1.first < info2.first;
+              });
+
     if (_maxOutputLevel >= NOMAD::OutputLevel::LEVEL_DEBUGDEBUG)
     {
         // hyper-debug
-        std::cout << "Output all " << _queue.size() << " elements." << std::endl;
+        std::cout << "Output all " << queue.size() << " elements." << std::endl;
     }
 
-#ifdef _OPENMP
-    // Lock queue before flush
-    omp_set_lock(&_s_queue_lock);
-#endif // _OPENMP
-
     // Info goes to Standard output
-    for (std::vector<NOMAD::OutputInfo>::iterator out_it = _queue.begin();
-         out_it != _queue.end(); ++out_it)
+    for (auto out_it = queue.begin(); out_it != queue.end(); ++out_it)
     {
-        flushBlock(std::move(*out_it));
+        flushBlock(out_it->second);
     }
-    _queue.clear();
 #ifdef _OPENMP
     omp_unset_lock(&_s_queue_lock);
 #endif // _OPENMP
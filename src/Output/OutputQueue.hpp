@@ -47,6 +47,8 @@
 #ifndef __NOMAD400_OUTPUTQUEUE__
 #define __NOMAD400_OUTPUTQUEUE__
 
+#include <atomic>
+#include <mutex>
 #include <vector>
 #ifdef _OPENMP
 // Using OpenMP.
@@ -62,6 +64,22 @@
 
 #include "../nomad_nsbegin.hpp"
 
+/// Build and add a message only if its output level is displayed.
+/**
+ Usage: \n
+ OUTPUT_DEBUG_START \n
+ std::string s = "Point: " + x.display(); \n
+ NOMAD::OutputQueue::Add(s, NOMAD::OutputLevel::LEVEL_DEBUG); \n
+ OUTPUT_DEBUG_END
+ */
+#define OUTPUT_INFO_START if (NOMAD::OutputQueue::GoodLevel(NOMAD::OutputLevel::LEVEL_INFO)) {
+#define OUTPUT_INFO_END }
+#define OUTPUT_DEBUG_START if (NOMAD::OutputQueue::GoodLevel(NOMAD::OutputLevel::LEVEL_DEBUG)) {
+#define OUTPUT_DEBUG_END }
+#define OUTPUT_DEBUGDEBUG_START if (NOMAD::OutputQueue::GoodLevel(NOMAD::OutputLevel::LEVEL_DEBUGDEBUG)) {
+#define OUTPUT_DEBUGDEBUG_END }
+
+
 /// Queue of all information that was not output yet.
 /**
  The output queue is a singleton. Some OutputInfo can be added to the queue. The output information is displayed when calling OutputQueue::Flush and queue is emptied. \n
@@ -70,6 +88,13 @@
 
  The display can be limited to a maximum block/step level. (OutputQueue::_maxStepLevel). \n
 
+ Information with an output level that is not displayed, and that has no
+ stats, is dropped when it is added. Use OutputQueue::GoodLevel, or the
+ OUTPUT_..._START macros, to avoid building a message that is not displayed. \n
+
+ Each thread adds its information to its own queue. The queues are merged,
+ in the order the information was added, by OutputQueue::Flush. \n
+
  \todo Replace calls to std::cout by something more general.
 
  */
@@ -88,6 +113,20 @@ public:
 
     void initParameters(const std::shared_ptr<DisplayParameters>& params);
 
+    /// Is information of this output level displayed?
+    /**
+     Before initParameters() is called, the display degree is not known:
+     all information is kept until Flush.
+     */
+    bool goodLevel(const OutputLevel& outputLevel) const
+    {
+        return (nullptr == _params || outputLevel <= _maxOutputLevel);
+    }
+    static bool GoodLevel(const OutputLevel& outputLevel)
+    {
+        return getInstance()->goodLevel(outputLevel);
+    }
+
     void add(OutputInfo outputInfo);
     static void Add(OutputInfo outputInfo)
     {
@@ -156,7 +195,7 @@ public:
 
 private:
 #ifdef _OPENMP
-    // Acquire lock before Add or Flush.
+    // Acquire lock before Flush.
     // NOTE It does not seem relevant for the lock to be static,
     // because OutputQueue is a singleton anyway. If staticity causes problems,
     // we could remove the static keyword.
@@ -165,10 +204,26 @@ private:
 
 
     static std::unique_ptr<OutputQueue> _single; ///< The singleton
+    static std::once_flag _s_singleFlag; ///< Create the singleton only once
+
+
+    /// An OutputInfo, numbered in the order it was added.
+    typedef std::pair<size_t, OutputInfo> NumberedOutputInfo;
+
+    /// Queue of the OutputInfo added by one thread.
+    struct ThreadQueue
+    {
+        std::vector<NumberedOutputInfo> _queue;
+#ifdef _OPENMP
+        omp_lock_t _lock;   ///< Lock between this thread and the thread calling Flush
+#endif // _OPENMP
+    };
 
+    /// Queues of all the OutputInfo we have to print. One queue per thread.
+    std::vector<ThreadQueue> _queues;
 
-    /// Queue of all the OutputInfo we have to print.
-    std::vector<OutputInfo> _queue;
+    /// Number given to the next OutputInfo added.
+    std::atomic<size_t> _nbAdded;
 
     /// Display parameters
     std::shared_ptr<DisplayParameters> _params;
@@ -197,7 +252,7 @@ private:
     size_t _hWidth;
 
     size_t _maxStepLevel;  ///< Maximum step level we want to print out.
-    OutputLevel _maxOutputLevel; ///< Output level (~display degree) we want to print out
+    std::atomic<OutputLevel> _maxOutputLevel; ///< Output level (~display degree) we want to print out
     int _indentLevel;   ///< Internal indentation level
 
     const std::string _blockStart; ///< Symbol for a block start.
@@ -206,6 +261,8 @@ private:
     void startBlock();
     void endBlock();
     void flush();
+    /// Queue of the current thread.
+    ThreadQueue& getThreadQueue();
     void flushBlock(const OutputInfo &outputInfo);
     void flushStatsToStatsFile(const StatsInfo *statsInfo);
     void flushStatsToStdout(const StatsInfo *statsInfo);
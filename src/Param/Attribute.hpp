@@ -72,7 +72,7 @@
 class Attribute {
 public:
 
-    virtual const std::string & getName(){ return _name; }
+    virtual const std::string & getName() const { return _name; }
     virtual const std::string & getShortInfo(){ return _shortInfo; }
     virtual const std::string & getHelpInfo(){ return _helpInfo; }
     virtual const std::string & getKeywords(){ return _keywords; }
@@ -108,7 +108,17 @@ void NOMAD::CacheParameters::checkAndComply( std::shared_ptr<NOMAD::RunParameter
             setAttributeValue("CACHE_FILE", cacheFileName);
         }
     }
-    
+
+    if (0 == getAttributeValueProtected<size_t>("CACHE_NB_SHARDS", false))
+    {
+        throw NOMAD::Exception(__FILE__, __LINE__, "Parameter CACHE_NB_SHARDS must be positive");
+    }
+
+    if (0 == getAttributeValueProtected<size_t>("CACHE_JOURNAL_COMPACTION", false))
+    {
+        throw NOMAD::Exception(__FILE__, __LINE__, "Parameter CACHE_JOURNAL_COMPACTION must be positive");
+    }
+
     _toBeChecked = false;
     
 }
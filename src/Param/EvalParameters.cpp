@@ -121,6 +121,13 @@ void NOMAD::EvalParameters::checkAndComply( const std::shared_ptr<NOMAD::RunPara
         }
     }
     
+#ifdef WINDOWS
+    if (getAttributeValueProtected<bool>("BB_EXE_PERSISTENT", false))
+    {
+        throw NOMAD::Exception(__FILE__, __LINE__, "BB_EXE_PERSISTENT is not available on Windows");
+    }
+#endif
+
     // The default value is empty: set a single OBJ
     auto bbOType = getAttributeValueProtected<NOMAD::BBOutputTypeList>("BB_OUTPUT_TYPE", false);
     if ( bbOType.size() == 0 )
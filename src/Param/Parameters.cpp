@@ -48,6 +48,7 @@
 #include "../Param/Parameters.hpp"
 #include "../Type/BBInputType.hpp"
 #include "../Type/BBOutputType.hpp"
+#include "../Type/CacheEvictionType.hpp"
 #include "../Type/LHSearchType.hpp"
 #include "../Type/SgtelibModelFeasibilityType.hpp"
 #include "../Type/SgtelibModelFormulationType.hpp"
@@ -106,6 +107,12 @@ void NOMAD::Parameters::copyParameters(const Parameters& params)
             auto value = params.getAttributeValue<NOMAD::BBOutputTypeList>(paramName);
             setAttributeValue(paramName, value );
         }
+        // CacheEvictionType
+        else if (paramType == typeid(NOMAD::CacheEvictionType).name())
+        {
+            auto value = params.getAttributeValue<NOMAD::CacheEvictionType>(paramName);
+            setAttributeValue(paramName, value );
+        }
         // LHSearchType
         else if (paramType == typeid(NOMAD::LHSearchType).name())
         {
@@ -342,6 +349,16 @@ bool NOMAD::Parameters::isAlgoCompatible(const NOMAD::Parameters *p)
                     isCompatible = false;
                 }
             }
+            // CacheEvictionType
+            else if ( paramType == typeid(NOMAD::CacheEvictionType).name() )
+            {
+                if ( getAttributeValueProtected<NOMAD::CacheEvictionType>(paramName,false) != p->getAttributeValueProtected<NOMAD::CacheEvictionType>(paramName,false) )
+                {
+                    sdebug += NOMAD::CacheEvictionTypeToString(getAttributeValueProtected<NOMAD::CacheEvictionType>(paramName,false)) + "\n";
+                    sdebug += NOMAD::CacheEvictionTypeToString(p->getAttributeValueProtected<NOMAD::CacheEvictionType>(paramName,false));
+                    isCompatible = false;
+                }
+            }
             // LHSearchType
             else if ( paramType == typeid(NOMAD::LHSearchType).name() )
             {
@@ -645,6 +662,12 @@ void NOMAD::Parameters::readEntries(const bool overwrite)
                 checkFormat1(pe);
                 setAttributeValue(paramName, NOMAD::stringToBBOutputTypeList(pe->getAllValues()));
             }
+            // CacheEvictionType
+            else if (paramType == typeid(NOMAD::CacheEvictionType).name())
+            {
+                checkFormat1(pe);
+                setAttributeValue(paramName, NOMAD::stringToCacheEvictionType(*(pe->getValues().begin())));
+            }
             // LHSearchType
             else if (paramType == typeid(NOMAD::LHSearchType).name())
             {
@@ -1176,6 +1199,15 @@ void NOMAD::Parameters::registerAttributes( const std::vector<NOMAD::AttributeDe
                               algoCompatibilityCheck, restartAttribute, uniqueEntry,
                               att._shortInfo, att._helpInfo, att._keywords);
         }
+        // CacheEvictionType
+        else if (   att._type== "NOMAD::CacheEvictionType"
+                 || att._type== "CacheEvictionType")
+        {
+            registerAttribute( att._name,
+                              NOMAD::stringToCacheEvictionType(att._defaultValue),
+                              algoCompatibilityCheck, restartAttribute,
+                              uniqueEntry, att._shortInfo , att._helpInfo, att._keywords );
+        }
         // SgtelibModelFeasibilityType
         else if (   att._type== "NOMAD::SgtelibModelFeasibilityType"
                  || att._type== "SgtelibModelFeasibilityType")
@@ -78,6 +78,12 @@ struct lessThanAttribute : public std::binary_function<SPtrAtt, SPtrAtt, bool>
     }
 };
 
+/**
+ A handle on a typed attribute, for access to its value without lookup by name (see Parameters::getAttributeHandle).
+ */
+template<typename T>
+using AttributeHandle = std::shared_ptr<const TypeAttribute<T>>;
+
 /**
  An attribute set contains shared pointers to Attribute and a lessThanAttribute comparison/binary function for ordering.
  */
@@ -355,9 +361,9 @@ protected:
     SPtrAtt getAttribute(std::string name) const;
 
 
-    // getSpValue: value is of correct type for parameter name.
-    template<typename T> const T&
-    getSpValue(const std::string &name, bool flagCheckException, bool flagDefault = false) const
+    // getTypeAttribute: attribute is of correct type for parameter name.
+    template<typename T> std::shared_ptr<TypeAttribute<T>>
+    getTypeAttribute(const std::string &name) const
     {
         // Get attribute from which to get value
         SPtrAtt att;
@@ -380,13 +386,21 @@ protected:
             throw Exception(__FILE__,__LINE__, err);
         }
 
+        // Dynamic cast to the selected TypeAttribute
+        return std::dynamic_pointer_cast<TypeAttribute<T>>(att);
+    }
+
+
+    // getSpValue: value is of correct type for parameter name.
+    template<typename T> const T&
+    getSpValue(const std::string &name, bool flagCheckException, bool flagDefault = false) const
+    {
         // Note: we use getAttributeValue in init() and checkAndComply().
         // We cannot verify toBeChecked() here. It has to be verified at
         // another level.
 
         // Get value from attribute
-        // Dynamic cast to the selected TypeAttribute
-        std::shared_ptr<TypeAttribute<T>> sp = std::dynamic_pointer_cast<TypeAttribute<T>>(att);
+        std::shared_ptr<TypeAttribute<T>> sp = getTypeAttribute<T>(name);
 
         if (flagDefault)
         {
@@ -480,6 +494,39 @@ public:
         return getAttributeValueProtected<T>(name,true,flagDefault);
     }
 
+    /// Get a typed handle on an attribute of \c *this.
+    /**
+     The name and the type of the attribute are verified once, here. Then
+     getAttributeValue(handle) gives the current value with no lookup by name.
+     Used on hot paths, e.g. for each point evaluated. \n
+     The handle must only be used with the Parameters that created it. An
+     exception is triggered if the attribute does not exist or if its type is
+     not T.
+     */
+    template<typename T> AttributeHandle<T>
+    getAttributeHandle(const std::string &name) const
+    {
+        return getTypeAttribute<T>(name);
+    }
+
+    /**
+     Get the attribute value from a handle obtained by getAttributeHandle().
+     As for getAttributeValue(name), an exception is triggered if the
+     parameters have not been checked.
+     */
+    template<typename T> const T&
+    getAttributeValue(const AttributeHandle<T> &handle) const
+    {
+        // All attributes except DIMENSION must be checked before accessing the value
+        if ( _toBeChecked && handle->getName() != "DIMENSION" )
+        {
+            std::string err = "In getAttributeValue<T> the attribute ";
+            err += handle->getName() + " has not been checked";
+            throw Exception(__FILE__,__LINE__, err);
+        }
+        return handle->getValue();
+    }
+
     /**
      This function is called by AllParameters::readParamLine to identify the type of an attribute given in a file. If the attribute has not been registered, an error message is displayed but no exception is triggered and the execution continues.
      */